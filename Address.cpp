@@ -66,6 +66,19 @@ const std::string& Address::getStreet() const
 	return street;
 }
 
+/**
+ * \brief		: Method to add the heap blocks of the address to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the strings as ADDRESS_FIELDS
+ * \return		: NONE
+ */
+void Address::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::ADDRESS_FIELDS, 1);
+	report.addString(MemoryReport::ADDRESS_FIELDS, street);
+	report.addString(MemoryReport::ADDRESS_FIELDS, cityName);
+	report.addString(MemoryReport::ADDRESS_FIELDS, additionalInfo);
+}
+
 /*
  * \brief		: Default destructor
  */
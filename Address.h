@@ -14,6 +14,8 @@
 
 #include <string>
 
+#include "MemoryReport.h"
+
 class Address
 {
 private:
@@ -70,6 +72,13 @@ public:
      */
 	const std::string& getStreet() const;
 
+    /**
+     * \brief		: Method to add the heap blocks of the address to a memory report
+     * \param[IN]	: MemoryReport &report - report, gets the strings as ADDRESS_FIELDS
+     * \return		: NONE
+     */
+	void reportMemory(MemoryReport &report) const;
+
 	/*
 	 * \brief		: Default destructor
 	 */
@@ -10,7 +10,7 @@
 /****************************************************************************/
 
 //! System Includes
-#include <iostream>
+#include <ostream>
 
 //! User Includes
 #include "BlockCourse.h"
@@ -28,21 +28,6 @@ BlockCourse::BlockCourse(unsigned int courseKey, std::string title, unsigned cha
 			 startDate{startDate}, endDate {endDate}, startTime {startTime}, endTime {endTime}
 {}
 
-/**
- * \brief		: Virtual print method overridden on Course print method
- * \param		: NONE
- * \return		: NONE
- */
-void BlockCourse::print () const
-{
-	std::cout << "Course Key: " << courseKey << std::endl << "Title: " << title << std::endl << "Major: " << majorById[major]
-								<< std::endl << "Credit Points: " << creditPoints << std::endl
-								<< "Duration - " << startDate.day() << "/" << startDate.month() << "/" << startDate.year()
-								<< " to " << endDate.day() << "/" << endDate.month() <<"/" << endDate.year() << std::endl
-								<< "Timings - " << startTime.hour() << ":" << startTime.minute()
-								<< " to " << endTime.hour() << ":" << endTime.minute() << std::endl;
-}
-
 /**
  * \brief		: Virtual write method overridden on Course write method
  * \param		: std::ostream& out - output stream object
@@ -53,7 +38,60 @@ void BlockCourse::write(std::ostream &out) const
 	out << "B;";
 	Course::write (out);
 	out << startDate.day() << "." << startDate.month() << "." << startDate.year() << ";"
-		<< endDate.day() << "." << endDate.month() << "." << endDate.year() << std::endl;
+		<< endDate.day() << "." << endDate.month() << "." << endDate.year() << ";"
+		<< startTime.hour() << ":" << startTime.minute() << ";"
+		<< endTime.hour() << ":" << endTime.minute() << std::endl;
+}
+
+/**
+ * \brief		: Getter method for the start date
+ * \param		: NONE
+ * \return		: const Poco::Data::Date& - start date
+ */
+const Poco::Data::Date& BlockCourse::getStartDate () const
+{
+	return startDate;
+}
+
+/**
+ * \brief		: Getter method for the end date
+ * \param		: NONE
+ * \return		: const Poco::Data::Date& - end date
+ */
+const Poco::Data::Date& BlockCourse::getEndDate () const
+{
+	return endDate;
+}
+
+/**
+ * \brief		: Getter method for the daily start time
+ * \param		: NONE
+ * \return		: const Poco::Data::Time& - start time
+ */
+const Poco::Data::Time& BlockCourse::getStartTime () const
+{
+	return startTime;
+}
+
+/**
+ * \brief		: Getter method for the daily end time
+ * \param		: NONE
+ * \return		: const Poco::Data::Time& - end time
+ */
+const Poco::Data::Time& BlockCourse::getEndTime () const
+{
+	return endTime;
+}
+
+/**
+ * \brief		: Method to add the course object and its title to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets them as COURSES
+ * \return		: NONE
+ */
+void BlockCourse::reportMemory(MemoryReport &report) const
+{
+	report.addBlock(MemoryReport::COURSES, sizeof(BlockCourse), sizeof(BlockCourse));
+	Course::reportMemory(report);
 }
 
 /*
@@ -55,18 +55,46 @@ public:
 				Poco::Data::Date startDate, Poco::Data::Date endDate, Poco::Data::Time startTime, Poco::Data::Time endTime);
 
 	/**
-	 * \brief		: Virtual print method overridden on Course print method
-	 * \param		: NONE
+	 * \brief		: Virtual write method overridden on Course write method
+	 * \param		: std::ostream& out - output stream object
 	 * \return		: NONE
 	 */
-	virtual void print () const override;
+	virtual void write (std::ostream& out) const override;
 
 	/**
-	 * \brief		: Virtual write method overridden on Course write method
-	 * \param		: std::ostream& out - output stream object
+	 * \brief		: Getter method for the start date
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Date& - start date
+	 */
+	const Poco::Data::Date& getStartDate () const;
+
+	/**
+	 * \brief		: Getter method for the end date
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Date& - end date
+	 */
+	const Poco::Data::Date& getEndDate () const;
+
+	/**
+	 * \brief		: Getter method for the daily start time
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Time& - start time
+	 */
+	const Poco::Data::Time& getStartTime () const;
+
+	/**
+	 * \brief		: Getter method for the daily end time
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Time& - end time
+	 */
+	const Poco::Data::Time& getEndTime () const;
+
+	/**
+	 * \brief		: Method to add the course object and its title to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets them as COURSES
 	 * \return		: NONE
 	 */
-	virtual void write (std::ostream& out) const override;
+	virtual void reportMemory (MemoryReport &report) const override;
 
 	/*
 	 * \brief		: Destructor
@@ -0,0 +1,108 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file BoundedHeap.h
+ *	\brief Header file for BoundedHeap class template
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef BOUNDEDHEAP_H_
+#define BOUNDEDHEAP_H_
+
+//! System Includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * \brief		: The best values pushed so far, at most a fixed number of them
+ * \details		: A heap whose top is the worst value kept. A new value replaces the top
+ *				  if it is better, so pushing n values costs O(n log k) and never holds more
+ *				  than k of them. Heaps filled by several threads are merged at the end.
+ * \tparam		: T - value type
+ * \tparam		: Better - Better(a, b) is true if a ranks before b
+ */
+template <typename T, typename Better = std::less<T>>
+class BoundedHeap
+{
+private:
+
+	std::size_t capacity;
+	std::vector<T> values;
+	Better better;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: std::size_t capacity - number of values kept at most
+	 * \param[IN]	: Better better - ranking of the values
+	 */
+	explicit BoundedHeap(std::size_t capacity, Better better = Better())
+		: capacity{capacity}, better{better}
+	{
+		values.reserve(std::min<std::size_t>(capacity, 1024));
+	}
+
+	/**
+	 * \brief		: Method to offer a value
+	 * \param[IN]	: const T &value - value, kept if it is among the best ones so far
+	 * \return		: NONE
+	 */
+	void push(const T &value)
+	{
+		if (values.size() < capacity)
+		{
+			values.push_back(value);
+			std::push_heap(values.begin(), values.end(), better);
+		}
+		else if (capacity > 0 && better(value, values.front()))
+		{
+			std::pop_heap(values.begin(), values.end(), better);
+			values.back() = value;
+			std::push_heap(values.begin(), values.end(), better);
+		}
+	}
+
+	/**
+	 * \brief		: Method to offer all values of another heap
+	 * \param[IN]	: const BoundedHeap &other - heap with the same ranking
+	 * \return		: NONE
+	 */
+	void merge(const BoundedHeap &other)
+	{
+		for (const T &value: other.values)
+		{
+			push(value);
+		}
+	}
+
+	/**
+	 * \brief		: Method to get the number of values kept
+	 * \param		: NONE
+	 * \return		: std::size_t - at most the capacity
+	 */
+	std::size_t size() const
+	{
+		return values.size();
+	}
+
+	/**
+	 * \brief		: Method to take the values out of the heap, which is empty afterwards
+	 * \param		: NONE
+	 * \return		: std::vector<T> - best value first
+	 */
+	std::vector<T> take()
+	{
+		std::sort_heap(values.begin(), values.end(), better);
+		std::vector<T> sorted;
+		sorted.swap(values);
+		return sorted;
+	}
+};
+
+#endif /* BOUNDEDHEAP_H_ */
@@ -48,6 +48,37 @@ std::string Course::getTitle() const
 	return title;
 }
 
+/**
+ * \brief		: Getter method for the first character of the major
+ * \param		: NONE
+ * \return		: unsigned char - major
+ */
+unsigned char Course::getMajor() const
+{
+	return major;
+}
+
+/**
+ * \brief		: Getter method for the name of the major
+ * \param		: NONE
+ * \return		: std::string - major name, empty if the major is unknown
+ */
+std::string Course::getMajorName() const
+{
+	auto majorName = majorById.find(major);
+	return majorName != majorById.end() ? majorName->second : std::string();
+}
+
+/**
+ * \brief		: Getter method for credit points
+ * \param		: NONE
+ * \return		: float - credit points
+ */
+float Course::getCreditPoints() const
+{
+	return creditPoints;
+}
+
 /**
  * \brief		: Virtual write method overridden on Course write method
  * \param		: std::ostream& out - output stream object
@@ -58,6 +89,17 @@ void Course::write(std::ostream &out) const
 	out << courseKey << ";" << title << ";" << majorById[major] <<";" << creditPoints << ";";
 }
 
+/**
+ * \brief		: Method to add the course object and its title to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets them as COURSES
+ * \return		: NONE
+ */
+void Course::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::COURSES, 1);
+	report.addString(MemoryReport::COURSES, title);
+}
+
 /**
  * \brief		: Virtual destructor
  */
@@ -16,6 +16,9 @@
 #include <string>
 #include <map>
 
+//! User Includes
+#include "MemoryReport.h"
+
 class Course
 {
 protected:
@@ -66,11 +69,25 @@ public:
 	std::string getTitle() const;
 
 	/**
-	 * \brief		: Pure virtual print method (to be implemented in the inherited classes)
+	 * \brief		: Getter method for the first character of the major
 	 * \param		: NONE
-	 * \return		: NONE
+	 * \return		: unsigned char - major
+	 */
+	unsigned char getMajor() const;
+
+	/**
+	 * \brief		: Getter method for the name of the major
+	 * \param		: NONE
+	 * \return		: std::string - major name, empty if the major is unknown
+	 */
+	std::string getMajorName() const;
+
+	/**
+	 * \brief		: Getter method for credit points
+	 * \param		: NONE
+	 * \return		: float - credit points
 	 */
-	virtual void print () const = 0;
+	float getCreditPoints() const;
 
 	/**
 	 * \brief		: Virtual write method overridden on Course write method
@@ -79,6 +96,14 @@ public:
 	 */
 	virtual void write(std::ostream& out) const;
 
+	/**
+	 * \brief		: Method to add the course object and its title to a memory report
+	 * \details		: The derived classes add the object, of their own size
+	 * \param[IN]	: MemoryReport &report - report, gets them as COURSES
+	 * \return		: NONE
+	 */
+	virtual void reportMemory(MemoryReport &report) const;
+
 	/**
 	 * \brief		: Virtual destructor
 	 */
@@ -0,0 +1,153 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseGradeStatistics.cpp
+ *	\brief Source file for CourseGradeStatistics class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+//! User Includes
+#include "CourseGradeStatistics.h"
+
+namespace
+{
+	long long toHundredths(float value)
+	{
+		return std::llround(value * 100.0);
+	}
+
+	//! Upper end of each bucket but the last, halfway to the next grade of the scale
+	const long long bucketLimits[CourseGradeStatistics::bucketCount - 1] =
+		{115, 150, 185, 215, 250, 285, 315, 350, 385, 450};
+}
+
+const std::array<float, CourseGradeStatistics::bucketCount> CourseGradeStatistics::bucketGrades =
+	{{1.0f, 1.3f, 1.7f, 2.0f, 2.3f, 2.7f, 3.0f, 3.3f, 3.7f, 4.0f, 5.0f}};
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+CourseGradeStatistics::CourseGradeStatistics()
+	: count{0}, sum{0}, sumOfSquares{0}, histogram{}
+{
+}
+
+/**
+ * \brief		: Method to add a grade
+ * \param[IN]	: float grade - grade, 0 (not graded) is ignored
+ * \return		: NONE
+ */
+void CourseGradeStatistics::addGrade(float grade)
+{
+	long long hundredths = toHundredths(grade);
+	if (hundredths <= 0)
+	{
+		return;
+	}
+
+	gradeCounts[hundredths]++;
+	count++;
+	sum += hundredths;
+	sumOfSquares += hundredths * hundredths;
+	histogram[bucketOf(hundredths)]++;
+}
+
+/**
+ * \brief		: Method to remove a grade added before
+ * \param[IN]	: float grade - grade, 0 (not graded) is ignored
+ * \return		: NONE
+ */
+void CourseGradeStatistics::removeGrade(float grade)
+{
+	long long hundredths = toHundredths(grade);
+	auto gradeCount = gradeCounts.find(hundredths);
+	if (hundredths <= 0 || gradeCount == gradeCounts.end())
+	{
+		return;
+	}
+
+	if (--gradeCount->second == 0)
+	{
+		gradeCounts.erase(gradeCount);
+	}
+	count--;
+	sum -= hundredths;
+	sumOfSquares -= hundredths * hundredths;
+	histogram[bucketOf(hundredths)]--;
+}
+
+/**
+ * \brief		: Getter methods for the statistics, all 0 if no grade is given
+ */
+std::size_t CourseGradeStatistics::getCount() const
+{
+	return count;
+}
+
+float CourseGradeStatistics::getMean() const
+{
+	return count == 0 ? 0 : static_cast<float>(static_cast<double>(sum) / count / 100.0);
+}
+
+float CourseGradeStatistics::getVariance() const
+{
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	//! Population variance, n * sum(x^2) - sum(x)^2 in 128 bits is exact, the products outgrow a double
+	__int128 spread = static_cast<__int128>(count) * sumOfSquares - static_cast<__int128>(sum) * sum;
+	return static_cast<float>(static_cast<double>(spread) / (static_cast<double>(count) * count) / 10000.0);
+}
+
+float CourseGradeStatistics::getMinimum() const
+{
+	return gradeCounts.empty() ? 0 : gradeCounts.begin()->first / 100.0f;
+}
+
+float CourseGradeStatistics::getMaximum() const
+{
+	return gradeCounts.empty() ? 0 : gradeCounts.rbegin()->first / 100.0f;
+}
+
+/**
+ * \brief		: Getter method for the histogram
+ * \param		: NONE
+ * \return		: const std::array<std::size_t, bucketCount>& - number of grades per bucket, see bucketGrades
+ */
+const std::array<std::size_t, CourseGradeStatistics::bucketCount>& CourseGradeStatistics::getHistogram() const
+{
+	return histogram;
+}
+
+/**
+ * \brief		: Helper method to find the bucket of a grade, the bucket of the closest grade of the scale
+ * \param[IN]	: long long grade - grade in hundredths
+ * \return		: std::size_t - bucket
+ */
+std::size_t CourseGradeStatistics::bucketOf(long long grade)
+{
+	return std::upper_bound(std::begin(bucketLimits), std::end(bucketLimits), grade) - std::begin(bucketLimits);
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the statistics to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the grade counts as COURSE_STATISTICS
+ * \return		: NONE
+ */
+void CourseGradeStatistics::reportMemory(MemoryReport &report) const
+{
+	report.addTreeNodes(MemoryReport::COURSE_STATISTICS, gradeCounts);
+}
@@ -0,0 +1,116 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseGradeStatistics.h
+ *	\brief Header file for CourseGradeStatistics class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef COURSEGRADESTATISTICS_H_
+#define COURSEGRADESTATISTICS_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <map>
+
+//! User Includes
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Live statistics of the grades given in one course
+ * \details		: Grades are counted in hundredths, so sum and sum of squares are exact
+ *				  integers and a grade can be removed again without rounding drift. Mean
+ *				  and variance follow from the two sums, minimum and maximum from the
+ *				  ordered counts of the distinct grades. Every update costs O(log d) for
+ *				  d distinct grades (a dozen in practice), every query O(1).
+ */
+class CourseGradeStatistics
+{
+public:
+
+	/**
+	 * \brief		: Number of histogram buckets, one per grade of the German scale
+	 */
+	static constexpr std::size_t bucketCount = 11;
+
+	/**
+	 * \brief		: Grade of each bucket: 1.0, 1.3, 1.7, 2.0, 2.3, 2.7, 3.0, 3.3, 3.7, 4.0, 5.0
+	 */
+	static const std::array<float, bucketCount> bucketGrades;
+
+private:
+
+	/**
+	 * \brief		: Number of enrollments with each grade, in hundredths
+	 */
+	std::map<long long, std::size_t> gradeCounts;
+
+	/**
+	 * \brief		: Number, sum and sum of squares of the grades, in hundredths
+	 */
+	std::size_t count;
+	long long sum;
+	long long sumOfSquares;
+
+	/**
+	 * \brief		: Number of grades per bucket
+	 */
+	std::array<std::size_t, bucketCount> histogram;
+
+	/**
+	 * \brief		: Helper method to find the bucket of a grade, the bucket of the closest grade of the scale
+	 * \param[IN]	: long long grade - grade in hundredths
+	 * \return		: std::size_t - bucket
+	 */
+	static std::size_t bucketOf(long long grade);
+
+public:
+
+	/**
+	 * \brief		: Constructor
+	 */
+	CourseGradeStatistics();
+
+	/**
+	 * \brief		: Method to add a grade
+	 * \param[IN]	: float grade - grade, 0 (not graded) is ignored
+	 * \return		: NONE
+	 */
+	void addGrade(float grade);
+
+	/**
+	 * \brief		: Method to remove a grade added before
+	 * \param[IN]	: float grade - grade, 0 (not graded) is ignored
+	 * \return		: NONE
+	 */
+	void removeGrade(float grade);
+
+	/**
+	 * \brief		: Getter methods for the statistics, all 0 if no grade is given
+	 */
+	std::size_t getCount() const;
+	float getMean() const;
+	float getVariance() const;
+	float getMinimum() const;
+	float getMaximum() const;
+
+	/**
+	 * \brief		: Getter method for the histogram
+	 * \param		: NONE
+	 * \return		: const std::array<std::size_t, bucketCount>& - number of grades per bucket, see bucketGrades
+	 */
+	const std::array<std::size_t, bucketCount>& getHistogram() const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the statistics to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the grade counts as COURSE_STATISTICS
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* COURSEGRADESTATISTICS_H_ */
@@ -0,0 +1,302 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseScheduleIndex.cpp
+ *	\brief Source file for CourseScheduleIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+
+//! User Includes
+#include "CourseScheduleIndex.h"
+#include "WeeklyCourse.h"
+#include "BlockCourse.h"
+
+namespace
+{
+	const unsigned int minutesPerDay = 24 * 60;
+	const long daysPerWeek = 7;
+
+	unsigned int minuteOfDay(const Poco::Data::Time &time)
+	{
+		return time.hour() * 60 + time.minute();
+	}
+
+	/**
+	 * \brief		: Days since 1.1.1970 of a date of the proleptic Gregorian calendar
+	 */
+	long dayNumber(const Poco::Data::Date &date)
+	{
+		long year = date.year() - (date.month() <= 2 ? 1 : 0);
+		long era = (year >= 0 ? year : year - 399) / 400;
+		long yearOfEra = year - era * 400;
+		long dayOfYear = (153 * (date.month() + (date.month() > 2 ? -3 : 9)) + 2) / 5 + date.day() - 1;
+		long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+		return era * 146097 + dayOfEra - 719468;
+	}
+
+	/**
+	 * \brief		: Weekday of a day number, counted like Poco::DateTime::DaysOfWeek (Sunday = 0)
+	 */
+	unsigned int weekdayOf(long day)
+	{
+		//! 1.1.1970 was a Thursday
+		return static_cast<unsigned int>(((day + 4) % daysPerWeek + daysPerWeek) % daysPerWeek);
+	}
+
+	/**
+	 * \brief		: True if both are block courses whose date ranges do not share a day
+	 */
+	bool areDisjointBlocks(const Course &first, const Course &second)
+	{
+		const BlockCourse *firstBlock = dynamic_cast<const BlockCourse*>(&first);
+		const BlockCourse *secondBlock = dynamic_cast<const BlockCourse*>(&second);
+
+		return firstBlock != nullptr && secondBlock != nullptr
+			&& (dayNumber(firstBlock->getEndDate()) < dayNumber(secondBlock->getStartDate())
+				|| dayNumber(secondBlock->getEndDate()) < dayNumber(firstBlock->getStartDate()));
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to add a course
+ * \param[IN]	: const Course &course - course, has to outlive the index
+ * \return		: NONE
+ */
+void CourseScheduleIndex::addCourse(const Course &course)
+{
+	if (bulkLoading)
+	{
+		for (const Interval &interval: intervalsOf(course))
+		{
+			intervals.push_back(interval);
+		}
+		return;
+	}
+
+	for (const Interval &interval: intervalsOf(course))
+	{
+		intervals.insert(std::upper_bound(intervals.begin(), intervals.end(), interval,
+										  [](const Interval &left, const Interval &right) { return left.begin < right.begin; }),
+						 interval);
+	}
+
+	maxEnds.assign(intervals.size(), 0);
+	buildMaxEnds(0, intervals.size());
+}
+
+/**
+ * \brief		: Method to defer the ordering of the intervals while many courses are added
+ * \param		: NONE
+ * \return		: NONE
+ */
+void CourseScheduleIndex::beginBulkLoad()
+{
+	bulkLoading = true;
+}
+
+/**
+ * \brief		: Method to order the intervals added since beginBulkLoad and build the subtree maxima
+ * \param		: NONE
+ * \return		: NONE
+ */
+void CourseScheduleIndex::endBulkLoad()
+{
+	bulkLoading = false;
+
+	//! Stable, intervals of equal begin stay in the order of their addition as with addCourse
+	std::stable_sort(intervals.begin(), intervals.end(),
+					 [](const Interval &left, const Interval &right) { return left.begin < right.begin; });
+	maxEnds.assign(intervals.size(), 0);
+	buildMaxEnds(0, intervals.size());
+}
+
+/**
+ * \brief		: Method to remove all courses, ends a bulk load
+ * \param		: NONE
+ * \return		: NONE
+ */
+void CourseScheduleIndex::clear()
+{
+	intervals.clear();
+	maxEnds.clear();
+	bulkLoading = false;
+}
+
+/**
+ * \brief		: Method to find the courses meeting at the same time as a course
+ * \param[IN]	: const Course &course - weekly or block course
+ * \return		: std::vector<unsigned int> - course keys in ascending order, without the course itself
+ */
+std::vector<unsigned int> CourseScheduleIndex::findConflictingCourses(const Course &course) const
+{
+	std::vector<const Course*> overlapping;
+	for (const Interval &interval: intervalsOf(course))
+	{
+		findOverlapping(0, intervals.size(), interval.begin, interval.end, overlapping);
+	}
+
+	std::vector<unsigned int> courseKeys;
+	for (const Course *other: overlapping)
+	{
+		if (other->getCourseKey() != course.getCourseKey() && !areDisjointBlocks(course, *other))
+		{
+			courseKeys.push_back(other->getCourseKey());
+		}
+	}
+	std::sort(courseKeys.begin(), courseKeys.end());
+	courseKeys.erase(std::unique(courseKeys.begin(), courseKeys.end()), courseKeys.end());
+
+	return courseKeys;
+}
+
+/**
+ * \brief		: Method to check whether two courses meet at the same time
+ * \param[IN]	: const Course &first - weekly or block course
+ * \param[IN]	: const Course &second - weekly or block course
+ * \return		: bool - true if they share a weekday (and a date for two block courses) with overlapping times
+ */
+bool CourseScheduleIndex::isConflicting(const Course &first, const Course &second)
+{
+	if (areDisjointBlocks(first, second))
+	{
+		return false;
+	}
+
+	std::vector<Interval> secondIntervals = intervalsOf(second);
+	for (const Interval &interval: intervalsOf(first))
+	{
+		for (const Interval &other: secondIntervals)
+		{
+			if (interval.begin < other.end && other.begin < interval.end)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief		: Helper method to compute maxEnds of an index range
+ * \param[IN]	: std::size_t first - first index of the range
+ * \param[IN]	: std::size_t end - index after the range
+ * \return		: unsigned int - largest end of the range, 0 if it is empty
+ */
+unsigned int CourseScheduleIndex::buildMaxEnds(std::size_t first, std::size_t end)
+{
+	if (first >= end)
+	{
+		return 0;
+	}
+
+	std::size_t middle = first + (end - first) / 2;
+	maxEnds[middle] = std::max({intervals[middle].end, buildMaxEnds(first, middle), buildMaxEnds(middle + 1, end)});
+	return maxEnds[middle];
+}
+
+/**
+ * \brief		: Helper method to collect the courses with an interval overlapping [begin, end)
+ * \param[IN]	: std::size_t first - first index of the subtree
+ * \param[IN]	: std::size_t last - index after the subtree
+ * \param[IN]	: unsigned int begin - first minute of the query
+ * \param[IN]	: unsigned int end - minute after the query
+ * \param[OUT]	: std::vector<const Course*> &courses - courses found, may repeat
+ * \return		: NONE
+ */
+void CourseScheduleIndex::findOverlapping(std::size_t first, std::size_t last, unsigned int begin, unsigned int end,
+										  std::vector<const Course*> &courses) const
+{
+	if (first >= last)
+	{
+		return;
+	}
+
+	//! Nothing in the subtree reaches the query
+	std::size_t middle = first + (last - first) / 2;
+	if (maxEnds[middle] <= begin)
+	{
+		return;
+	}
+
+	findOverlapping(first, middle, begin, end, courses);
+	if (intervals[middle].begin < end)
+	{
+		if (begin < intervals[middle].end)
+		{
+			courses.push_back(intervals[middle].course);
+		}
+		//! The right subtree starts no earlier than the middle
+		findOverlapping(middle + 1, last, begin, end, courses);
+	}
+}
+
+/**
+ * \brief		: Helper method to get the intervals of a course on the week
+ * \param[IN]	: const Course &course - weekly or block course
+ * \return		: std::vector<Interval> - one per meeting day, empty for an unknown course type
+ */
+std::vector<CourseScheduleIndex::Interval> CourseScheduleIndex::intervalsOf(const Course &course)
+{
+	std::vector<Interval> courseIntervals;
+	for (const auto &minutes: getWeekMinutes(course))
+	{
+		courseIntervals.push_back(Interval{minutes.first, minutes.second, &course});
+	}
+	return courseIntervals;
+}
+
+/**
+ * \brief		: Method to get the meeting times of a course on the week
+ * \param[IN]	: const Course &course - weekly or block course
+ * \return		: std::vector<std::pair<unsigned int, unsigned int>> - [begin, end) in minutes from Sunday 0:00,
+ *				  one per meeting day, empty for an unknown course type
+ */
+std::vector<std::pair<unsigned int, unsigned int>> CourseScheduleIndex::getWeekMinutes(const Course &course)
+{
+	std::vector<std::pair<unsigned int, unsigned int>> weekMinutes;
+
+	if (const WeeklyCourse *weekly = dynamic_cast<const WeeklyCourse*>(&course))
+	{
+		unsigned int start = minuteOfDay(weekly->getStartTime()), end = minuteOfDay(weekly->getEndTime());
+		if (start < end)
+		{
+			unsigned int day = static_cast<unsigned int>(weekly->getDayOfWeek()) * minutesPerDay;
+			weekMinutes.push_back(std::make_pair(day + start, day + end));
+		}
+	}
+	else if (const BlockCourse *block = dynamic_cast<const BlockCourse*>(&course))
+	{
+		unsigned int start = minuteOfDay(block->getStartTime()), end = minuteOfDay(block->getEndTime());
+		long firstDay = dayNumber(block->getStartDate()), lastDay = dayNumber(block->getEndDate());
+
+		//! A block of a week or longer meets on every weekday
+		for (long day = firstDay; start < end && day <= lastDay && day < firstDay + daysPerWeek; day++)
+		{
+			unsigned int weekday = weekdayOf(day) * minutesPerDay;
+			weekMinutes.push_back(std::make_pair(weekday + start, weekday + end));
+		}
+	}
+
+	return weekMinutes;
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the intervals as SCHEDULE_INDEX
+ * \return		: NONE
+ */
+void CourseScheduleIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::SCHEDULE_INDEX, intervals.size());
+	report.addVector(MemoryReport::SCHEDULE_INDEX, intervals);
+	report.addVector(MemoryReport::SCHEDULE_INDEX, maxEnds);
+}
@@ -0,0 +1,166 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseScheduleIndex.h
+ *	\brief Header file for CourseScheduleIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef COURSESCHEDULEINDEX_H_
+#define COURSESCHEDULEINDEX_H_
+
+//! System Includes
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "Course.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Two enrollments of a student whose courses meet at the same time
+ */
+struct ScheduleConflict
+{
+	unsigned int matrikelNumber;
+	unsigned int firstCourseKey;		//!< smaller course key of the two
+	unsigned int secondCourseKey;
+};
+
+/**
+ * \brief		: Interval tree of the meeting times of all courses
+ * \details		: Every course is mapped onto the minutes of a week: a weekly course is one
+ *				  interval on its day, a block course one interval per weekday its date range
+ *				  covers. The intervals are kept sorted by start in an implicit balanced tree
+ *				  that stores the largest end of every subtree, so the courses meeting at a
+ *				  given time are found in O(log n + k). Two intervals on the week overlap
+ *				  exactly when the courses meet on the same weekday at the same time; two
+ *				  block courses must in addition share a date.
+ *
+ *				  A single addition inserts into the sorted intervals and updates the subtree
+ *				  maxima in O(n). Between beginBulkLoad and endBulkLoad additions are only
+ *				  appended, and the intervals are sorted and the maxima built once at the end.
+ */
+class CourseScheduleIndex
+{
+private:
+
+	/**
+	 * \brief		: Interval of a course on the week, in minutes from Sunday 0:00
+	 */
+	struct Interval
+	{
+		unsigned int begin;
+		unsigned int end;				//!< first minute after the interval
+		const Course *course;
+	};
+
+	/**
+	 * \brief		: Intervals ordered by begin, the middle of every index range is the root of the range
+	 */
+	std::vector<Interval> intervals;
+
+	/**
+	 * \brief		: Largest end in the subtree of every interval
+	 */
+	std::vector<unsigned int> maxEnds;
+
+	/**
+	 * \brief		: Set between beginBulkLoad and endBulkLoad, the intervals are not ordered yet
+	 */
+	bool bulkLoading = false;
+
+	/**
+	 * \brief		: Helper method to compute maxEnds of an index range
+	 * \param[IN]	: std::size_t first - first index of the range
+	 * \param[IN]	: std::size_t end - index after the range
+	 * \return		: unsigned int - largest end of the range, 0 if it is empty
+	 */
+	unsigned int buildMaxEnds(std::size_t first, std::size_t end);
+
+	/**
+	 * \brief		: Helper method to collect the courses with an interval overlapping [begin, end)
+	 * \param[IN]	: std::size_t first - first index of the subtree
+	 * \param[IN]	: std::size_t last - index after the subtree
+	 * \param[IN]	: unsigned int begin - first minute of the query
+	 * \param[IN]	: unsigned int end - minute after the query
+	 * \param[OUT]	: std::vector<const Course*> &courses - courses found, may repeat
+	 * \return		: NONE
+	 */
+	void findOverlapping(std::size_t first, std::size_t last, unsigned int begin, unsigned int end,
+						 std::vector<const Course*> &courses) const;
+
+	/**
+	 * \brief		: Helper method to get the intervals of a course on the week
+	 * \param[IN]	: const Course &course - weekly or block course
+	 * \return		: std::vector<Interval> - one per meeting day, empty for an unknown course type
+	 */
+	static std::vector<Interval> intervalsOf(const Course &course);
+
+public:
+
+	/**
+	 * \brief		: Method to add a course
+	 * \param[IN]	: const Course &course - course, has to outlive the index
+	 * \return		: NONE
+	 */
+	void addCourse(const Course &course);
+
+	/**
+	 * \brief		: Method to defer the ordering of the intervals while many courses are added
+	 * \details		: The index must not be queried before endBulkLoad
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void beginBulkLoad();
+
+	/**
+	 * \brief		: Method to order the intervals added since beginBulkLoad and build the subtree maxima
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void endBulkLoad();
+
+	/**
+	 * \brief		: Method to remove all courses, ends a bulk load
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the courses meeting at the same time as a course
+	 * \param[IN]	: const Course &course - weekly or block course
+	 * \return		: std::vector<unsigned int> - course keys in ascending order, without the course itself
+	 */
+	std::vector<unsigned int> findConflictingCourses(const Course &course) const;
+
+	/**
+	 * \brief		: Method to check whether two courses meet at the same time
+	 * \param[IN]	: const Course &first - weekly or block course
+	 * \param[IN]	: const Course &second - weekly or block course
+	 * \return		: bool - true if they share a weekday (and a date for two block courses) with overlapping times
+	 */
+	static bool isConflicting(const Course &first, const Course &second);
+
+	/**
+	 * \brief		: Method to get the meeting times of a course on the week
+	 * \param[IN]	: const Course &course - weekly or block course
+	 * \return		: std::vector<std::pair<unsigned int, unsigned int>> - [begin, end) in minutes from Sunday 0:00,
+	 *				  one per meeting day, empty for an unknown course type
+	 */
+	static std::vector<std::pair<unsigned int, unsigned int>> getWeekMinutes(const Course &course);
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the intervals as SCHEDULE_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* COURSESCHEDULEINDEX_H_ */
@@ -0,0 +1,159 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseSlotFinder.cpp
+ *	\brief Source file for CourseSlotFinder class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <utility>
+
+//! User Includes
+#include "CourseSlotFinder.h"
+
+namespace
+{
+	const unsigned int minutesPerDay = 24 * 60;
+
+	Poco::Data::Time timeOf(unsigned int minute)
+	{
+		return Poco::Data::Time(minute / 60, minute % 60, 0);
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: const StudentDb &studentDb - database, the caller holds its shared lock
+ * \param[IN]	: const std::vector<unsigned int> &matrikelNumbers - cohort, unknown students are skipped
+ * \param[IN]	: const std::string &semester - semester whose enrollments occupy the week
+ */
+CourseSlotFinder::CourseSlotFinder(const StudentDb &studentDb, const std::vector<unsigned int> &matrikelNumbers,
+								   const std::string &semester)
+	: studentCount{0}
+{
+	for (std::vector<std::uint64_t> &column: columns)
+	{
+		column.reserve(matrikelNumbers.size());
+	}
+
+	for (unsigned int matrikelNumber: matrikelNumbers)
+	{
+		if (studentDb.getStudents().count(matrikelNumber) == 0)
+		{
+			continue;
+		}
+
+		WeekOccupancy occupancy = studentDb.getWeekOccupancy(matrikelNumber, semester);
+		for (std::size_t word = 0; word < WeekOccupancy::wordCount; word++)
+		{
+			columns[word].push_back(occupancy.getWords()[word]);
+		}
+		studentCount++;
+	}
+}
+
+/**
+ * \brief		: Getter method for the number of students in the cohort
+ * \param		: NONE
+ * \return		: std::size_t - number of students
+ */
+std::size_t CourseSlotFinder::getStudentCount() const
+{
+	return studentCount;
+}
+
+/**
+ * \brief		: Method to score one candidate slot
+ * \param[IN]	: Poco::DateTime::DaysOfWeek dayOfWeek - day of the course
+ * \param[IN]	: unsigned int startMinute - start in minutes after midnight
+ * \param[IN]	: unsigned int durationMinutes - length of the course, the slot ends at midnight at the latest
+ * \return		: SlotScore - clashes of the slot
+ */
+SlotScore CourseSlotFinder::scoreSlot(Poco::DateTime::DaysOfWeek dayOfWeek, unsigned int startMinute,
+									  unsigned int durationMinutes) const
+{
+	unsigned int endMinute = std::min(minutesPerDay, startMinute + durationMinutes);
+	SlotScore score {dayOfWeek, timeOf(startMinute), timeOf(endMinute % minutesPerDay), 0, 0};
+
+	WeekOccupancy slot;
+	unsigned int day = static_cast<unsigned int>(dayOfWeek) * minutesPerDay;
+	slot.addMinutes(day + startMinute, day + endMinute);
+
+	//! Only the words the slot touches, one or two for any course of a few hours
+	std::vector<std::pair<const std::uint64_t*, std::uint64_t>> masks;
+	for (std::size_t word = 0; word < WeekOccupancy::wordCount; word++)
+	{
+		if (slot.getWords()[word] != 0)
+		{
+			masks.push_back(std::make_pair(columns[word].data(), slot.getWords()[word]));
+		}
+	}
+
+	for (std::size_t student = 0; student < studentCount; student++)
+	{
+		std::uint64_t clashes = 0;
+		for (const auto &mask: masks)
+		{
+			std::uint64_t busy = mask.first[student] & mask.second;
+			clashes |= busy;
+			score.clashingSlots += __builtin_popcountll(busy);
+		}
+		score.clashingStudents += clashes != 0;
+	}
+
+	return score;
+}
+
+/**
+ * \brief		: Method to rank every quarter hour start of a course on the week days
+ * \param[IN]	: unsigned int durationMinutes - length of the course
+ * \param[IN]	: std::size_t maxSlots - number of slots to return at most
+ * \param[IN]	: unsigned int firstMinute - earliest start, minutes after midnight
+ * \param[IN]	: unsigned int lastMinute - latest end, minutes after midnight
+ * \param[IN]	: bool includeWeekend - true to consider Saturday and Sunday as well
+ * \return		: std::vector<SlotScore> - fewest clashing students first, then fewest busy quarter hours,
+ *				  then earliest in the week from Monday
+ */
+std::vector<SlotScore> CourseSlotFinder::rankSlots(unsigned int durationMinutes, std::size_t maxSlots,
+												   unsigned int firstMinute, unsigned int lastMinute,
+												   bool includeWeekend) const
+{
+	const Poco::DateTime::DaysOfWeek days[] = {Poco::DateTime::MONDAY, Poco::DateTime::TUESDAY, Poco::DateTime::WEDNESDAY,
+											   Poco::DateTime::THURSDAY, Poco::DateTime::FRIDAY, Poco::DateTime::SATURDAY,
+											   Poco::DateTime::SUNDAY};
+	std::vector<SlotScore> slots;
+
+	//! Starts on the quarter hour grid
+	unsigned int firstStart = (firstMinute + WeekOccupancy::minutesPerSlot - 1) / WeekOccupancy::minutesPerSlot
+							  * WeekOccupancy::minutesPerSlot;
+	lastMinute = std::min(lastMinute, minutesPerDay);
+
+	for (std::size_t day = 0; day < (includeWeekend ? 7 : 5); day++)
+	{
+		for (unsigned int start = firstStart; durationMinutes > 0 && start + durationMinutes <= lastMinute;
+			 start += WeekOccupancy::minutesPerSlot)
+		{
+			slots.push_back(scoreSlot(days[day], start, durationMinutes));
+		}
+	}
+
+	//! Stable, so equal scores stay in week order
+	std::stable_sort(slots.begin(), slots.end(), [](const SlotScore &left, const SlotScore &right)
+	{
+		return left.clashingStudents != right.clashingStudents ? left.clashingStudents < right.clashingStudents
+															   : left.clashingSlots < right.clashingSlots;
+	});
+	if (slots.size() > maxSlots)
+	{
+		slots.resize(maxSlots);
+	}
+	return slots;
+}
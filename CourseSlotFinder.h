@@ -0,0 +1,105 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file CourseSlotFinder.h
+ *	\brief Header file for CourseSlotFinder class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef COURSESLOTFINDER_H_
+#define COURSESLOTFINDER_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Poco/DateTime.h>
+#include <Poco/Data/Time.h>
+
+//! User Includes
+#include "StudentDb.h"
+#include "WeekOccupancy.h"
+
+/**
+ * \brief		: Candidate time of a new weekly course and the clashes it would cause
+ */
+struct SlotScore
+{
+	Poco::DateTime::DaysOfWeek dayOfWeek;
+	Poco::Data::Time startTime;
+	Poco::Data::Time endTime;
+	std::size_t clashingStudents;		//!< students of the cohort busy during the slot
+	std::size_t clashingSlots;			//!< busy quarter hours of the cohort inside the slot
+};
+
+/**
+ * \brief		: Ranks the times of a proposed weekly course by the clashes for a cohort
+ * \details		: The WeekOccupancy of every student of the cohort is stored word by word,
+ *				  one array per word of the week. A candidate slot touches one or two
+ *				  words, so scoring it reads those arrays from front to back with an AND
+ *				  and a popcount per student, and all candidates of a week for thousands
+ *				  of students take a few milliseconds.
+ *
+ *				  The finder is a snapshot: build it under the shared lock of the database.
+ */
+class CourseSlotFinder
+{
+private:
+
+	/**
+	 * \brief		: Word w of the occupancy of every student, in cohort order
+	 */
+	std::array<std::vector<std::uint64_t>, WeekOccupancy::wordCount> columns;
+
+	/**
+	 * \brief		: Number of students in the cohort
+	 */
+	std::size_t studentCount;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: const StudentDb &studentDb - database, the caller holds its shared lock
+	 * \param[IN]	: const std::vector<unsigned int> &matrikelNumbers - cohort, unknown students are skipped
+	 * \param[IN]	: const std::string &semester - semester whose enrollments occupy the week
+	 */
+	CourseSlotFinder(const StudentDb &studentDb, const std::vector<unsigned int> &matrikelNumbers,
+					 const std::string &semester);
+
+	/**
+	 * \brief		: Getter method for the number of students in the cohort
+	 * \param		: NONE
+	 * \return		: std::size_t - number of students
+	 */
+	std::size_t getStudentCount() const;
+
+	/**
+	 * \brief		: Method to score one candidate slot
+	 * \param[IN]	: Poco::DateTime::DaysOfWeek dayOfWeek - day of the course
+	 * \param[IN]	: unsigned int startMinute - start in minutes after midnight
+	 * \param[IN]	: unsigned int durationMinutes - length of the course, the slot ends at midnight at the latest
+	 * \return		: SlotScore - clashes of the slot
+	 */
+	SlotScore scoreSlot(Poco::DateTime::DaysOfWeek dayOfWeek, unsigned int startMinute, unsigned int durationMinutes) const;
+
+	/**
+	 * \brief		: Method to rank every quarter hour start of a course on the week days
+	 * \param[IN]	: unsigned int durationMinutes - length of the course
+	 * \param[IN]	: std::size_t maxSlots - number of slots to return at most
+	 * \param[IN]	: unsigned int firstMinute - earliest start, minutes after midnight
+	 * \param[IN]	: unsigned int lastMinute - latest end, minutes after midnight
+	 * \param[IN]	: bool includeWeekend - true to consider Saturday and Sunday as well
+	 * \return		: std::vector<SlotScore> - fewest clashing students first, then fewest busy quarter hours,
+	 *				  then earliest in the week from Monday
+	 */
+	std::vector<SlotScore> rankSlots(unsigned int durationMinutes, std::size_t maxSlots, unsigned int firstMinute = 8 * 60,
+									 unsigned int lastMinute = 20 * 60, bool includeWeekend = false) const;
+};
+
+#endif /* COURSESLOTFINDER_H_ */
@@ -72,6 +72,16 @@ std::string Enrollment::getSemester () const
 	return semester;
 }
 
+/**
+ * \brief		: Method to add the heap blocks of the enrollment to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the semester as ENROLLMENT_VECTORS
+ * \return		: NONE
+ */
+void Enrollment::reportMemory(MemoryReport &report) const
+{
+	report.addString(MemoryReport::ENROLLMENT_VECTORS, semester);
+}
+
 /**
  * \brief		: Destructor
  */
@@ -17,6 +17,7 @@
 
 //! User Includes
 #include "Course.h"
+#include "MemoryReport.h"
 
 class Enrollment
 {
@@ -72,6 +73,13 @@ public:
 	 */
 	const Course& getCourse() const;
 
+	/**
+	 * \brief		: Method to add the heap blocks of the enrollment to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the semester as ENROLLMENT_VECTORS
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+
 	/**
 	 * \brief		: Destructor
 	 */
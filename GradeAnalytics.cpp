@@ -0,0 +1,378 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file GradeAnalytics.cpp
+ *	\brief Source file for GradeAnalytics class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <unordered_map>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GRADEANALYTICS_X86
+#endif
+
+//! User Includes
+#include "GradeAnalytics.h"
+
+namespace
+{
+	//! Rows per range handed to the thread pool
+	const std::size_t rowsPerRange = 64 * 1024;
+
+	//! Upper end of each histogram bucket but the last, as in CourseGradeStatistics
+	const float bucketLimits[CourseGradeStatistics::bucketCount - 1] =
+		{1.15f, 1.5f, 1.85f, 2.15f, 2.5f, 2.85f, 3.15f, 3.5f, 3.85f, 4.5f};
+
+	const float bestGrade = 1.0f;
+	const float passLimit = 4.0f;
+
+	std::size_t bucketOf(float grade)
+	{
+		return std::upper_bound(std::begin(bucketLimits), std::end(bucketLimits), grade) - std::begin(bucketLimits);
+	}
+
+	/**
+	 * \brief		: Adds one enrollment to an aggregate
+	 */
+	inline void addRow(float grade, float credit, GradeAggregate &aggregate)
+	{
+		aggregate.enrollments++;
+		if (grade > 0)
+		{
+			aggregate.graded++;
+			aggregate.passed += grade >= bestGrade && grade <= passLimit;
+			aggregate.weightedGradeSum += static_cast<double>(grade * credit);
+			aggregate.gradedCredits += credit;
+			aggregate.histogram[bucketOf(grade)]++;
+		}
+	}
+
+	/**
+	 * \brief		: Aggregates count rows of the grade and credit columns
+	 */
+	void aggregateScalar(const float *grades, const float *credits, std::size_t count, GradeAggregate &aggregate)
+	{
+		for (std::size_t row = 0; row < count; row++)
+		{
+			addRow(grades[row], credits[row], aggregate);
+		}
+	}
+
+#ifdef GRADEANALYTICS_X86
+	/**
+	 * \brief		: SSE2 version of aggregateScalar, four rows at a time
+	 */
+	__attribute__((target("sse2")))
+	void aggregateSse2(const float *grades, const float *credits, std::size_t count, GradeAggregate &aggregate)
+	{
+		const __m128 zero = _mm_setzero_ps(), best = _mm_set1_ps(bestGrade), worst = _mm_set1_ps(passLimit);
+		__m128d weighted = _mm_setzero_pd(), gradedCredits = _mm_setzero_pd();
+		alignas(16) int buckets[4];
+		std::size_t row = 0;
+
+		for (; row + 4 <= count; row += 4)
+		{
+			__m128 grade = _mm_loadu_ps(grades + row);
+			__m128 isGraded = _mm_cmpgt_ps(grade, zero);
+			__m128 isPassed = _mm_and_ps(_mm_cmpge_ps(grade, best), _mm_cmple_ps(grade, worst));
+			__m128 credit = _mm_and_ps(_mm_loadu_ps(credits + row), isGraded);
+			__m128 product = _mm_mul_ps(grade, credit);
+
+			weighted = _mm_add_pd(weighted, _mm_add_pd(_mm_cvtps_pd(product), _mm_cvtps_pd(_mm_movehl_ps(product, product))));
+			gradedCredits = _mm_add_pd(gradedCredits, _mm_add_pd(_mm_cvtps_pd(credit), _mm_cvtps_pd(_mm_movehl_ps(credit, credit))));
+
+			unsigned int gradedMask = _mm_movemask_ps(isGraded);
+			aggregate.graded += __builtin_popcount(gradedMask);
+			aggregate.passed += __builtin_popcount(_mm_movemask_ps(isPassed));
+
+			//! Bucket = number of limits not above the grade, each true compare is -1
+			__m128i bucket = _mm_setzero_si128();
+			for (float limit: bucketLimits)
+			{
+				bucket = _mm_sub_epi32(bucket, _mm_castps_si128(_mm_cmpge_ps(grade, _mm_set1_ps(limit))));
+			}
+			_mm_store_si128(reinterpret_cast<__m128i*>(buckets), bucket);
+			for (; gradedMask != 0; gradedMask &= gradedMask - 1)
+			{
+				aggregate.histogram[buckets[__builtin_ctz(gradedMask)]]++;
+			}
+		}
+
+		alignas(16) double sums[2];
+		_mm_store_pd(sums, weighted);
+		aggregate.weightedGradeSum += sums[0] + sums[1];
+		_mm_store_pd(sums, gradedCredits);
+		aggregate.gradedCredits += sums[0] + sums[1];
+		aggregate.enrollments += row;
+
+		aggregateScalar(grades + row, credits + row, count - row, aggregate);
+	}
+
+	/**
+	 * \brief		: AVX2 version of aggregateScalar, eight rows at a time
+	 */
+	__attribute__((target("avx2")))
+	void aggregateAvx2(const float *grades, const float *credits, std::size_t count, GradeAggregate &aggregate)
+	{
+		const __m256 zero = _mm256_setzero_ps(), best = _mm256_set1_ps(bestGrade), worst = _mm256_set1_ps(passLimit);
+		__m256d weighted = _mm256_setzero_pd(), gradedCredits = _mm256_setzero_pd();
+		alignas(32) int buckets[8];
+		std::size_t row = 0;
+
+		for (; row + 8 <= count; row += 8)
+		{
+			__m256 grade = _mm256_loadu_ps(grades + row);
+			__m256 isGraded = _mm256_cmp_ps(grade, zero, _CMP_GT_OQ);
+			__m256 isPassed = _mm256_and_ps(_mm256_cmp_ps(grade, best, _CMP_GE_OQ), _mm256_cmp_ps(grade, worst, _CMP_LE_OQ));
+			__m256 credit = _mm256_and_ps(_mm256_loadu_ps(credits + row), isGraded);
+			__m256 product = _mm256_mul_ps(grade, credit);
+
+			weighted = _mm256_add_pd(weighted, _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(product)),
+															 _mm256_cvtps_pd(_mm256_extractf128_ps(product, 1))));
+			gradedCredits = _mm256_add_pd(gradedCredits, _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(credit)),
+																	   _mm256_cvtps_pd(_mm256_extractf128_ps(credit, 1))));
+
+			unsigned int gradedMask = _mm256_movemask_ps(isGraded);
+			aggregate.graded += __builtin_popcount(gradedMask);
+			aggregate.passed += __builtin_popcount(_mm256_movemask_ps(isPassed));
+
+			__m256i bucket = _mm256_setzero_si256();
+			for (float limit: bucketLimits)
+			{
+				bucket = _mm256_sub_epi32(bucket, _mm256_castps_si256(_mm256_cmp_ps(grade, _mm256_set1_ps(limit), _CMP_GE_OQ)));
+			}
+			_mm256_store_si256(reinterpret_cast<__m256i*>(buckets), bucket);
+			for (; gradedMask != 0; gradedMask &= gradedMask - 1)
+			{
+				aggregate.histogram[buckets[__builtin_ctz(gradedMask)]]++;
+			}
+		}
+
+		alignas(32) double sums[4];
+		_mm256_store_pd(sums, weighted);
+		aggregate.weightedGradeSum += sums[0] + sums[1] + sums[2] + sums[3];
+		_mm256_store_pd(sums, gradedCredits);
+		aggregate.gradedCredits += sums[0] + sums[1] + sums[2] + sums[3];
+		aggregate.enrollments += row;
+
+		aggregateScalar(grades + row, credits + row, count - row, aggregate);
+	}
+#endif
+
+	typedef void (*AggregateFunction)(const float*, const float*, std::size_t, GradeAggregate&);
+
+	/**
+	 * \brief		: Picks the widest kernel the processor supports
+	 */
+	AggregateFunction selectAggregate()
+	{
+#ifdef GRADEANALYTICS_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return aggregateAvx2;
+		}
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return aggregateSse2;
+		}
+#endif
+		return aggregateScalar;
+	}
+
+	const AggregateFunction aggregateRows = selectAggregate();
+
+	/**
+	 * \brief		: Runs function(firstRow, endRow, range) for every range of rows, on the pool if one is given
+	 */
+	void forEachRange(ThreadPool *threadPool, const std::string &name, std::size_t rows,
+					  const std::function<void(std::size_t, std::size_t, std::size_t)> &function)
+	{
+		auto runRanges = [rows, &function](std::size_t firstRange, std::size_t endRange)
+		{
+			for (std::size_t range = firstRange; range < endRange; range++)
+			{
+				function(range * rowsPerRange, std::min(rows, (range + 1) * rowsPerRange), range);
+			}
+		};
+
+		std::size_t rangeCount = (rows + rowsPerRange - 1) / rowsPerRange;
+		if (threadPool != nullptr)
+		{
+			threadPool->parallelFor(name, 0, rangeCount, 1, runRanges);
+		}
+		else
+		{
+			runRanges(0, rangeCount);
+		}
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to get the share of passed grades among the graded enrollments
+ * \param		: NONE
+ * \return		: double - 0 to 1, 0 if nothing is graded
+ */
+double GradeAggregate::getPassRate() const
+{
+	return graded == 0 ? 0 : static_cast<double>(passed) / graded;
+}
+
+/**
+ * \brief		: Method to get the average grade weighted by credit points
+ * \param		: NONE
+ * \return		: double - average grade, 0 if nothing is graded
+ */
+double GradeAggregate::getWeightedAverage() const
+{
+	return gradedCredits == 0 ? 0 : weightedGradeSum / gradedCredits;
+}
+
+/**
+ * \brief		: Method to add the counts of another aggregate
+ * \param[IN]	: const GradeAggregate &other - aggregate of other enrollments
+ * \return		: NONE
+ */
+void GradeAggregate::merge(const GradeAggregate &other)
+{
+	enrollments += other.enrollments;
+	graded += other.graded;
+	passed += other.passed;
+	weightedGradeSum += other.weightedGradeSum;
+	gradedCredits += other.gradedCredits;
+	for (std::size_t bucket = 0; bucket < histogram.size(); bucket++)
+	{
+		histogram[bucket] += other.histogram[bucket];
+	}
+}
+
+/**
+ * \brief		: Method to copy the enrollments of a database into columns
+ * \param[IN]	: const StudentDb &studentDb - database, the caller holds its shared lock
+ * \return		: NONE
+ */
+void GradeAnalytics::extract(const StudentDb &studentDb)
+{
+	std::unordered_map<unsigned int, std::uint32_t> courseCodeOf;
+	std::unordered_map<std::string, std::uint32_t> semesterCodeOf;
+	std::unordered_map<unsigned char, std::uint32_t> majorCodeOf;
+
+	grades.clear();
+	credits.clear();
+	courseCodes.clear();
+	semesterCodes.clear();
+	majorCodes.clear();
+	for (std::vector<std::string> &dictionary: dictionaries)
+	{
+		dictionary.clear();
+	}
+
+	for (const auto &eachStudent: studentDb.getStudents())
+	{
+		for (const Enrollment &enrollment: eachStudent.second.getEnrollments())
+		{
+			const Course &course = enrollment.getCourse();
+
+			auto courseCode = courseCodeOf.emplace(course.getCourseKey(), dictionaries[COURSE].size());
+			if (courseCode.second)
+			{
+				dictionaries[COURSE].push_back(std::to_string(course.getCourseKey()));
+			}
+			auto semesterCode = semesterCodeOf.emplace(enrollment.getSemester(), dictionaries[SEMESTER].size());
+			if (semesterCode.second)
+			{
+				dictionaries[SEMESTER].push_back(enrollment.getSemester());
+			}
+			auto majorCode = majorCodeOf.emplace(course.getMajor(), dictionaries[MAJOR].size());
+			if (majorCode.second)
+			{
+				std::string majorName = course.getMajorName();
+				dictionaries[MAJOR].push_back(majorName.empty() ? std::string(1, course.getMajor()) : majorName);
+			}
+
+			grades.push_back(enrollment.getGrade());
+			credits.push_back(course.getCreditPoints());
+			courseCodes.push_back(courseCode.first->second);
+			semesterCodes.push_back(semesterCode.first->second);
+			majorCodes.push_back(majorCode.first->second);
+		}
+	}
+}
+
+/**
+ * \brief		: Method to get the number of copied enrollments
+ * \param		: NONE
+ * \return		: std::size_t - rows of the columns
+ */
+std::size_t GradeAnalytics::getRowCount() const
+{
+	return grades.size();
+}
+
+/**
+ * \brief		: Method to aggregate all enrollments
+ * \param[IN]	: ThreadPool *threadPool - pool running the ranges of rows, nullptr for the calling thread only
+ * \return		: GradeAggregate - totals
+ */
+GradeAggregate GradeAnalytics::total(ThreadPool *threadPool) const
+{
+	std::vector<GradeAggregate> parts((grades.size() + rowsPerRange - 1) / rowsPerRange);
+
+	forEachRange(threadPool, "grade totals", grades.size(),
+				 [this, &parts](std::size_t firstRow, std::size_t endRow, std::size_t range)
+	{
+		aggregateRows(grades.data() + firstRow, credits.data() + firstRow, endRow - firstRow, parts[range]);
+	});
+
+	GradeAggregate totals;
+	for (const GradeAggregate &part: parts)
+	{
+		totals.merge(part);
+	}
+	return totals;
+}
+
+/**
+ * \brief		: Method to aggregate the enrollments per course, semester or major
+ * \param[IN]	: GroupBy groupBy - group attribute
+ * \param[IN]	: ThreadPool *threadPool - pool running the ranges of rows, nullptr for the calling thread only
+ * \return		: std::map<std::string, GradeAggregate> - aggregate per course key, semester or major name
+ */
+std::map<std::string, GradeAggregate> GradeAnalytics::groupBy(GroupBy groupBy, ThreadPool *threadPool) const
+{
+	const std::vector<std::uint32_t> &codes = groupBy == COURSE ? courseCodes : groupBy == SEMESTER ? semesterCodes : majorCodes;
+	std::vector<std::vector<GradeAggregate>> parts((grades.size() + rowsPerRange - 1) / rowsPerRange,
+												   std::vector<GradeAggregate>(dictionaries[groupBy].size()));
+
+	forEachRange(threadPool, "grade group-by", grades.size(),
+				 [this, &codes, &parts](std::size_t firstRow, std::size_t endRow, std::size_t range)
+	{
+		for (std::size_t row = firstRow; row < endRow; row++)
+		{
+			addRow(grades[row], credits[row], parts[range][codes[row]]);
+		}
+	});
+
+	std::map<std::string, GradeAggregate> groups;
+	for (std::size_t code = 0; code < dictionaries[groupBy].size(); code++)
+	{
+		GradeAggregate &group = groups[dictionaries[groupBy][code]];
+		for (const std::vector<GradeAggregate> &part: parts)
+		{
+			group.merge(part[code]);
+		}
+	}
+	return groups;
+}
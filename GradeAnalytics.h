@@ -0,0 +1,138 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file GradeAnalytics.h
+ *	\brief Header file for GradeAnalytics class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef GRADEANALYTICS_H_
+#define GRADEANALYTICS_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+//! User Includes
+#include "StudentDb.h"
+#include "CourseGradeStatistics.h"
+#include "ThreadPool.h"
+
+/**
+ * \brief		: Aggregate over a set of enrollments
+ */
+struct GradeAggregate
+{
+	std::size_t enrollments = 0;		//!< all enrollments
+	std::size_t graded = 0;				//!< enrollments with a grade
+	std::size_t passed = 0;				//!< grades 1.0 to 4.0
+	double weightedGradeSum = 0;		//!< grade times credit points of the graded enrollments
+	double gradedCredits = 0;			//!< credit points of the graded enrollments
+	std::array<std::size_t, CourseGradeStatistics::bucketCount> histogram {};	//!< as CourseGradeStatistics
+
+	/**
+	 * \brief		: Method to get the share of passed grades among the graded enrollments
+	 * \param		: NONE
+	 * \return		: double - 0 to 1, 0 if nothing is graded
+	 */
+	double getPassRate() const;
+
+	/**
+	 * \brief		: Method to get the average grade weighted by credit points
+	 * \param		: NONE
+	 * \return		: double - average grade, 0 if nothing is graded
+	 */
+	double getWeightedAverage() const;
+
+	/**
+	 * \brief		: Method to add the counts of another aggregate
+	 * \param[IN]	: const GradeAggregate &other - aggregate of other enrollments
+	 * \return		: NONE
+	 */
+	void merge(const GradeAggregate &other);
+};
+
+/**
+ * \brief		: Column copy of all enrollments for semester-end reporting
+ * \details		: The enrollments are copied once into contiguous arrays of grade, credit
+ *				  points and dictionary codes of course, semester and major, so the
+ *				  aggregations read a few dense arrays instead of following every student
+ *				  and Course pointer. The totals run an SSE2 or AVX2 kernel (chosen at run
+ *				  time) over eight grades at a time; the group-by uses the dictionary codes
+ *				  as slots of a per range array, a hash lookup per row is only needed while
+ *				  the columns are built. Both split the rows across the workers of a
+ *				  ThreadPool if one is given.
+ *
+ *				  The copy is a snapshot: extract it under the shared lock of the database
+ *				  and build a new one to see later changes.
+ */
+class GradeAnalytics
+{
+public:
+
+	/**
+	 * \brief		: Attribute the enrollments are grouped by
+	 */
+	enum GroupBy
+	{
+		COURSE,
+		SEMESTER,
+		MAJOR
+	};
+
+private:
+
+	/**
+	 * \brief		: One entry per enrollment
+	 */
+	std::vector<float> grades;
+	std::vector<float> credits;
+	std::vector<std::uint32_t> courseCodes;
+	std::vector<std::uint32_t> semesterCodes;
+	std::vector<std::uint32_t> majorCodes;
+
+	/**
+	 * \brief		: Group name of every code, by GroupBy
+	 */
+	std::array<std::vector<std::string>, 3> dictionaries;
+
+public:
+
+	/**
+	 * \brief		: Method to copy the enrollments of a database into columns
+	 * \param[IN]	: const StudentDb &studentDb - database, the caller holds its shared lock
+	 * \return		: NONE
+	 */
+	void extract(const StudentDb &studentDb);
+
+	/**
+	 * \brief		: Method to get the number of copied enrollments
+	 * \param		: NONE
+	 * \return		: std::size_t - rows of the columns
+	 */
+	std::size_t getRowCount() const;
+
+	/**
+	 * \brief		: Method to aggregate all enrollments
+	 * \param[IN]	: ThreadPool *threadPool - pool running the ranges of rows, nullptr for the calling thread only
+	 * \return		: GradeAggregate - totals
+	 */
+	GradeAggregate total(ThreadPool *threadPool = nullptr) const;
+
+	/**
+	 * \brief		: Method to aggregate the enrollments per course, semester or major
+	 * \param[IN]	: GroupBy groupBy - group attribute
+	 * \param[IN]	: ThreadPool *threadPool - pool running the ranges of rows, nullptr for the calling thread only
+	 * \return		: std::map<std::string, GradeAggregate> - aggregate per course key, semester or major name
+	 */
+	std::map<std::string, GradeAggregate> groupBy(GroupBy groupBy, ThreadPool *threadPool = nullptr) const;
+};
+
+#endif /* GRADEANALYTICS_H_ */
@@ -0,0 +1,214 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file HyperLogLog.cpp
+ *	\brief Source file for HyperLogLog class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HYPERLOGLOG_X86
+#endif
+
+//! User Includes
+#include "HyperLogLog.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor, empty sketch
+ * \param[IN]	: unsigned int precision - number of index bits, between minPrecision and maxPrecision
+ * \throw		: std::invalid_argument if the precision is out of range
+ */
+HyperLogLog::HyperLogLog(unsigned int precision)
+	: precision{precision}
+{
+	if (precision < minPrecision || precision > maxPrecision)
+	{
+		throw std::invalid_argument("HyperLogLog precision out of range");
+	}
+	registers.assign(std::size_t{1} << precision, 0);
+}
+
+/**
+ * \brief		: Method to add a value by its hash
+ * \param[IN]	: std::uint64_t hash - well mixed 64 bit hash of the value, see hash
+ * \return		: NONE
+ */
+void HyperLogLog::addHash(std::uint64_t hash)
+{
+	std::size_t index = hash >> (64 - precision);
+
+	//! A stop bit below the remaining bits limits the rank to 64 - p + 1
+	std::uint64_t remaining = (hash << precision) | (std::uint64_t{1} << (precision - 1));
+	std::uint8_t rank = static_cast<std::uint8_t>(__builtin_clzll(remaining) + 1);
+
+	registers[index] = std::max(registers[index], rank);
+}
+
+/**
+ * \brief		: Method to add a number, e.g. a matrikel number
+ * \param[IN]	: std::uint64_t value - value to add
+ * \return		: NONE
+ */
+void HyperLogLog::add(std::uint64_t value)
+{
+	addHash(hash(value));
+}
+
+/**
+ * \brief		: Method to add a text, e.g. a case folded city name
+ * \param[IN]	: const std::string &value - value to add
+ * \return		: NONE
+ */
+void HyperLogLog::add(const std::string &value)
+{
+	addHash(hash(value));
+}
+
+/**
+ * \brief		: Method to unite another sketch into this one
+ * \param[IN]	: const HyperLogLog &other - sketch of the same precision, e.g. of another shard
+ * \return		: NONE
+ * \throw		: std::invalid_argument if the precisions differ
+ */
+void HyperLogLog::merge(const HyperLogLog &other)
+{
+	if (other.precision != precision)
+	{
+		throw std::invalid_argument("HyperLogLog precisions differ");
+	}
+
+	std::size_t index = 0;
+#ifdef HYPERLOGLOG_X86
+	//! 16 registers per instruction, the register count is a multiple of 16
+	for (; index + 16 <= registers.size(); index += 16)
+	{
+		__m128i *mine = reinterpret_cast<__m128i*>(registers.data() + index);
+		const __m128i *theirs = reinterpret_cast<const __m128i*>(other.registers.data() + index);
+		_mm_storeu_si128(mine, _mm_max_epu8(_mm_loadu_si128(mine), _mm_loadu_si128(theirs)));
+	}
+#endif
+	for (; index < registers.size(); index++)
+	{
+		registers[index] = std::max(registers[index], other.registers[index]);
+	}
+}
+
+/**
+ * \brief		: Method to estimate the number of distinct values added
+ * \details		: One pass over the registers, a few microseconds for the default precision
+ * \param		: NONE
+ * \return		: double - estimated cardinality, 0 for an empty sketch
+ */
+double HyperLogLog::estimate() const
+{
+	//! Count the registers per rank, then sum 2^-rank once per rank instead of once per register
+	std::size_t rankCounts[64 + 2] = {};
+	for (std::uint8_t rank: registers)
+	{
+		rankCounts[rank]++;
+	}
+
+	double inverseSum = 0;
+	for (unsigned int rank = 0; rank <= 64 - precision + 1; rank++)
+	{
+		inverseSum += std::ldexp(static_cast<double>(rankCounts[rank]), -static_cast<int>(rank));
+	}
+
+	double registerCount = static_cast<double>(registers.size());
+	double alpha = registers.size() == 16 ? 0.673
+				   : registers.size() == 32 ? 0.697
+				   : registers.size() == 64 ? 0.709
+				   : 0.7213 / (1 + 1.079 / registerCount);
+	double rawEstimate = alpha * registerCount * registerCount / inverseSum;
+
+	//! Linear counting while empty registers are left and the raw estimate is biased
+	std::size_t emptyRegisters = rankCounts[0];
+	if (rawEstimate <= 2.5 * registerCount && emptyRegisters > 0)
+	{
+		return registerCount * std::log(registerCount / static_cast<double>(emptyRegisters));
+	}
+
+	//! No correction at the top, 64 bit hashes do not collide at these counts
+	return rawEstimate;
+}
+
+/**
+ * \brief		: Method to get the relative standard error of the estimate
+ * \param		: NONE
+ * \return		: double - 1.04 / sqrt(number of registers)
+ */
+double HyperLogLog::getStandardError() const
+{
+	return 1.04 / std::sqrt(static_cast<double>(registers.size()));
+}
+
+/**
+ * \brief		: Getter method for the precision
+ * \param		: NONE
+ * \return		: unsigned int - number of index bits
+ */
+unsigned int HyperLogLog::getPrecision() const
+{
+	return precision;
+}
+
+/**
+ * \brief		: Method to empty the sketch
+ * \param		: NONE
+ * \return		: NONE
+ */
+void HyperLogLog::clear()
+{
+	std::fill(registers.begin(), registers.end(), 0);
+}
+
+/**
+ * \brief		: Method to hash a number, the SplitMix64 finaliser
+ * \param[IN]	: std::uint64_t value - value to hash
+ * \return		: std::uint64_t - hash with every bit depending on every bit of the value
+ */
+std::uint64_t HyperLogLog::hash(std::uint64_t value)
+{
+	value += 0x9E3779B97F4A7C15ULL;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+/**
+ * \brief		: Method to hash a text, FNV-1a followed by the SplitMix64 finaliser
+ * \param[IN]	: const std::string &value - value to hash
+ * \return		: std::uint64_t - hash of the text
+ */
+std::uint64_t HyperLogLog::hash(const std::string &value)
+{
+	std::uint64_t fnv = 0xCBF29CE484222325ULL;
+	for (unsigned char character: value)
+	{
+		fnv = (fnv ^ character) * 0x100000001B3ULL;
+	}
+	return hash(fnv);
+}
+
+/**
+ * \brief		: Method to add the registers to a memory report
+ * \param[IN]	: MemoryReport &report - report
+ * \param[IN]	: MemoryReport::Category category - category of the owner
+ * \return		: NONE
+ */
+void HyperLogLog::reportMemory(MemoryReport &report, MemoryReport::Category category) const
+{
+	report.addVector(category, registers);
+}
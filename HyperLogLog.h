@@ -0,0 +1,154 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file HyperLogLog.h
+ *	\brief Header file for HyperLogLog class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef HYPERLOGLOG_H_
+#define HYPERLOGLOG_H_
+
+//! System Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//! User Includes
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Approximate number of distinct values added, in a fixed amount of memory
+ * \details		: The top p bits of the 64 bit hash of a value choose one of m = 2^p registers,
+ *				  the register keeps the highest position of the first set bit seen in the
+ *				  remaining bits. The harmonic mean of the registers estimates the number
+ *				  of distinct values; adding a value twice changes nothing.
+ *
+ *				  Error bounds: the relative standard error is 1.04 / sqrt(m), for the default
+ *				  precision 12 (4096 registers, 4 KiB) that is 1.6 %, so about 95 % of the
+ *				  estimates are within 3.3 % and 99.7 % within 4.9 % of the exact count.
+ *				  Below 2.5 m distinct values the estimate switches to linear counting of the
+ *				  empty registers, which is within a few values of the exact count for the
+ *				  small counts of a dashboard.
+ *
+ *				  Values can not be removed. Sketches of the same precision are merged by
+ *				  the maximum of every register, the result is the sketch of the union.
+ */
+class HyperLogLog
+{
+public:
+
+	/**
+	 * \brief		: Precision of the sketches of the database, 2^12 registers
+	 */
+	static constexpr unsigned int defaultPrecision = 12;
+
+	static constexpr unsigned int minPrecision = 4;
+	static constexpr unsigned int maxPrecision = 16;
+
+private:
+
+	/**
+	 * \brief		: Number of index bits p
+	 */
+	unsigned int precision;
+
+	/**
+	 * \brief		: Highest first set bit position per register, 0 for an empty register
+	 */
+	std::vector<std::uint8_t> registers;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor, empty sketch
+	 * \param[IN]	: unsigned int precision - number of index bits, between minPrecision and maxPrecision
+	 * \throw		: std::invalid_argument if the precision is out of range
+	 */
+	explicit HyperLogLog(unsigned int precision = defaultPrecision);
+
+	/**
+	 * \brief		: Method to add a value by its hash
+	 * \param[IN]	: std::uint64_t hash - well mixed 64 bit hash of the value, see hash
+	 * \return		: NONE
+	 */
+	void addHash(std::uint64_t hash);
+
+	/**
+	 * \brief		: Method to add a number, e.g. a matrikel number
+	 * \param[IN]	: std::uint64_t value - value to add
+	 * \return		: NONE
+	 */
+	void add(std::uint64_t value);
+
+	/**
+	 * \brief		: Method to add a text, e.g. a case folded city name
+	 * \param[IN]	: const std::string &value - value to add
+	 * \return		: NONE
+	 */
+	void add(const std::string &value);
+
+	/**
+	 * \brief		: Method to unite another sketch into this one
+	 * \param[IN]	: const HyperLogLog &other - sketch of the same precision, e.g. of another shard
+	 * \return		: NONE
+	 * \throw		: std::invalid_argument if the precisions differ
+	 */
+	void merge(const HyperLogLog &other);
+
+	/**
+	 * \brief		: Method to estimate the number of distinct values added
+	 * \details		: One pass over the registers, a few microseconds for the default precision
+	 * \param		: NONE
+	 * \return		: double - estimated cardinality, 0 for an empty sketch
+	 */
+	double estimate() const;
+
+	/**
+	 * \brief		: Method to get the relative standard error of the estimate
+	 * \param		: NONE
+	 * \return		: double - 1.04 / sqrt(number of registers)
+	 */
+	double getStandardError() const;
+
+	/**
+	 * \brief		: Getter method for the precision
+	 * \param		: NONE
+	 * \return		: unsigned int - number of index bits
+	 */
+	unsigned int getPrecision() const;
+
+	/**
+	 * \brief		: Method to empty the sketch
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to hash a number, the SplitMix64 finaliser
+	 * \param[IN]	: std::uint64_t value - value to hash
+	 * \return		: std::uint64_t - hash with every bit depending on every bit of the value
+	 */
+	static std::uint64_t hash(std::uint64_t value);
+
+	/**
+	 * \brief		: Method to hash a text, FNV-1a followed by the SplitMix64 finaliser
+	 * \param[IN]	: const std::string &value - value to hash
+	 * \return		: std::uint64_t - hash of the text
+	 */
+	static std::uint64_t hash(const std::string &value);
+
+	/**
+	 * \brief		: Method to add the registers to a memory report
+	 * \param[IN]	: MemoryReport &report - report
+	 * \param[IN]	: MemoryReport::Category category - category of the owner
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report, MemoryReport::Category category) const;
+};
+
+#endif /* HYPERLOGLOG_H_ */
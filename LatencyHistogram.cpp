@@ -0,0 +1,199 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file LatencyHistogram.cpp
+ *	\brief Source file for LatencyHistogram class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cmath>
+
+//! User Includes
+#include "LatencyHistogram.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor, empty histogram
+ */
+LatencyHistogram::LatencyHistogram()
+	: counts{}, count{0}, sum{0}
+{
+}
+
+/**
+ * \brief		: Method to add a duration
+ * \param[IN]	: std::uint64_t nanoseconds - duration
+ * \return		: NONE
+ */
+void LatencyHistogram::record(std::uint64_t nanoseconds)
+{
+	counts[getBucket(nanoseconds)]++;
+	count++;
+	sum += nanoseconds;
+}
+
+/**
+ * \brief		: Method to add the values counted elsewhere in the same buckets
+ * \param[IN]	: std::size_t bucket - bucket, below bucketCount
+ * \param[IN]	: std::uint64_t valueCount - number of values in the bucket
+ * \return		: NONE
+ */
+void LatencyHistogram::addBucket(std::size_t bucket, std::uint64_t valueCount)
+{
+	counts[bucket] += valueCount;
+	count += valueCount;
+}
+
+/**
+ * \brief		: Method to add to the sum of the values, together with addBucket
+ * \param[IN]	: std::uint64_t nanoseconds - sum of the added values
+ * \return		: NONE
+ */
+void LatencyHistogram::addSum(std::uint64_t nanoseconds)
+{
+	sum += nanoseconds;
+}
+
+/**
+ * \brief		: Method to add the values of another histogram
+ * \param[IN]	: const LatencyHistogram &other - histogram to add
+ * \return		: NONE
+ */
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+	for (std::size_t bucket = 0; bucket < bucketCount; bucket++)
+	{
+		counts[bucket] += other.counts[bucket];
+	}
+	count += other.count;
+	sum += other.sum;
+}
+
+/**
+ * \brief		: Getter method for the number of values
+ * \param		: NONE
+ * \return		: std::uint64_t - number of values
+ */
+std::uint64_t LatencyHistogram::getCount() const
+{
+	return count;
+}
+
+/**
+ * \brief		: Getter method for the sum of the values
+ * \param		: NONE
+ * \return		: std::uint64_t - sum in nanoseconds
+ */
+std::uint64_t LatencyHistogram::getSum() const
+{
+	return sum;
+}
+
+/**
+ * \brief		: Method to get the value below which a share of the values lies
+ * \param[IN]	: double percentile - between 0 and 100
+ * \return		: std::uint64_t - highest value of the bucket holding the percentile, 0 if empty
+ */
+std::uint64_t LatencyHistogram::getValueAtPercentile(double percentile) const
+{
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	//! Rank of the value, at least the first one
+	double share = std::min(100.0, std::max(0.0, percentile)) / 100;
+	std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(share * count)));
+
+	std::uint64_t seen = 0;
+	for (std::size_t bucket = 0; bucket < bucketCount; bucket++)
+	{
+		seen += counts[bucket];
+		if (seen >= rank)
+		{
+			return getBucketUpperBound(bucket);
+		}
+	}
+	return getMax();
+}
+
+/**
+ * \brief		: Method to get the upper bound of the highest value
+ * \param		: NONE
+ * \return		: std::uint64_t - highest value of the highest bucket in use, 0 if empty
+ */
+std::uint64_t LatencyHistogram::getMax() const
+{
+	for (std::size_t bucket = bucketCount; bucket > 0; bucket--)
+	{
+		if (counts[bucket - 1] != 0)
+		{
+			return getBucketUpperBound(bucket - 1);
+		}
+	}
+	return 0;
+}
+
+/**
+ * \brief		: Method to count the values of the buckets that end at a limit or below
+ * \details		: Values of the bucket holding the limit are not counted, the count is
+ *				  exact up to the width of one bucket
+ * \param[IN]	: std::uint64_t nanoseconds - limit
+ * \return		: std::uint64_t - number of values
+ */
+std::uint64_t LatencyHistogram::getCountAtOrBelow(std::uint64_t nanoseconds) const
+{
+	std::uint64_t below = 0;
+	for (std::size_t bucket = 0; bucket < bucketCount && getBucketUpperBound(bucket) <= nanoseconds; bucket++)
+	{
+		below += counts[bucket];
+	}
+	return below;
+}
+
+/**
+ * \brief		: Method to get the bucket of a value
+ * \param[IN]	: std::uint64_t nanoseconds - value
+ * \return		: std::size_t - bucket, the last one for values of 2^42 and more
+ */
+std::size_t LatencyHistogram::getBucket(std::uint64_t nanoseconds)
+{
+	if (nanoseconds < 2 * subBucketCount)
+	{
+		return static_cast<std::size_t>(nanoseconds);
+	}
+
+	unsigned int highestBit = 63 - __builtin_clzll(nanoseconds);
+	if (highestBit >= maxValueBits)
+	{
+		return bucketCount - 1;
+	}
+
+	//! The value shifted by the level keeps its top subBucketBits + 1 bits, the first of them is set
+	unsigned int shift = highestBit - subBucketBits;
+	return 2 * subBucketCount + (shift - 1) * subBucketCount + ((nanoseconds >> shift) - subBucketCount);
+}
+
+/**
+ * \brief		: Method to get the highest value of a bucket
+ * \param[IN]	: std::size_t bucket - bucket, below bucketCount
+ * \return		: std::uint64_t - highest value counted in the bucket
+ */
+std::uint64_t LatencyHistogram::getBucketUpperBound(std::size_t bucket)
+{
+	if (bucket < 2 * subBucketCount)
+	{
+		return bucket;
+	}
+
+	unsigned int shift = static_cast<unsigned int>((bucket - 2 * subBucketCount) / subBucketCount) + 1;
+	std::uint64_t subBucket = (bucket - 2 * subBucketCount) % subBucketCount + subBucketCount;
+	return ((subBucket + 1) << shift) - 1;
+}
@@ -0,0 +1,139 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file LatencyHistogram.h
+ *	\brief Header file for LatencyHistogram class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief		: Histogram of durations in nanoseconds with a bounded relative error
+ * \details		: Log-linear buckets in the style of HdrHistogram: values below 64 have a
+ *				  bucket each, above that every power of two is split into 32 buckets of
+ *				  equal width. A bucket is at most 1/32 (3.1 %) of its values wide, so
+ *				  percentiles are within 3.1 % of the exact ones from 1 ns up to 73 minutes
+ *				  (2^42 ns), longer values count in the last bucket. Histograms are merged
+ *				  by adding the buckets.
+ */
+class LatencyHistogram
+{
+public:
+
+	static constexpr unsigned int subBucketBits = 5;
+	static constexpr std::size_t subBucketCount = std::size_t{1} << subBucketBits;
+	static constexpr unsigned int maxValueBits = 42;
+	static constexpr std::size_t bucketCount = 2 * subBucketCount + (maxValueBits - subBucketBits - 1) * subBucketCount;
+
+private:
+
+	/**
+	 * \brief		: Number of values per bucket
+	 */
+	std::array<std::uint64_t, bucketCount> counts;
+
+	/**
+	 * \brief		: Number of values and their sum
+	 */
+	std::uint64_t count;
+	std::uint64_t sum;
+
+public:
+
+	/**
+	 * \brief		: Constructor, empty histogram
+	 */
+	LatencyHistogram();
+
+	/**
+	 * \brief		: Method to add a duration
+	 * \param[IN]	: std::uint64_t nanoseconds - duration
+	 * \return		: NONE
+	 */
+	void record(std::uint64_t nanoseconds);
+
+	/**
+	 * \brief		: Method to add the values counted elsewhere in the same buckets
+	 * \param[IN]	: std::size_t bucket - bucket, below bucketCount
+	 * \param[IN]	: std::uint64_t valueCount - number of values in the bucket
+	 * \return		: NONE
+	 */
+	void addBucket(std::size_t bucket, std::uint64_t valueCount);
+
+	/**
+	 * \brief		: Method to add to the sum of the values, together with addBucket
+	 * \param[IN]	: std::uint64_t nanoseconds - sum of the added values
+	 * \return		: NONE
+	 */
+	void addSum(std::uint64_t nanoseconds);
+
+	/**
+	 * \brief		: Method to add the values of another histogram
+	 * \param[IN]	: const LatencyHistogram &other - histogram to add
+	 * \return		: NONE
+	 */
+	void merge(const LatencyHistogram &other);
+
+	/**
+	 * \brief		: Getter method for the number of values
+	 * \param		: NONE
+	 * \return		: std::uint64_t - number of values
+	 */
+	std::uint64_t getCount() const;
+
+	/**
+	 * \brief		: Getter method for the sum of the values
+	 * \param		: NONE
+	 * \return		: std::uint64_t - sum in nanoseconds
+	 */
+	std::uint64_t getSum() const;
+
+	/**
+	 * \brief		: Method to get the value below which a share of the values lies
+	 * \param[IN]	: double percentile - between 0 and 100
+	 * \return		: std::uint64_t - highest value of the bucket holding the percentile, 0 if empty
+	 */
+	std::uint64_t getValueAtPercentile(double percentile) const;
+
+	/**
+	 * \brief		: Method to get the upper bound of the highest value
+	 * \param		: NONE
+	 * \return		: std::uint64_t - highest value of the highest bucket in use, 0 if empty
+	 */
+	std::uint64_t getMax() const;
+
+	/**
+	 * \brief		: Method to count the values of the buckets that end at a limit or below
+	 * \details		: Values of the bucket holding the limit are not counted, the count is
+	 *				  exact up to the width of one bucket
+	 * \param[IN]	: std::uint64_t nanoseconds - limit
+	 * \return		: std::uint64_t - number of values
+	 */
+	std::uint64_t getCountAtOrBelow(std::uint64_t nanoseconds) const;
+
+	/**
+	 * \brief		: Method to get the bucket of a value
+	 * \param[IN]	: std::uint64_t nanoseconds - value
+	 * \return		: std::size_t - bucket, the last one for values of 2^42 and more
+	 */
+	static std::size_t getBucket(std::uint64_t nanoseconds);
+
+	/**
+	 * \brief		: Method to get the highest value of a bucket
+	 * \param[IN]	: std::size_t bucket - bucket, below bucketCount
+	 * \return		: std::uint64_t - highest value counted in the bucket
+	 */
+	static std::uint64_t getBucketUpperBound(std::size_t bucket);
+};
+
+#endif /* LATENCYHISTOGRAM_H_ */
@@ -0,0 +1,238 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file MemoryReport.cpp
+ *	\brief Source file for MemoryReport class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <functional>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+//! User Includes
+#include "MemoryReport.h"
+
+namespace
+{
+	const char *const categoryNames[] = {"student_nodes", "name_strings", "address_fields", "enrollment_vectors",
+										 "semester_credits", "courses", "course_statistics", "name_index",
+										 "fuzzy_index", "prefix_index", "phonetic_index", "attribute_index",
+										 "enrollment_index", "schedule_index", "cardinality_index"};
+
+	/**
+	 * \brief		: Helper function to write the memory of a category as JSON object
+	 * \param[IN]	: std::ostream &out - stream
+	 * \param[IN]	: const MemoryReport::Usage &usage - memory
+	 * \return		: NONE
+	 */
+	void writeUsage(std::ostream &out, const MemoryReport::Usage &usage)
+	{
+		std::size_t slackBytes = usage.allocatedBytes - usage.usedBytes;
+		out << "{\"objects\":" << usage.objects << ",\"blocks\":" << usage.blocks
+			<< ",\"usedBytes\":" << usage.usedBytes << ",\"allocatedBytes\":" << usage.allocatedBytes
+			<< ",\"slackBytes\":" << slackBytes << ",\"fragmentation\":"
+			<< (usage.allocatedBytes > 0 ? static_cast<double>(slackBytes) / usage.allocatedBytes : 0.0) << "}";
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor, empty report
+ */
+MemoryReport::MemoryReport()
+	: usages{}
+{
+}
+
+/**
+ * \brief		: Method to count objects of a category
+ * \param[IN]	: Category category - category
+ * \param[IN]	: std::size_t count - number of objects
+ * \return		: NONE
+ */
+void MemoryReport::addObjects(Category category, std::size_t count)
+{
+	usages[category].objects += count;
+}
+
+/**
+ * \brief		: Method to add a heap block
+ * \param[IN]	: Category category - category
+ * \param[IN]	: std::size_t requestedBytes - size asked from the allocator
+ * \param[IN]	: std::size_t usedBytes - part of it in use
+ * \return		: NONE
+ */
+void MemoryReport::addBlock(Category category, std::size_t requestedBytes, std::size_t usedBytes)
+{
+	Usage &usage = usages[category];
+	usage.blocks++;
+	usage.usedBytes += usedBytes;
+	usage.allocatedBytes += getChunkSize(requestedBytes);
+}
+
+/**
+ * \brief		: Method to add blocks of the same size
+ * \param[IN]	: Category category - category
+ * \param[IN]	: std::size_t count - number of blocks
+ * \param[IN]	: std::size_t bytes - size asked for and used per block
+ * \return		: NONE
+ */
+void MemoryReport::addBlocks(Category category, std::size_t count, std::size_t bytes)
+{
+	Usage &usage = usages[category];
+	usage.blocks += count;
+	usage.usedBytes += count * bytes;
+	usage.allocatedBytes += count * getChunkSize(bytes);
+}
+
+/**
+ * \brief		: Method to add the buffer of a string
+ * \param[IN]	: Category category - category
+ * \param[IN]	: const std::string &text - string, nothing is added if it is stored inline
+ * \return		: NONE
+ */
+void MemoryReport::addString(Category category, const std::string &text)
+{
+	//! Short strings keep their characters inside the string object
+	const char *characters = text.data();
+	const char *object = reinterpret_cast<const char*>(&text);
+	if (!std::less<const char*>()(characters, object) && std::less<const char*>()(characters, object + sizeof text))
+	{
+		return;
+	}
+	addBlock(category, text.capacity() + 1, text.size() + 1);
+}
+
+/**
+ * \brief		: Method to read the malloc statistics of the process
+ * \param		: NONE
+ * \return		: NONE
+ */
+void MemoryReport::measureHeap()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+	struct mallinfo2 info = mallinfo2();
+	heap.available = true;
+	heap.systemBytes = info.arena;
+	heap.mappedBytes = info.hblkhd;
+	heap.inUseBytes = info.uordblks + info.hblkhd;
+	heap.freeBytes = info.fordblks;
+#elif defined(__GLIBC__)
+	//! The int fields of the old interface wrap above 2 GiB
+	struct mallinfo info = mallinfo();
+	heap.available = true;
+	heap.systemBytes = static_cast<unsigned int>(info.arena);
+	heap.mappedBytes = static_cast<unsigned int>(info.hblkhd);
+	heap.inUseBytes = static_cast<unsigned int>(info.uordblks) + heap.mappedBytes;
+	heap.freeBytes = static_cast<unsigned int>(info.fordblks);
+#endif
+}
+
+/**
+ * \brief		: Getter method for the memory of a category
+ * \param[IN]	: Category category - category
+ * \return		: const Usage& - memory
+ */
+const MemoryReport::Usage& MemoryReport::getUsage(Category category) const
+{
+	return usages[category];
+}
+
+/**
+ * \brief		: Method to get the memory of all categories
+ * \param		: NONE
+ * \return		: Usage - sums of the categories
+ */
+MemoryReport::Usage MemoryReport::getTotal() const
+{
+	Usage total;
+	for (const Usage &usage: usages)
+	{
+		total.objects += usage.objects;
+		total.blocks += usage.blocks;
+		total.usedBytes += usage.usedBytes;
+		total.allocatedBytes += usage.allocatedBytes;
+	}
+	return total;
+}
+
+/**
+ * \brief		: Getter method for the malloc statistics
+ * \param		: NONE
+ * \return		: const HeapUsage& - statistics of the last measureHeap, not available before
+ */
+const MemoryReport::HeapUsage& MemoryReport::getHeapUsage() const
+{
+	return heap;
+}
+
+/**
+ * \brief		: Method to write the categories, the total and the heap as JSON
+ * \param[IN]	: std::ostream &out - stream
+ * \return		: NONE
+ */
+void MemoryReport::writeJson(std::ostream &out) const
+{
+	out << "{\"categories\":{";
+	for (int category = 0; category < CATEGORY_COUNT; category++)
+	{
+		out << (category > 0 ? "," : "") << "\"" << categoryNames[category] << "\":";
+		writeUsage(out, usages[category]);
+	}
+	out << "},\"total\":";
+	Usage total = getTotal();
+	writeUsage(out, total);
+
+	out << ",\"heap\":";
+	if (heap.available)
+	{
+		out << "{\"systemBytes\":" << heap.systemBytes << ",\"mappedBytes\":" << heap.mappedBytes
+			<< ",\"inUseBytes\":" << heap.inUseBytes << ",\"freeBytes\":" << heap.freeBytes
+			<< ",\"fragmentation\":" << (heap.systemBytes > 0 ? static_cast<double>(heap.freeBytes) / heap.systemBytes : 0.0)
+			<< ",\"otherBytes\":" << (heap.inUseBytes > total.allocatedBytes ? heap.inUseBytes - total.allocatedBytes : 0)
+			<< "}";
+	}
+	else
+	{
+		out << "null";
+	}
+	out << "}";
+}
+
+/**
+ * \brief		: Method to get the size malloc takes for a request
+ * \param[IN]	: std::size_t requestedBytes - size asked for
+ * \return		: std::size_t - size of the chunk, including the size word and the rounding
+ */
+std::size_t MemoryReport::getChunkSize(std::size_t requestedBytes)
+{
+	const std::size_t word = sizeof(std::size_t);
+	const std::size_t mapThreshold = 128 * 1024;
+	const std::size_t pageSize = 4096;
+
+	if (requestedBytes >= mapThreshold)
+	{
+		return (requestedBytes + 2 * word + pageSize - 1) / pageSize * pageSize;
+	}
+	return std::max<std::size_t>(4 * word, (requestedBytes + word + 2 * word - 1) / (2 * word) * (2 * word));
+}
+
+/**
+ * \brief		: Method to get the name of a category
+ * \param[IN]	: Category category - category
+ * \return		: const char* - lower case name, e.g. "name_strings"
+ */
+const char* MemoryReport::getCategoryName(Category category)
+{
+	return category < CATEGORY_COUNT ? categoryNames[category] : "";
+}
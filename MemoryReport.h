@@ -0,0 +1,233 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file MemoryReport.h
+ *	\brief Header file for MemoryReport class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef MEMORYREPORT_H_
+#define MEMORYREPORT_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \brief		: Bytes and objects of the structures of a database per category
+ * \details		: Filled by walking the structures, every class adds its own heap blocks
+ *				  with reportMemory. Node and block sizes follow libstdc++ and glibc malloc:
+ *				  a tree node has four pointer sized words before its value, a hash node
+ *				  one (two if the hash of the key is cached), and malloc rounds a request
+ *				  plus one word up to 16 bytes. Blocks from 128 KiB on are mapped in pages.
+ *
+ *				  The slack of a category is the allocated minus the used bytes: malloc
+ *				  rounding, spare capacity of strings and vectors. The free bytes malloc
+ *				  holds without handing them out are the external fragmentation, taken
+ *				  from the malloc statistics where glibc provides them.
+ */
+class MemoryReport
+{
+public:
+
+	/**
+	 * \brief		: Reported structures
+	 */
+	enum Category
+	{
+		STUDENT_NODES,			//!< nodes of the students map, with the Student objects
+		NAME_STRINGS,			//!< first and last names
+		ADDRESS_FIELDS,			//!< street, city and additional info
+		ENROLLMENT_VECTORS,		//!< enrollments of the students and their semesters
+		SEMESTER_CREDITS,		//!< credits per semester of the students
+		COURSES,				//!< nodes of the courses map, course objects and titles
+		COURSE_STATISTICS,		//!< grade statistics per course
+		NAME_INDEX,				//!< StudentNameIndex
+		FUZZY_INDEX,			//!< StudentFuzzyIndex
+		PREFIX_INDEX,			//!< StudentPrefixIndex
+		PHONETIC_INDEX,			//!< StudentPhoneticIndex
+		ATTRIBUTE_INDEX,		//!< StudentAttributeIndex
+		ENROLLMENT_INDEX,		//!< StudentEnrollmentIndex
+		SCHEDULE_INDEX,			//!< CourseScheduleIndex
+		CARDINALITY_INDEX,		//!< StudentCardinalityIndex
+		CATEGORY_COUNT
+	};
+
+	/**
+	 * \brief		: Memory of one category
+	 */
+	struct Usage
+	{
+		std::size_t objects = 0;			//!< objects as counted by the category, e.g. students or strings
+		std::size_t blocks = 0;				//!< heap blocks
+		std::size_t usedBytes = 0;			//!< bytes in use by the values
+		std::size_t allocatedBytes = 0;		//!< bytes taken from the heap, including malloc overhead
+	};
+
+	/**
+	 * \brief		: Statistics of the malloc heap of the process
+	 */
+	struct HeapUsage
+	{
+		bool available = false;				//!< false if the C library does not provide them
+		std::size_t systemBytes = 0;		//!< bytes of the arenas taken from the system
+		std::size_t mappedBytes = 0;		//!< bytes of the blocks mapped on their own
+		std::size_t inUseBytes = 0;			//!< bytes handed out by malloc, of the whole process
+		std::size_t freeBytes = 0;			//!< bytes held free in the arenas
+	};
+
+private:
+
+	std::array<Usage, CATEGORY_COUNT> usages;
+	HeapUsage heap;
+
+public:
+
+	/**
+	 * \brief		: Constructor, empty report
+	 */
+	MemoryReport();
+
+	/**
+	 * \brief		: Method to count objects of a category
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: std::size_t count - number of objects
+	 * \return		: NONE
+	 */
+	void addObjects(Category category, std::size_t count);
+
+	/**
+	 * \brief		: Method to add a heap block
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: std::size_t requestedBytes - size asked from the allocator
+	 * \param[IN]	: std::size_t usedBytes - part of it in use
+	 * \return		: NONE
+	 */
+	void addBlock(Category category, std::size_t requestedBytes, std::size_t usedBytes);
+
+	/**
+	 * \brief		: Method to add the buffer of a string
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: const std::string &text - string, nothing is added if it is stored inline
+	 * \return		: NONE
+	 */
+	void addString(Category category, const std::string &text);
+
+	/**
+	 * \brief		: Method to add the buffer of a vector, not the heap blocks of its elements
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: const std::vector<T> &values - vector
+	 * \return		: NONE
+	 */
+	template <typename T>
+	void addVector(Category category, const std::vector<T> &values)
+	{
+		if (values.capacity() > 0)
+		{
+			addBlock(category, values.capacity() * sizeof(T), values.size() * sizeof(T));
+		}
+	}
+
+	/**
+	 * \brief		: Method to add the nodes of a std::map or std::set, not the heap blocks of the values
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: const Tree &tree - map or set
+	 * \return		: NONE
+	 */
+	template <typename Tree>
+	void addTreeNodes(Category category, const Tree &tree)
+	{
+		std::size_t nodeBytes = 4 * sizeof(void*) + sizeof(typename Tree::value_type);
+		addBlocks(category, tree.size(), nodeBytes);
+	}
+
+	/**
+	 * \brief		: Method to add the nodes and buckets of a std::unordered_map or std::unordered_set
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: const Table &table - hash table
+	 * \return		: NONE
+	 */
+	template <typename Table>
+	void addHashTable(Category category, const Table &table)
+	{
+		//! libstdc++ caches the hash of keys other than integers and pointers
+		bool cachedHash = !std::is_integral<typename Table::key_type>::value
+						  && !std::is_pointer<typename Table::key_type>::value;
+		std::size_t nodeBytes = (cachedHash ? 2 : 1) * sizeof(void*) + sizeof(typename Table::value_type);
+		addBlocks(category, table.size(), nodeBytes);
+		if (table.bucket_count() > 1)
+		{
+			addBlock(category, table.bucket_count() * sizeof(void*), table.bucket_count() * sizeof(void*));
+		}
+	}
+
+	/**
+	 * \brief		: Method to add blocks of the same size
+	 * \param[IN]	: Category category - category
+	 * \param[IN]	: std::size_t count - number of blocks
+	 * \param[IN]	: std::size_t bytes - size asked for and used per block
+	 * \return		: NONE
+	 */
+	void addBlocks(Category category, std::size_t count, std::size_t bytes);
+
+	/**
+	 * \brief		: Method to read the malloc statistics of the process
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void measureHeap();
+
+	/**
+	 * \brief		: Getter method for the memory of a category
+	 * \param[IN]	: Category category - category
+	 * \return		: const Usage& - memory
+	 */
+	const Usage& getUsage(Category category) const;
+
+	/**
+	 * \brief		: Method to get the memory of all categories
+	 * \param		: NONE
+	 * \return		: Usage - sums of the categories
+	 */
+	Usage getTotal() const;
+
+	/**
+	 * \brief		: Getter method for the malloc statistics
+	 * \param		: NONE
+	 * \return		: const HeapUsage& - statistics of the last measureHeap, not available before
+	 */
+	const HeapUsage& getHeapUsage() const;
+
+	/**
+	 * \brief		: Method to write the categories, the total and the heap as JSON
+	 * \details		: Every category gets its slack bytes and the share of slack in its
+	 *				  allocated bytes. The heap gets the share of free bytes in its arenas and
+	 *				  the bytes in use by the process but not by the database.
+	 * \param[IN]	: std::ostream &out - stream
+	 * \return		: NONE
+	 */
+	void writeJson(std::ostream &out) const;
+
+	/**
+	 * \brief		: Method to get the size malloc takes for a request
+	 * \param[IN]	: std::size_t requestedBytes - size asked for
+	 * \return		: std::size_t - size of the chunk, including the size word and the rounding
+	 */
+	static std::size_t getChunkSize(std::size_t requestedBytes);
+
+	/**
+	 * \brief		: Method to get the name of a category
+	 * \param[IN]	: Category category - category
+	 * \return		: const char* - lower case name, e.g. "name_strings"
+	 */
+	static const char* getCategoryName(Category category);
+};
+
+#endif /* MEMORYREPORT_H_ */
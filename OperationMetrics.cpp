@@ -0,0 +1,222 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file OperationMetrics.cpp
+ *	\brief Source file for OperationMetrics class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <array>
+#include <string>
+
+//! User Includes
+#include "OperationMetrics.h"
+
+namespace
+{
+	const char *const operationNames[] = {"lookup", "search", "enroll", "grade_update", "read", "write"};
+
+	//! Upper bounds of the Prometheus buckets in nanoseconds and as printed in seconds
+	const std::uint64_t bucketLimits[] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000,
+										  500000, 1000000, 2500000, 5000000, 10000000, 25000000, 50000000,
+										  100000000, 250000000, 500000000, 1000000000, 2500000000, 5000000000,
+										  10000000000};
+	const char *const bucketLabels[] = {"1e-07", "2.5e-07", "5e-07", "1e-06", "2.5e-06", "5e-06", "1e-05", "2.5e-05",
+										"5e-05", "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01",
+										"0.025", "0.05", "0.1", "0.25", "0.5", "1", "2.5", "5", "10"};
+}
+
+/**
+ * \brief		: Counters of one thread, written by that thread only
+ */
+struct OperationMetrics::Shard
+{
+	std::array<std::array<std::atomic<std::uint64_t>, LatencyHistogram::bucketCount>, OPERATION_COUNT> buckets;
+	std::array<std::atomic<std::uint64_t>, OPERATION_COUNT> sums;
+
+	Shard()
+	{
+		for (auto &operationBuckets: buckets)
+		{
+			for (std::atomic<std::uint64_t> &bucket: operationBuckets)
+			{
+				bucket.store(0, std::memory_order_relaxed);
+			}
+		}
+		for (std::atomic<std::uint64_t> &sum: sums)
+		{
+			sum.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+
+std::atomic<std::uint64_t> OperationMetrics::nextId {1};
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor, recording is enabled
+ */
+OperationMetrics::OperationMetrics()
+	: id{nextId.fetch_add(1)}, enabled{true}
+{
+}
+
+/**
+ * \brief		: Destructor
+ */
+OperationMetrics::~OperationMetrics()
+{
+}
+
+/**
+ * \brief		: Method to switch the recording on or off
+ * \param[IN]	: bool enabled - false to skip the clock reads of the timers
+ * \return		: NONE
+ */
+void OperationMetrics::setEnabled(bool enabled)
+{
+	this->enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * \brief		: Method to check if recording is on
+ * \param		: NONE
+ * \return		: bool - true if the timers record
+ */
+bool OperationMetrics::isEnabled() const
+{
+	return enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief		: Helper method to get the shard of the calling thread
+ * \param		: NONE
+ * \return		: Shard& - shard, registered on the first call of the thread
+ */
+OperationMetrics::Shard& OperationMetrics::getShard()
+{
+	//! Ids are never reused, a cached shard of destroyed metrics is never matched
+	static thread_local std::uint64_t cachedId = 0;
+	static thread_local Shard *cachedShard = nullptr;
+
+	if (cachedId != id)
+	{
+		std::lock_guard<std::mutex> guard(shardsLock);
+		std::unique_ptr<Shard> &shard = shards[std::this_thread::get_id()];
+		if (!shard)
+		{
+			shard.reset(new Shard);
+		}
+		cachedId = id;
+		cachedShard = shard.get();
+	}
+	return *cachedShard;
+}
+
+/**
+ * \brief		: Method to count an operation
+ * \param[IN]	: Operation operation - operation
+ * \param[IN]	: std::uint64_t nanoseconds - duration
+ * \return		: NONE
+ */
+void OperationMetrics::record(Operation operation, std::uint64_t nanoseconds)
+{
+	Shard &shard = getShard();
+
+	//! Single writer, a load and a store instead of a locked read-modify-write
+	std::atomic<std::uint64_t> &bucket = shard.buckets[operation][LatencyHistogram::getBucket(nanoseconds)];
+	bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	std::atomic<std::uint64_t> &sum = shard.sums[operation];
+	sum.store(sum.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+}
+
+/**
+ * \brief		: Method to get the merged histogram of an operation
+ * \param[IN]	: Operation operation - operation
+ * \return		: LatencyHistogram - all durations recorded so far by all threads
+ */
+LatencyHistogram OperationMetrics::getHistogram(Operation operation) const
+{
+	LatencyHistogram histogram;
+	std::lock_guard<std::mutex> guard(shardsLock);
+
+	for (const auto &shard: shards)
+	{
+		for (std::size_t bucket = 0; bucket < LatencyHistogram::bucketCount; bucket++)
+		{
+			std::uint64_t count = shard.second->buckets[operation][bucket].load(std::memory_order_relaxed);
+			if (count != 0)
+			{
+				histogram.addBucket(bucket, count);
+			}
+		}
+		histogram.addSum(shard.second->sums[operation].load(std::memory_order_relaxed));
+	}
+	return histogram;
+}
+
+/**
+ * \brief		: Method to write count, mean, percentiles and maximum per operation as JSON
+ * \param[IN]	: std::ostream &out - stream, gets one object keyed by operation name
+ * \return		: NONE
+ */
+void OperationMetrics::writeJson(std::ostream &out) const
+{
+	out << "{";
+	for (int operation = 0; operation < OPERATION_COUNT; operation++)
+	{
+		LatencyHistogram histogram = getHistogram(static_cast<Operation>(operation));
+		out << (operation > 0 ? "," : "") << "\"" << operationNames[operation] << "\":{\"count\":" << histogram.getCount()
+			<< ",\"meanNs\":" << (histogram.getCount() > 0 ? histogram.getSum() / histogram.getCount() : 0)
+			<< ",\"p50Ns\":" << histogram.getValueAtPercentile(50)
+			<< ",\"p90Ns\":" << histogram.getValueAtPercentile(90)
+			<< ",\"p99Ns\":" << histogram.getValueAtPercentile(99)
+			<< ",\"p999Ns\":" << histogram.getValueAtPercentile(99.9)
+			<< ",\"maxNs\":" << histogram.getMax() << "}";
+	}
+	out << "}";
+}
+
+/**
+ * \brief		: Method to write the histograms in the Prometheus text format
+ * \details		: One histogram studentdb_operation_duration_seconds labelled by operation,
+ *				  with buckets from 100 ns to 10 s; _count is the number of operations
+ * \param[IN]	: std::ostream &out - stream
+ * \return		: NONE
+ */
+void OperationMetrics::writePrometheus(std::ostream &out) const
+{
+	out << "# HELP studentdb_operation_duration_seconds Duration of the StudentDb operations.\n"
+		<< "# TYPE studentdb_operation_duration_seconds histogram\n";
+
+	for (int operation = 0; operation < OPERATION_COUNT; operation++)
+	{
+		LatencyHistogram histogram = getHistogram(static_cast<Operation>(operation));
+		std::string label = std::string("{operation=\"") + operationNames[operation] + "\"";
+
+		for (std::size_t limit = 0; limit < sizeof bucketLimits / sizeof bucketLimits[0]; limit++)
+		{
+			out << "studentdb_operation_duration_seconds_bucket" << label << ",le=\"" << bucketLabels[limit] << "\"} "
+				<< histogram.getCountAtOrBelow(bucketLimits[limit]) << "\n";
+		}
+		out << "studentdb_operation_duration_seconds_bucket" << label << ",le=\"+Inf\"} " << histogram.getCount() << "\n"
+			<< "studentdb_operation_duration_seconds_sum" << label << "} " << histogram.getSum() / 1e9 << "\n"
+			<< "studentdb_operation_duration_seconds_count" << label << "} " << histogram.getCount() << "\n";
+	}
+}
+
+/**
+ * \brief		: Method to get the name of an operation
+ * \param[IN]	: Operation operation - operation
+ * \return		: const char* - lower case name, e.g. "grade_update"
+ */
+const char* OperationMetrics::getOperationName(Operation operation)
+{
+	return operation < OPERATION_COUNT ? operationNames[operation] : "";
+}
@@ -0,0 +1,196 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file OperationMetrics.h
+ *	\brief Header file for OperationMetrics class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef OPERATIONMETRICS_H_
+#define OPERATIONMETRICS_H_
+
+//! System Includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+
+//! User Includes
+#include "LatencyHistogram.h"
+
+/**
+ * \brief		: Counts and latency histograms of the operations of a database
+ * \details		: Every thread records into a shard of its own, found through a thread local
+ *				  pointer, so recording takes no lock and touches no cache line of another
+ *				  thread. The counters of a shard are atomics with a single writer that are
+ *				  incremented by a relaxed load and store, readers merge all shards into
+ *				  LatencyHistograms at any time. A thread locks once per database to register
+ *				  its shard. Shards stay until the metrics are destroyed.
+ *
+ *				  An operation called from inside another one (read adds enrollments) is
+ *				  counted in the outer operation only.
+ */
+class OperationMetrics
+{
+public:
+
+	/**
+	 * \brief		: Measured operations
+	 */
+	enum Operation
+	{
+		LOOKUP,				//!< isStudentExists, getStudent
+		SEARCH,				//!< findStudents, searchStudents, findStudentsFuzzy
+		ENROLL,				//!< addEnrollmentToStudent
+		GRADE_UPDATE,		//!< updateStudentGradeInDb
+		READ,				//!< read
+		WRITE,				//!< write
+		OPERATION_COUNT
+	};
+
+	/**
+	 * \brief		: Measures an operation from its construction to its destruction
+	 */
+	class Timer
+	{
+	private:
+
+		OperationMetrics &metrics;
+		Operation operation;
+		bool outermost;
+		std::chrono::steady_clock::time_point start;
+
+	public:
+
+		Timer(OperationMetrics &metrics, Operation operation)
+			: metrics{metrics}, operation{operation}, outermost{activeTimers++ == 0 && metrics.isEnabled()}
+		{
+			if (outermost)
+			{
+				start = std::chrono::steady_clock::now();
+			}
+		}
+
+		~Timer()
+		{
+			activeTimers--;
+			if (outermost)
+			{
+				std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+				metrics.record(operation, static_cast<std::uint64_t>(elapsed.count()));
+			}
+		}
+
+		Timer(const Timer&) = delete;
+		Timer& operator=(const Timer&) = delete;
+	};
+
+private:
+
+	/**
+	 * \brief		: Counters of one thread
+	 */
+	struct Shard;
+
+	/**
+	 * \brief		: Timers running on the thread, only the outermost one records
+	 */
+	static inline thread_local unsigned int activeTimers = 0;
+
+	/**
+	 * \brief		: Source of the ids, a thread caches its shard by the id of the metrics
+	 */
+	static std::atomic<std::uint64_t> nextId;
+
+	std::uint64_t id;
+	std::atomic<bool> enabled;
+
+	/**
+	 * \brief		: Shards of all threads that recorded, guarded by shardsLock
+	 */
+	mutable std::mutex shardsLock;
+	std::unordered_map<std::thread::id, std::unique_ptr<Shard>> shards;
+
+	/**
+	 * \brief		: Helper method to get the shard of the calling thread
+	 * \param		: NONE
+	 * \return		: Shard& - shard, registered on the first call of the thread
+	 */
+	Shard& getShard();
+
+public:
+
+	/**
+	 * \brief		: Constructor, recording is enabled
+	 */
+	OperationMetrics();
+
+	/**
+	 * \brief		: Destructor
+	 */
+	~OperationMetrics();
+
+	OperationMetrics(const OperationMetrics&) = delete;
+	OperationMetrics& operator=(const OperationMetrics&) = delete;
+
+	/**
+	 * \brief		: Method to switch the recording on or off
+	 * \param[IN]	: bool enabled - false to skip the clock reads of the timers
+	 * \return		: NONE
+	 */
+	void setEnabled(bool enabled);
+
+	/**
+	 * \brief		: Method to check if recording is on
+	 * \param		: NONE
+	 * \return		: bool - true if the timers record
+	 */
+	bool isEnabled() const;
+
+	/**
+	 * \brief		: Method to count an operation
+	 * \param[IN]	: Operation operation - operation
+	 * \param[IN]	: std::uint64_t nanoseconds - duration
+	 * \return		: NONE
+	 */
+	void record(Operation operation, std::uint64_t nanoseconds);
+
+	/**
+	 * \brief		: Method to get the merged histogram of an operation
+	 * \param[IN]	: Operation operation - operation
+	 * \return		: LatencyHistogram - all durations recorded so far by all threads
+	 */
+	LatencyHistogram getHistogram(Operation operation) const;
+
+	/**
+	 * \brief		: Method to write count, mean, percentiles and maximum per operation as JSON
+	 * \param[IN]	: std::ostream &out - stream, gets one object keyed by operation name
+	 * \return		: NONE
+	 */
+	void writeJson(std::ostream &out) const;
+
+	/**
+	 * \brief		: Method to write the histograms in the Prometheus text format
+	 * \details		: One histogram studentdb_operation_duration_seconds labelled by operation,
+	 *				  with buckets from 100 ns to 10 s; _count is the number of operations
+	 * \param[IN]	: std::ostream &out - stream
+	 * \return		: NONE
+	 */
+	void writePrometheus(std::ostream &out) const;
+
+	/**
+	 * \brief		: Method to get the name of an operation
+	 * \param[IN]	: Operation operation - operation
+	 * \return		: const char* - lower case name, e.g. "grade_update"
+	 */
+	static const char* getOperationName(Operation operation);
+};
+
+#endif /* OPERATIONMETRICS_H_ */
@@ -0,0 +1,474 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ReplicationFollower.cpp
+ *	\brief Source file for ReplicationFollower class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <vector>
+#include <Poco/Exception.h>
+#include <Poco/Timespan.h>
+#include <Poco/Net/SocketAddress.h>
+#include <Poco/Net/StreamSocket.h>
+
+//! User Includes
+#include "ReplicationFollower.h"
+#include "ReplicationLeader.h"
+
+namespace
+{
+	//! Size of one receive
+	const int receiveChunkSize = 64 * 1024;
+
+	//! Receive timeout, bounds the time stop() waits for the thread
+	const Poco::Timespan receiveTimeout(0, 200 * 1000);
+
+	//! Delays between connection attempts
+	const std::chrono::milliseconds minReconnectDelay(100);
+	const std::chrono::milliseconds maxReconnectDelay(5000);
+
+	std::uint64_t currentTimeUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	Poco::Data::Date getDate(ProtocolReader &record)
+	{
+		int year = record.getUInt16();
+		int month = record.getUInt8();
+		int day = record.getUInt8();
+		return Poco::Data::Date(year, month, day);
+	}
+
+	Poco::Data::Time getTime(ProtocolReader &record)
+	{
+		int hour = record.getUInt8();
+		int minute = record.getUInt8();
+		int second = record.getUInt8();
+		return Poco::Data::Time(hour, minute, second);
+	}
+
+	Student getStudent(ProtocolReader &record)
+	{
+		unsigned int matrikelNumber = record.getUInt32();
+		std::string firstName = record.getString();
+		std::string lastName = record.getString();
+		Poco::Data::Date dateOfBirth = getDate(record);
+		std::string street = record.getString();
+		unsigned short postalCode = record.getUInt16();
+		std::string city = record.getString();
+		std::string additionalInfo = record.getString();
+
+		return Student(matrikelNumber, firstName, lastName, dateOfBirth, Address(street, postalCode, city, additionalInfo));
+	}
+
+	//! Ends the current connection, the follower reconnects from its last applied record
+	class ReplicationGap : public std::runtime_error
+	{
+	public:
+		ReplicationGap()
+			: std::runtime_error("Gap in the replication stream")
+		{}
+	};
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: StudentDb &studentDb - database the records are applied to
+ * \param[IN]	: const std::string &leaderHost - host name of the leader
+ * \param[IN]	: unsigned short leaderPort - replication port of the leader
+ */
+ReplicationFollower::ReplicationFollower(StudentDb &studentDb, const std::string &leaderHost, unsigned short leaderPort)
+	: studentDb{studentDb}, leaderHost{leaderHost}, leaderPort{leaderPort}, running{false}, connected{false},
+	  logId{0}, appliedSequence{0}, leaderSequence{0}, lagMicroseconds{0}
+{}
+
+/**
+ * \brief		: Method to start the background thread
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationFollower::start()
+{
+	if (!running)
+	{
+		running = true;
+		worker = std::thread(&ReplicationFollower::run, this);
+	}
+}
+
+/**
+ * \brief		: Method to stop the background thread
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationFollower::stop()
+{
+	running = false;
+	if (worker.joinable())
+	{
+		worker.join();
+	}
+}
+
+/**
+ * \brief		: Body of the background thread, connects and reconnects until stopped
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationFollower::run()
+{
+	std::chrono::milliseconds reconnectDelay = minReconnectDelay;
+
+	while (running)
+	{
+		std::uint64_t appliedBefore = appliedSequence;
+
+		try
+		{
+			follow();
+		}
+		catch (ReplicationGap &e)
+		{
+			std::cerr << e.what() << ", reconnecting" << std::endl;
+		}
+		catch (Poco::Exception &e)
+		{
+			//! Leader not reachable or connection lost
+		}
+		catch (std::exception &e)
+		{
+			std::cerr << "Replication failed: " << e.what() << std::endl;
+		}
+		connected = false;
+
+		//! Back off while the leader is down, retry at once after a connection that made progress
+		reconnectDelay = (appliedSequence != appliedBefore) ? minReconnectDelay
+						: std::min(reconnectDelay * 2, maxReconnectDelay);
+
+		auto wakeUp = std::chrono::steady_clock::now() + reconnectDelay;
+		while (running && std::chrono::steady_clock::now() < wakeUp)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		}
+	}
+}
+
+/**
+ * \brief		: Helper method to receive and apply records of one connection
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationFollower::follow()
+{
+	Poco::Net::StreamSocket socket(Poco::Net::SocketAddress(leaderHost, leaderPort));
+	socket.setNoDelay(true);
+	socket.setReceiveTimeout(receiveTimeout);
+
+	ProtocolWriter handshake;
+	handshake.putUInt64(logId);
+	handshake.putUInt64(appliedSequence + 1);
+	socket.sendBytes(handshake.getBuffer().data(), static_cast<int>(handshake.getBuffer().size()));
+
+	std::string buffer;
+	std::vector<char> chunk(receiveChunkSize);
+	bool haveLogId = false;
+	std::uint64_t leaderLogId = 0;
+	bool snapshotting = false;
+
+	connected = true;
+
+	while (running)
+	{
+		int bytes {};
+		try
+		{
+			bytes = socket.receiveBytes(chunk.data(), receiveChunkSize);
+		}
+		catch (Poco::TimeoutException &e)
+		{
+			continue;
+		}
+		if (bytes <= 0)
+		{
+			return;
+		}
+		buffer.append(chunk.data(), bytes);
+
+		std::size_t position = 0;
+
+		//! The first 8 bytes are the log id of the leader, another log starts with a snapshot
+		if (!haveLogId)
+		{
+			if (buffer.size() < 8)
+			{
+				continue;
+			}
+			ProtocolReader reply(buffer.data(), 8);
+			leaderLogId = reply.getUInt64();
+			haveLogId = true;
+			position = 8;
+		}
+
+		//! Apply all complete records of this receive under one lock
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock(), std::defer_lock);
+		std::uint64_t appliedBefore = appliedSequence;
+
+		while (buffer.size() - position >= 4)
+		{
+			ProtocolReader lengthReader(buffer.data() + position, 4);
+			std::size_t length = lengthReader.getUInt32();
+			if (buffer.size() - position - 4 < length)
+			{
+				break;
+			}
+
+			ProtocolReader record(buffer.data() + position + 4, length);
+			position += 4 + length;
+
+			std::uint64_t sequence = record.getUInt64();
+			std::uint64_t leaderTimeUs = record.getUInt64();
+			std::uint8_t type = record.getUInt8();
+
+			if (type == static_cast<std::uint8_t>(ReplicationRecordType::HEARTBEAT))
+			{
+				leaderSequence = sequence;
+				continue;
+			}
+
+			if (!writeLock.owns_lock())
+			{
+				writeLock.lock();
+			}
+
+			//! Until SNAPSHOT_END the database matches no position of any log
+			if (type == static_cast<std::uint8_t>(ReplicationRecordType::SNAPSHOT_BEGIN))
+			{
+				studentDb.clear();
+				logId = 0;
+				appliedSequence = 0;
+				snapshotting = true;
+				continue;
+			}
+			if (type == static_cast<std::uint8_t>(ReplicationRecordType::SNAPSHOT_END))
+			{
+				if (!snapshotting)
+				{
+					throw ReplicationGap();
+				}
+				logId = leaderLogId;
+				appliedSequence = sequence;
+				leaderSequence = std::max<std::uint64_t>(leaderSequence, sequence);
+				snapshotting = false;
+				continue;
+			}
+			if (snapshotting)
+			{
+				applyRecord(record, type);
+				continue;
+			}
+
+			if (logId != leaderLogId)
+			{
+				throw ReplicationGap();
+			}
+			if (sequence <= appliedSequence)
+			{
+				continue;
+			}
+			if (sequence != appliedSequence + 1)
+			{
+				throw ReplicationGap();
+			}
+
+			applyRecord(record, type);
+
+			appliedSequence = sequence;
+			leaderSequence = std::max<std::uint64_t>(leaderSequence, sequence);
+			std::uint64_t now = currentTimeUs();
+			lagMicroseconds = now > leaderTimeUs ? now - leaderTimeUs : 0;
+		}
+
+		buffer.erase(0, position);
+		if (writeLock.owns_lock())
+		{
+			writeLock.unlock();
+		}
+
+		//! Lets the leader drop the records this follower no longer needs
+		if (appliedSequence != appliedBefore)
+		{
+			ProtocolWriter acknowledgement;
+			acknowledgement.putUInt64(appliedSequence);
+			socket.sendBytes(acknowledgement.getBuffer().data(), static_cast<int>(acknowledgement.getBuffer().size()));
+		}
+	}
+}
+
+/**
+ * \brief		: Helper method to apply one record, the caller holds the exclusive lock
+ * \param[IN]	: ProtocolReader &record - record after the sequence number and time
+ * \param[IN]	: std::uint8_t type - record type
+ * \return		: NONE
+ */
+void ReplicationFollower::applyRecord(ProtocolReader &record, std::uint8_t type)
+{
+	switch (static_cast<ReplicationRecordType>(type))
+	{
+		case ReplicationRecordType::CLEAR:
+		{
+			studentDb.clear();
+			break;
+		}
+
+		case ReplicationRecordType::COURSE:
+		{
+			std::uint8_t kind = record.getUInt8();
+			unsigned int courseKey = record.getUInt32();
+			std::string title = record.getString();
+			unsigned char major = record.getUInt8();
+			float creditPoints = record.getFloat();
+
+			if (kind == 'W')
+			{
+				Poco::DateTime::DaysOfWeek dayOfWeek = static_cast<Poco::DateTime::DaysOfWeek>(record.getUInt8());
+				Poco::Data::Time startTime = getTime(record);
+				Poco::Data::Time endTime = getTime(record);
+				studentDb.addWeeklyCourseToDb(WeeklyCourse(courseKey, title, major, creditPoints, dayOfWeek, startTime, endTime));
+			}
+			else
+			{
+				Poco::Data::Date startDate = getDate(record);
+				Poco::Data::Date endDate = getDate(record);
+				Poco::Data::Time startTime = getTime(record);
+				Poco::Data::Time endTime = getTime(record);
+				studentDb.addBlockCourseToDb(BlockCourse(courseKey, title, major, creditPoints, startDate, endDate, startTime, endTime));
+			}
+			break;
+		}
+
+		case ReplicationRecordType::STUDENT_ADDED:
+		{
+			Student student = getStudent(record);
+			studentDb.addStudentToDb(student);
+			break;
+		}
+
+		case ReplicationRecordType::STUDENT_UPDATED:
+		{
+			Student student = getStudent(record);
+			unsigned int matrikelNumber = student.getMatrikelNumber();
+			studentDb.updateFirstName(matrikelNumber, student.getFirstName());
+			studentDb.updateLastName(matrikelNumber, student.getLastName());
+			studentDb.updateDateOfBirth(matrikelNumber, student.getDateOfBirth());
+			studentDb.updateAddress(matrikelNumber, student.getAddress());
+			break;
+		}
+
+		case ReplicationRecordType::ENROLLMENT_ADDED:
+		{
+			unsigned int matrikelNumber = record.getUInt32();
+			unsigned int courseKey = record.getUInt32();
+			std::string semester = record.getString();
+			//! The leader has checked the timetable, a loaded file may hold clashes
+			studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, semester, true);
+			break;
+		}
+
+		case ReplicationRecordType::GRADE_UPDATED:
+		{
+			unsigned int matrikelNumber = record.getUInt32();
+			unsigned int courseKey = record.getUInt32();
+			float grade = record.getFloat();
+			studentDb.updateStudentGradeInDb(matrikelNumber, courseKey, grade);
+			break;
+		}
+
+		case ReplicationRecordType::ENROLLMENT_DELETED:
+		{
+			unsigned int matrikelNumber = record.getUInt32();
+			unsigned int courseKey = record.getUInt32();
+			studentDb.deleteEnrollmentFromStudent(matrikelNumber, courseKey);
+			break;
+		}
+
+		default:
+			//! Unknown record of a newer leader, skipped
+			break;
+	}
+}
+
+/**
+ * \brief		: Getter method for the connection state
+ * \param		: NONE
+ * \return		: bool - true while connected to the leader
+ */
+bool ReplicationFollower::isConnected() const
+{
+	return connected;
+}
+
+/**
+ * \brief		: Getter method for the sequence number of the last applied record
+ * \param		: NONE
+ * \return		: std::uint64_t - sequence number
+ */
+std::uint64_t ReplicationFollower::getAppliedSequence() const
+{
+	return appliedSequence;
+}
+
+/**
+ * \brief		: Getter method for the last known sequence number of the leader
+ * \param		: NONE
+ * \return		: std::uint64_t - sequence number
+ */
+std::uint64_t ReplicationFollower::getLeaderSequence() const
+{
+	return leaderSequence;
+}
+
+/**
+ * \brief		: Getter method for the number of records the follower is behind
+ * \param		: NONE
+ * \return		: std::uint64_t - number of records
+ */
+std::uint64_t ReplicationFollower::getLagRecords() const
+{
+	std::uint64_t leader = leaderSequence;
+	std::uint64_t applied = appliedSequence;
+	return leader > applied ? leader - applied : 0;
+}
+
+/**
+ * \brief		: Getter method for the delay of the last applied record
+ * \param		: NONE
+ * \return		: std::uint64_t - microseconds between leader and follower applying it
+ */
+std::uint64_t ReplicationFollower::getLagMicroseconds() const
+{
+	return lagMicroseconds;
+}
+
+/**
+ * \brief		: Destructor, stops the background thread
+ */
+ReplicationFollower::~ReplicationFollower()
+{
+	stop();
+}
@@ -0,0 +1,173 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ReplicationFollower.h
+ *	\brief Header file for ReplicationFollower class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef REPLICATIONFOLLOWER_H_
+#define REPLICATIONFOLLOWER_H_
+
+//! System Includes
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+//! User Includes
+#include "StudentDb.h"
+#include "StudentDbProtocol.h"
+
+/**
+ * \brief		: Reader side of the replication, applies the log of a ReplicationLeader
+ * \details		: A background thread connects to the leader, receives the records the
+ *				  local database has not seen yet and applies them in order through the
+ *				  StudentDb methods, all records of one receive under one exclusive lock.
+ *				  The connection is re-established with a growing delay when it breaks;
+ *				  the follower resumes after its last applied record, or is sent a snapshot
+ *				  if the leader has dropped the records it needs. Applied records are
+ *				  acknowledged to the leader. The database must not be changed by anyone
+ *				  else, serve it read only.
+ */
+class ReplicationFollower
+{
+private:
+
+	/**
+	 * \brief		: Database the records are applied to
+	 */
+	StudentDb &studentDb;
+
+	/**
+	 * \brief		: Host name and port of the leader
+	 */
+	std::string leaderHost;
+	unsigned short leaderPort;
+
+	/**
+	 * \brief		: Cleared to end the background thread
+	 */
+	std::atomic<bool> running;
+
+	/**
+	 * \brief		: Set while a connection to the leader exists
+	 */
+	std::atomic<bool> connected;
+
+	/**
+	 * \brief		: Id of the leader log the applied records belong to
+	 */
+	std::uint64_t logId;
+
+	/**
+	 * \brief		: Sequence number of the last applied record
+	 */
+	std::atomic<std::uint64_t> appliedSequence;
+
+	/**
+	 * \brief		: Last sequence number of the leader, from records and heartbeats
+	 */
+	std::atomic<std::uint64_t> leaderSequence;
+
+	/**
+	 * \brief		: Time between the leader writing and the follower applying the last record
+	 */
+	std::atomic<std::uint64_t> lagMicroseconds;
+
+	/**
+	 * \brief		: Background thread
+	 */
+	std::thread worker;
+
+	/**
+	 * \brief		: Body of the background thread, connects and reconnects until stopped
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void run();
+
+	/**
+	 * \brief		: Helper method to receive and apply records of one connection
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void follow();
+
+	/**
+	 * \brief		: Helper method to apply one record, the caller holds the exclusive lock
+	 * \param[IN]	: ProtocolReader &record - record after the sequence number and time
+	 * \param[IN]	: std::uint8_t type - record type
+	 * \return		: NONE
+	 */
+	void applyRecord(ProtocolReader &record, std::uint8_t type);
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: StudentDb &studentDb - database the records are applied to
+	 * \param[IN]	: const std::string &leaderHost - host name of the leader
+	 * \param[IN]	: unsigned short leaderPort - replication port of the leader
+	 */
+	ReplicationFollower(StudentDb &studentDb, const std::string &leaderHost, unsigned short leaderPort);
+
+	/**
+	 * \brief		: Method to start the background thread
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void start();
+
+	/**
+	 * \brief		: Method to stop the background thread
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void stop();
+
+	/**
+	 * \brief		: Getter method for the connection state
+	 * \param		: NONE
+	 * \return		: bool - true while connected to the leader
+	 */
+	bool isConnected() const;
+
+	/**
+	 * \brief		: Getter method for the sequence number of the last applied record
+	 * \param		: NONE
+	 * \return		: std::uint64_t - sequence number
+	 */
+	std::uint64_t getAppliedSequence() const;
+
+	/**
+	 * \brief		: Getter method for the last known sequence number of the leader
+	 * \param		: NONE
+	 * \return		: std::uint64_t - sequence number
+	 */
+	std::uint64_t getLeaderSequence() const;
+
+	/**
+	 * \brief		: Getter method for the number of records the follower is behind
+	 * \param		: NONE
+	 * \return		: std::uint64_t - number of records
+	 */
+	std::uint64_t getLagRecords() const;
+
+	/**
+	 * \brief		: Getter method for the delay of the last applied record
+	 * \param		: NONE
+	 * \return		: std::uint64_t - microseconds between leader and follower applying it
+	 */
+	std::uint64_t getLagMicroseconds() const;
+
+	/**
+	 * \brief		: Destructor, stops the background thread
+	 */
+	~ReplicationFollower();
+};
+
+#endif /* REPLICATIONFOLLOWER_H_ */
@@ -0,0 +1,701 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ReplicationLeader.cpp
+ *	\brief Source file for ReplicationLeader class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <shared_mutex>
+#include <stdexcept>
+#include <Poco/Exception.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+#include <Poco/Net/TCPServerParams.h>
+
+//! User Includes
+#include "ReplicationLeader.h"
+
+namespace
+{
+	//! Largest batch of records sent in one write
+	const std::size_t maxBatchSize = 256 * 1024;
+
+	//! Followers served at the same time, further ones wait in the queue of the server
+	const int maxFollowers = 16;
+
+	//! Time without records after which a heartbeat is sent
+	const std::chrono::milliseconds heartbeatInterval(100);
+
+	std::uint64_t currentTimeUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	void putDate(ProtocolWriter &record, const Poco::Data::Date &date)
+	{
+		record.putUInt16(static_cast<std::uint16_t>(date.year()));
+		record.putUInt8(static_cast<std::uint8_t>(date.month()));
+		record.putUInt8(static_cast<std::uint8_t>(date.day()));
+	}
+
+	void putTime(ProtocolWriter &record, const Poco::Data::Time &time)
+	{
+		record.putUInt8(static_cast<std::uint8_t>(time.hour()));
+		record.putUInt8(static_cast<std::uint8_t>(time.minute()));
+		record.putUInt8(static_cast<std::uint8_t>(time.second()));
+	}
+
+	void putStudent(ProtocolWriter &record, const Student &student)
+	{
+		const Address &address = student.getAddress();
+
+		record.putUInt32(student.getMatrikelNumber());
+		record.putString(student.getFirstName());
+		record.putString(student.getLastName());
+		putDate(record, student.getDateOfBirth());
+		record.putString(address.getStreet());
+		record.putUInt16(address.getPostalCode());
+		record.putString(address.getCityName());
+		record.putString(address.getAdditionalInfo());
+	}
+
+	void putCourse(ProtocolWriter &record, const Course &course)
+	{
+		const WeeklyCourse *weeklyCourse = dynamic_cast<const WeeklyCourse*>(&course);
+		const BlockCourse *blockCourse = dynamic_cast<const BlockCourse*>(&course);
+
+		record.putUInt8(weeklyCourse ? 'W' : 'B');
+		record.putUInt32(course.getCourseKey());
+		record.putString(course.getTitle());
+		record.putUInt8(course.getMajor());
+		record.putFloat(course.getCreditPoints());
+
+		if (weeklyCourse)
+		{
+			record.putUInt8(static_cast<std::uint8_t>(weeklyCourse->getDayOfWeek()));
+			putTime(record, weeklyCourse->getStartTime());
+			putTime(record, weeklyCourse->getEndTime());
+		}
+		else if (blockCourse)
+		{
+			putDate(record, blockCourse->getStartDate());
+			putDate(record, blockCourse->getEndDate());
+			putTime(record, blockCourse->getStartTime());
+			putTime(record, blockCourse->getEndTime());
+		}
+	}
+
+	/**
+	 * \brief		: Registers a follower connection with the leader for its lifetime
+	 */
+	class FollowerRegistration
+	{
+	private:
+		ReplicationLeader &leader;
+		std::uint64_t followerId;
+
+	public:
+		FollowerRegistration(ReplicationLeader &leader, const Poco::Net::StreamSocket &socket)
+			: leader{leader}, followerId{leader.addFollower(socket)}
+		{}
+
+		~FollowerRegistration()
+		{
+			leader.removeFollower(followerId);
+		}
+
+		std::uint64_t getId() const
+		{
+			return followerId;
+		}
+	};
+
+	/**
+	 * \brief		: Streams the log to one follower
+	 */
+	class ReplicationConnection : public Poco::Net::TCPServerConnection
+	{
+	private:
+		ReplicationLeader &leader;
+
+		void sendAll(const std::string &data)
+		{
+			std::size_t sent = 0;
+			while (sent < data.size())
+			{
+				int bytes = socket().sendBytes(data.data() + sent, static_cast<int>(data.size() - sent));
+				if (bytes <= 0)
+				{
+					throw std::runtime_error("Follower disconnected");
+				}
+				sent += bytes;
+			}
+		}
+
+		//! Reads the acknowledgements that have arrived without blocking, keeps partial ones
+		void receiveAcknowledgements(std::uint64_t followerId, std::string &pending)
+		{
+			char chunk[256];
+			int available = socket().available();
+			while (available > 0)
+			{
+				int bytes = socket().receiveBytes(chunk, std::min<int>(available, sizeof(chunk)));
+				if (bytes <= 0)
+				{
+					throw std::runtime_error("Follower disconnected");
+				}
+				pending.append(chunk, bytes);
+				available -= bytes;
+			}
+
+			//! Only the latest one counts
+			std::size_t complete = pending.size() / 8 * 8;
+			if (complete > 0)
+			{
+				ProtocolReader reader(pending.data() + complete - 8, 8);
+				leader.acknowledge(followerId, reader.getUInt64());
+				pending.erase(0, complete);
+			}
+		}
+
+	public:
+		ReplicationConnection(const Poco::Net::StreamSocket &socket, ReplicationLeader &leader)
+			: Poco::Net::TCPServerConnection(socket), leader{leader}
+		{}
+
+		void run() override
+		{
+			FollowerRegistration registration(leader, socket());
+
+			//! Handshake, the follower sends its log id and the first sequence number it needs
+			char handshake[16];
+			int received = 0;
+			while (received < 16)
+			{
+				int bytes = socket().receiveBytes(handshake + received, 16 - received);
+				if (bytes <= 0)
+				{
+					return;
+				}
+				received += bytes;
+			}
+			ProtocolReader reader(handshake, sizeof(handshake));
+			std::uint64_t followerLogId = reader.getUInt64();
+			std::uint64_t nextSequence = reader.getUInt64();
+
+			//! A follower of another log or ahead of this one is rebuilt from a snapshot
+			if (followerLogId != leader.getLogId() || nextSequence == 0 || nextSequence > leader.getLastSequence() + 1)
+			{
+				nextSequence = 0;
+			}
+			else
+			{
+				leader.acknowledge(registration.getId(), nextSequence - 1);
+			}
+
+			socket().setNoDelay(true);
+			ProtocolWriter reply;
+			reply.putUInt64(leader.getLogId());
+			std::string batch = reply.getBuffer();
+			std::string acknowledgements;
+
+			try
+			{
+				sendAll(batch);
+				batch.clear();
+
+				while (leader.waitForRecords(nextSequence, batch, heartbeatInterval))
+				{
+					if (batch.empty())
+					{
+						nextSequence = leader.writeSnapshot(registration.getId(), batch) + 1;
+					}
+					sendAll(batch);
+					batch.clear();
+					receiveAcknowledgements(registration.getId(), acknowledgements);
+				}
+			}
+			catch (std::exception &e)
+			{
+				//! Follower went away, it reconnects with its own position
+			}
+		}
+	};
+
+	/**
+	 * \brief		: Creates a connection handler per follower
+	 */
+	class ReplicationConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+	{
+	private:
+		ReplicationLeader &leader;
+
+	public:
+		ReplicationConnectionFactory(ReplicationLeader &leader)
+			: leader{leader}
+		{}
+
+		Poco::Net::TCPServerConnection* createConnection(const Poco::Net::StreamSocket &socket) override
+		{
+			return new ReplicationConnection(socket, leader);
+		}
+	};
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: StudentDb &studentDb - database to replicate
+ * \param[IN]	: unsigned short port - port the followers connect to, 0 picks a free port
+ */
+ReplicationLeader::ReplicationLeader(StudentDb &studentDb, unsigned short port)
+	: studentDb{studentDb}, port{port}, logId{0}, lastSequence{0}, logBytes{0}, nextFollowerId{1}, stopping{false}
+{}
+
+/**
+ * \brief		: Method to start observing the database and accept followers
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationLeader::start()
+{
+	{
+		//! Followers get the state of the start from a snapshot, the log holds the changes after it
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+
+		logId = currentTimeUs();
+		{
+			std::lock_guard<std::mutex> guard(logMutex);
+			log.clear();
+			lastSequence = 0;
+			logBytes = 0;
+			stopping = false;
+		}
+
+		studentDb.addObserver(this);
+	}
+
+	Poco::Net::ServerSocket serverSocket(port);
+	port = serverSocket.address().port();
+
+	Poco::Net::TCPServerParams::Ptr params = new Poco::Net::TCPServerParams;
+	params->setMaxThreads(maxFollowers);
+
+	threadPool.reset(new Poco::ThreadPool(1, maxFollowers));
+	server.reset(new Poco::Net::TCPServer(new ReplicationConnectionFactory(*this), *threadPool, serverSocket, params));
+	server->start();
+}
+
+/**
+ * \brief		: Method to stop observing the database and disconnect the followers
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationLeader::stop()
+{
+	if (!server)
+	{
+		return;
+	}
+
+	{
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+		studentDb.removeObserver(this);
+	}
+	{
+		std::lock_guard<std::mutex> guard(logMutex);
+		stopping = true;
+	}
+	logChanged.notify_all();
+
+	//! No new followers, then wake the connections blocked in sendBytes to a stalled follower
+	server->stop();
+	{
+		std::lock_guard<std::mutex> guard(logMutex);
+		for (auto &eachFollower: followers)
+		{
+			try
+			{
+				eachFollower.second.socket.shutdown();
+			}
+			catch (const Poco::Exception&)
+			{
+			}
+		}
+	}
+	threadPool->joinAll();
+	server.reset();
+	threadPool.reset();
+}
+
+/**
+ * \brief		: Getter method for the port the followers connect to
+ * \param		: NONE
+ * \return		: unsigned short - port
+ */
+unsigned short ReplicationLeader::getPort() const
+{
+	return port;
+}
+
+/**
+ * \brief		: Getter method for the id of the log
+ * \param		: NONE
+ * \return		: std::uint64_t - log id
+ */
+std::uint64_t ReplicationLeader::getLogId() const
+{
+	return logId;
+}
+
+/**
+ * \brief		: Getter method for the sequence number of the last record
+ * \param		: NONE
+ * \return		: std::uint64_t - last sequence number, 0 if the log is empty
+ */
+std::uint64_t ReplicationLeader::getLastSequence()
+{
+	std::lock_guard<std::mutex> guard(logMutex);
+	return lastSequence;
+}
+
+/**
+ * \brief		: Method to wait for records and copy them into a send buffer
+ * \param[INOUT]: std::uint64_t &nextSequence - first record wanted, advanced past the copied records
+ * \param[OUT]	: std::string &batch - buffer the encoded records are appended to
+ * \param[IN]	: std::chrono::milliseconds timeout - longest time to wait for a new record
+ * \return		: bool - false if the leader is stopping
+ */
+bool ReplicationLeader::waitForRecords(std::uint64_t &nextSequence, std::string &batch, std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> guard(logMutex);
+
+	logChanged.wait_for(guard, timeout, [&]() { return stopping || lastSequence >= nextSequence; });
+	if (stopping)
+	{
+		return false;
+	}
+
+	std::uint64_t firstSequence = lastSequence - log.size() + 1;
+	if (nextSequence < firstSequence)
+	{
+		return true;
+	}
+
+	while (nextSequence <= lastSequence && batch.size() < maxBatchSize)
+	{
+		batch.append(log[nextSequence - firstSequence]);
+		nextSequence++;
+	}
+
+	//! Nothing new, tell the follower how far the leader is
+	if (batch.empty())
+	{
+		ProtocolWriter heartbeat;
+		heartbeat.beginFrame();
+		heartbeat.putUInt64(lastSequence);
+		heartbeat.putUInt64(currentTimeUs());
+		heartbeat.putUInt8(static_cast<std::uint8_t>(ReplicationRecordType::HEARTBEAT));
+		heartbeat.endFrame();
+		batch = heartbeat.getBuffer();
+	}
+
+	return true;
+}
+
+/**
+ * \brief		: Method to encode a snapshot of the database for a follower
+ * \param[IN]	: std::uint64_t followerId - follower, acknowledges the snapshot so its successors are kept
+ * \param[OUT]	: std::string &snapshot - buffer the encoded records are appended to
+ * \return		: std::uint64_t - sequence number of the last record contained in the snapshot
+ */
+std::uint64_t ReplicationLeader::writeSnapshot(std::uint64_t followerId, std::string &snapshot)
+{
+	ProtocolWriter records;
+	std::uint64_t sequence {};
+
+	{
+		//! Records are appended under the exclusive lock, none can be added while this one is held
+		std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+		{
+			std::lock_guard<std::mutex> guard(logMutex);
+			sequence = lastSequence;
+			auto follower = followers.find(followerId);
+			if (follower != followers.end())
+			{
+				follower->second.acknowledged = sequence;
+			}
+		}
+
+		beginRecord(records, ReplicationRecordType::SNAPSHOT_BEGIN, sequence);
+		records.endFrame();
+		for (const auto &eachCourse: studentDb.getCourses())
+		{
+			beginRecord(records, ReplicationRecordType::COURSE);
+			putCourse(records, *eachCourse.second);
+			records.endFrame();
+		}
+		for (const auto &eachStudent: studentDb.getStudents())
+		{
+			beginRecord(records, ReplicationRecordType::STUDENT_ADDED);
+			putStudent(records, eachStudent.second);
+			records.endFrame();
+		}
+		for (const auto &eachStudent: studentDb.getStudents())
+		{
+			for (const auto &enrollment: eachStudent.second.getEnrollments())
+			{
+				beginRecord(records, ReplicationRecordType::ENROLLMENT_ADDED);
+				records.putUInt32(eachStudent.first);
+				records.putUInt32(enrollment.getCourse().getCourseKey());
+				records.putString(enrollment.getSemester());
+				records.endFrame();
+
+				beginRecord(records, ReplicationRecordType::GRADE_UPDATED);
+				records.putUInt32(eachStudent.first);
+				records.putUInt32(enrollment.getCourse().getCourseKey());
+				records.putFloat(enrollment.getGrade());
+				records.endFrame();
+			}
+		}
+	}
+
+	beginRecord(records, ReplicationRecordType::SNAPSHOT_END, sequence);
+	records.endFrame();
+	snapshot.append(records.getBuffer());
+	return sequence;
+}
+
+/**
+ * \brief		: Method to register a follower connection, called by its thread when it starts
+ * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+ * \return		: std::uint64_t - id of the follower
+ */
+std::uint64_t ReplicationLeader::addFollower(const Poco::Net::StreamSocket &socket)
+{
+	std::lock_guard<std::mutex> guard(logMutex);
+	std::uint64_t followerId = nextFollowerId++;
+
+	//! Holds no records until the follower tells where it is
+	Follower &follower = followers[followerId];
+	follower.socket = socket;
+	follower.acknowledged = lastSequence;
+	if (stopping)
+	{
+		try
+		{
+			follower.socket.shutdown();
+		}
+		catch (const Poco::Exception&)
+		{
+		}
+	}
+	return followerId;
+}
+
+/**
+ * \brief		: Method to unregister a follower connection, called by its thread when it ends
+ * \param[IN]	: std::uint64_t followerId - id of the follower
+ * \return		: NONE
+ */
+void ReplicationLeader::removeFollower(std::uint64_t followerId)
+{
+	std::lock_guard<std::mutex> guard(logMutex);
+	followers.erase(followerId);
+}
+
+/**
+ * \brief		: Method to record the last sequence number a follower has applied
+ * \param[IN]	: std::uint64_t followerId - id of the follower
+ * \param[IN]	: std::uint64_t sequence - last applied sequence number
+ * \return		: NONE
+ */
+void ReplicationLeader::acknowledge(std::uint64_t followerId, std::uint64_t sequence)
+{
+	std::lock_guard<std::mutex> guard(logMutex);
+	auto follower = followers.find(followerId);
+	if (follower != followers.end())
+	{
+		follower->second.acknowledged = std::min(sequence, lastSequence);
+	}
+}
+
+/**
+ * \brief		: Helper method to start a new record of the given type
+ * \param[OUT]	: ProtocolWriter &record - buffer for the record
+ * \param[IN]	: ReplicationRecordType type - type of the record
+ * \param[IN]	: std::uint64_t sequence - sequence number, 0 if assigned by appendRecord
+ * \return		: NONE
+ */
+void ReplicationLeader::beginRecord(ProtocolWriter &record, ReplicationRecordType type, std::uint64_t sequence)
+{
+	record.beginFrame();
+	record.putUInt64(sequence);
+	record.putUInt64(currentTimeUs());
+	record.putUInt8(static_cast<std::uint8_t>(type));
+}
+
+/**
+ * \brief		: Helper method to close a record and append it to the log
+ * \param[IN]	: ProtocolWriter &record - completed record
+ * \return		: NONE
+ */
+void ReplicationLeader::appendRecord(ProtocolWriter &record)
+{
+	record.endFrame();
+	std::string encoded = record.getBuffer();
+
+	{
+		std::lock_guard<std::mutex> guard(logMutex);
+
+		//! Fill in the sequence number behind the length field
+		std::uint64_t sequence = ++lastSequence;
+		for (int byte = 0; byte < 8; byte++)
+		{
+			encoded[4 + byte] = static_cast<char>(sequence >> (56 - 8 * byte));
+		}
+		logBytes += encoded.size();
+		log.push_back(std::move(encoded));
+		truncateLog();
+	}
+	logChanged.notify_all();
+}
+
+/**
+ * \brief		: Helper method to drop the records no follower needs any more, the caller holds logMutex
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationLeader::truncateLog()
+{
+	std::uint64_t acknowledged = lastSequence;
+	for (const auto &eachFollower: followers)
+	{
+		acknowledged = std::min(acknowledged, eachFollower.second.acknowledged);
+	}
+
+	std::uint64_t firstSequence = lastSequence - log.size() + 1;
+	while (!log.empty() && ((log.size() > retainedRecords && firstSequence <= acknowledged) || logBytes > maxLogBytes))
+	{
+		logBytes -= log.front().size();
+		log.pop_front();
+		firstSequence++;
+	}
+}
+
+/**
+ * \brief		: Observer callback, appends a COURSE record
+ * \param[IN]	: const Course &course - course in the database
+ * \return		: NONE
+ */
+void ReplicationLeader::onCourseAdded (const Course &course)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::COURSE);
+	putCourse(record, course);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends a STUDENT_ADDED record
+ * \param[IN]	: const Student &student - student in the database
+ * \return		: NONE
+ */
+void ReplicationLeader::onStudentAdded (const Student &student)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::STUDENT_ADDED);
+	putStudent(record, student);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends a STUDENT_UPDATED record
+ * \param[IN]	: const Student &student - student in the database
+ * \return		: NONE
+ */
+void ReplicationLeader::onStudentUpdated (const Student &student)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::STUDENT_UPDATED);
+	putStudent(record, student);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends an ENROLLMENT_ADDED record
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: const Enrollment &enrollment - new enrollment
+ * \return		: NONE
+ */
+void ReplicationLeader::onEnrollmentAdded (unsigned int matrikelNumber, const Enrollment &enrollment)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::ENROLLMENT_ADDED);
+	record.putUInt32(matrikelNumber);
+	record.putUInt32(enrollment.getCourse().getCourseKey());
+	record.putString(enrollment.getSemester());
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends a GRADE_UPDATED record
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: unsigned int courseKey - course of the enrollment
+ * \param[IN]	: float grade - new grade
+ * \return		: NONE
+ */
+void ReplicationLeader::onGradeUpdated (unsigned int matrikelNumber, unsigned int courseKey, float grade)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::GRADE_UPDATED);
+	record.putUInt32(matrikelNumber);
+	record.putUInt32(courseKey);
+	record.putFloat(grade);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends an ENROLLMENT_DELETED record
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: unsigned int courseKey - course of the deleted enrollment
+ * \return		: NONE
+ */
+void ReplicationLeader::onEnrollmentDeleted (unsigned int matrikelNumber, unsigned int courseKey)
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::ENROLLMENT_DELETED);
+	record.putUInt32(matrikelNumber);
+	record.putUInt32(courseKey);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Observer callback, appends a CLEAR record
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ReplicationLeader::onCleared ()
+{
+	ProtocolWriter record;
+	beginRecord(record, ReplicationRecordType::CLEAR);
+	appendRecord(record);
+}
+
+/**
+ * \brief		: Destructor, stops the leader
+ */
+ReplicationLeader::~ReplicationLeader()
+{
+	stop();
+}
@@ -0,0 +1,306 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ReplicationLeader.h
+ *	\brief Header file for ReplicationLeader class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ *
+ *  Replication stream
+ *  ------------------
+ *  The follower connects and sends the log id (u64) it has applied records of and the
+ *  sequence number (u64) of the first record it needs. The leader answers with its own
+ *  log id (u64) followed by an endless stream of frames (see StudentDbProtocol.h). The
+ *  follower sends back the sequence number (u64) of its last applied record whenever
+ *  it has applied records, the leader drops records all followers have acknowledged.
+ *
+ *  sequence(u64) leaderTimeUs(u64) type(u8) fields
+ *
+ *  Type               Fields
+ *  CLEAR              -
+ *  COURSE             'W'|'B'(u8) key(u32) title(str) major(u8) creditPoints(f32) schedule
+ *                     W: dayOfWeek(u8) start(time) end(time)
+ *                     B: startDate(date) endDate(date) start(time) end(time)
+ *  STUDENT_ADDED      student
+ *  STUDENT_UPDATED    student
+ *  ENROLLMENT_ADDED   matrikel(u32) courseKey(u32) semester(str)
+ *  GRADE_UPDATED      matrikel(u32) courseKey(u32) grade(f32)
+ *  ENROLLMENT_DELETED matrikel(u32) courseKey(u32)
+ *  HEARTBEAT          -, sequence is the last record of the leader
+ *  SNAPSHOT_BEGIN     -, sequence is the last record contained in the snapshot
+ *  SNAPSHOT_END       -, sequence as in SNAPSHOT_BEGIN
+ *
+ *  student: matrikel(u32) firstName(str) lastName(str) dateOfBirth(date) street(str)
+ *           postalCode(u16) city(str) additionalInfo(str)
+ *  date: year(u16) month(u8) day(u8), time: hour(u8) minute(u8) second(u8)
+ *
+ *  A follower of another log, or one that needs records already dropped from the log,
+ *  is sent a snapshot first: SNAPSHOT_BEGIN, the COURSE, STUDENT_ADDED, ENROLLMENT_ADDED
+ *  and GRADE_UPDATED records of the current database with sequence 0, and SNAPSHOT_END.
+ *  The follower clears its database at SNAPSHOT_BEGIN and continues after the sequence
+ *  of SNAPSHOT_END. A new log id is chosen on every start.
+ */
+/****************************************************************************/
+
+#ifndef REPLICATIONLEADER_H_
+#define REPLICATIONLEADER_H_
+
+//! System Includes
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <Poco/ThreadPool.h>
+#include <Poco/Net/StreamSocket.h>
+#include <Poco/Net/TCPServer.h>
+
+//! User Includes
+#include "StudentDb.h"
+#include "StudentDbObserver.h"
+#include "StudentDbProtocol.h"
+
+/**
+ * \brief		: Record types of the replication stream
+ */
+enum class ReplicationRecordType : std::uint8_t
+{
+	CLEAR				= 1,
+	COURSE				= 2,
+	STUDENT_ADDED		= 3,
+	STUDENT_UPDATED		= 4,
+	ENROLLMENT_ADDED	= 5,
+	GRADE_UPDATED		= 6,
+	ENROLLMENT_DELETED	= 7,
+	HEARTBEAT			= 8,
+	SNAPSHOT_BEGIN		= 9,
+	SNAPSHOT_END		= 10
+};
+
+/**
+ * \brief		: Writer side of the replication, ships the mutation log to followers
+ * \details		: The leader observes the database and appends every change as an encoded
+ *				  record to an in-memory log. Each connected follower is served by its own
+ *				  thread that sends the records it has not seen yet and a heartbeat when idle.
+ *				  The log keeps the records a connected follower has not acknowledged, at
+ *				  least the last retainedRecords for followers that reconnect, and never more
+ *				  than maxLogBytes; a follower behind the first kept record gets a snapshot.
+ */
+class ReplicationLeader : public StudentDbObserver
+{
+private:
+
+	/**
+	 * \brief		: Replicated database
+	 */
+	StudentDb &studentDb;
+
+	/**
+	 * \brief		: Port the followers connect to, 0 picks a free port
+	 */
+	unsigned short port;
+
+	/**
+	 * \brief		: Identifies this log, the start time in microseconds
+	 */
+	std::uint64_t logId;
+
+	/**
+	 * \brief		: Connected follower
+	 */
+	struct Follower
+	{
+		Poco::Net::StreamSocket socket;		//!< shut down by stop() to end the connection
+		std::uint64_t acknowledged;			//!< last sequence number applied by the follower
+	};
+
+	/**
+	 * \brief		: Encoded log records, the last one has sequence number lastSequence
+	 */
+	std::deque<std::string> log;
+
+	/**
+	 * \brief		: Sequence number of the last record, 0 if none was appended yet
+	 */
+	std::uint64_t lastSequence;
+
+	/**
+	 * \brief		: Sum of the sizes of the records in log
+	 */
+	std::size_t logBytes;
+
+	/**
+	 * \brief		: Connected followers by id
+	 */
+	std::map<std::uint64_t, Follower> followers;
+
+	/**
+	 * \brief		: Id of the next follower
+	 */
+	std::uint64_t nextFollowerId;
+
+	/**
+	 * \brief		: Protects log, lastSequence, logBytes, followers and stopping
+	 */
+	std::mutex logMutex;
+
+	/**
+	 * \brief		: Signalled when a record was appended or the leader stops
+	 */
+	std::condition_variable logChanged;
+
+	/**
+	 * \brief		: Set when the leader stops, ends the follower connections
+	 */
+	bool stopping;
+
+	/**
+	 * \brief		: Threads of the follower connections, not shared with other servers
+	 */
+	std::unique_ptr<Poco::ThreadPool> threadPool;
+
+	/**
+	 * \brief		: Poco TCP server accepting followers
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> server;
+
+	/**
+	 * \brief		: Helper method to start a new record of the given type
+	 * \param[OUT]	: ProtocolWriter &record - buffer for the record
+	 * \param[IN]	: ReplicationRecordType type - type of the record
+	 * \param[IN]	: std::uint64_t sequence - sequence number, 0 if assigned by appendRecord
+	 * \return		: NONE
+	 */
+	void beginRecord(ProtocolWriter &record, ReplicationRecordType type, std::uint64_t sequence = 0);
+
+	/**
+	 * \brief		: Helper method to close a record and append it to the log
+	 * \param[IN]	: ProtocolWriter &record - completed record
+	 * \return		: NONE
+	 */
+	void appendRecord(ProtocolWriter &record);
+
+	/**
+	 * \brief		: Helper method to drop the records no follower needs any more, the caller holds logMutex
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void truncateLog();
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: StudentDb &studentDb - database to replicate
+	 * \param[IN]	: unsigned short port - port the followers connect to, 0 picks a free port
+	 */
+	ReplicationLeader(StudentDb &studentDb, unsigned short port);
+
+	/**
+	 * \brief		: Largest number of records kept for followers that are not connected
+	 */
+	static constexpr std::size_t retainedRecords = 65536;
+
+	/**
+	 * \brief		: Largest size of the log, older records are dropped even if a follower needs them
+	 */
+	static constexpr std::size_t maxLogBytes = 64 * 1024 * 1024;
+
+	/**
+	 * \brief		: Method to start observing the database and accept followers
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void start();
+
+	/**
+	 * \brief		: Method to stop observing the database and disconnect the followers
+	 * \details		: Returns when the threads of all follower connections have finished
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void stop();
+
+	/**
+	 * \brief		: Getter method for the port the followers connect to
+	 * \param		: NONE
+	 * \return		: unsigned short - port
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * \brief		: Getter method for the id of the log
+	 * \param		: NONE
+	 * \return		: std::uint64_t - log id
+	 */
+	std::uint64_t getLogId() const;
+
+	/**
+	 * \brief		: Getter method for the sequence number of the last record
+	 * \param		: NONE
+	 * \return		: std::uint64_t - last sequence number, 0 if the log is empty
+	 */
+	std::uint64_t getLastSequence();
+
+	/**
+	 * \brief		: Method to wait for records and copy them into a send buffer
+	 * \param[INOUT]: std::uint64_t &nextSequence - first record wanted, advanced past the copied records
+	 * \param[OUT]	: std::string &batch - buffer the encoded records are appended to, stays empty
+	 *				  if the first record wanted was dropped and the follower needs a snapshot
+	 * \param[IN]	: std::chrono::milliseconds timeout - longest time to wait for a new record
+	 * \return		: bool - false if the leader is stopping
+	 */
+	bool waitForRecords(std::uint64_t &nextSequence, std::string &batch, std::chrono::milliseconds timeout);
+
+	/**
+	 * \brief		: Method to encode a snapshot of the database for a follower
+	 * \param[IN]	: std::uint64_t followerId - follower, acknowledges the snapshot so its successors are kept
+	 * \param[OUT]	: std::string &snapshot - buffer the encoded records are appended to
+	 * \return		: std::uint64_t - sequence number of the last record contained in the snapshot
+	 */
+	std::uint64_t writeSnapshot(std::uint64_t followerId, std::string &snapshot);
+
+	/**
+	 * \brief		: Method to register a follower connection, called by its thread when it starts
+	 * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+	 * \return		: std::uint64_t - id of the follower
+	 */
+	std::uint64_t addFollower(const Poco::Net::StreamSocket &socket);
+
+	/**
+	 * \brief		: Method to unregister a follower connection, called by its thread when it ends
+	 * \param[IN]	: std::uint64_t followerId - id of the follower
+	 * \return		: NONE
+	 */
+	void removeFollower(std::uint64_t followerId);
+
+	/**
+	 * \brief		: Method to record the last sequence number a follower has applied
+	 * \param[IN]	: std::uint64_t followerId - id of the follower
+	 * \param[IN]	: std::uint64_t sequence - last applied sequence number
+	 * \return		: NONE
+	 */
+	void acknowledge(std::uint64_t followerId, std::uint64_t sequence);
+
+	/**
+	 * \brief		: Observer callbacks, each appends one record to the log
+	 */
+	void onCourseAdded (const Course &course) override;
+	void onStudentAdded (const Student &student) override;
+	void onStudentUpdated (const Student &student) override;
+	void onEnrollmentAdded (unsigned int matrikelNumber, const Enrollment &enrollment) override;
+	void onGradeUpdated (unsigned int matrikelNumber, unsigned int courseKey, float grade) override;
+	void onEnrollmentDeleted (unsigned int matrikelNumber, unsigned int courseKey) override;
+	void onCleared () override;
+
+	/**
+	 * \brief		: Destructor, stops the leader
+	 */
+	~ReplicationLeader();
+};
+
+#endif /* REPLICATIONLEADER_H_ */
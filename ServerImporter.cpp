@@ -0,0 +1,234 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ServerImporter.cpp
+ *	\brief Source file for ServerImporter class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <iostream>
+#include <exception>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+//! User Includes
+#include "ServerImporter.h"
+#include "StudentJsonDecoder.h"
+
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketStream.h"
+
+//! Default host of the generator server
+const std::string ServerImporter::defaultHost = "mnl.de";
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: const std::string &host - host name of the generator server
+ * \param[IN]	: unsigned short port - port of the generator server
+ */
+ServerImporter::ServerImporter(const std::string &host, unsigned short port)
+	: host{host}, port{port}, pipelining{false}, skippedRecords{0}
+{}
+
+/**
+ * \brief		: Method to change the server endpoint
+ * \param[IN]	: const std::string &host - host name of the generator server
+ * \param[IN]	: unsigned short port - port of the generator server
+ * \return		: NONE
+ */
+void ServerImporter::setEndpoint(const std::string &host, unsigned short port)
+{
+	this->host = host;
+	this->port = port;
+}
+
+/**
+ * \brief		: Getter method for the host name
+ * \param		: NONE
+ * \return		: const std::string& - host name
+ */
+const std::string& ServerImporter::getHost() const
+{
+	return host;
+}
+
+/**
+ * \brief		: Getter method for the port
+ * \param		: NONE
+ * \return		: unsigned short - port
+ */
+unsigned short ServerImporter::getPort() const
+{
+	return port;
+}
+
+/**
+ * \brief		: Method to switch pipelining on or off, off by default
+ * \param[IN]	: bool pipelining - true only for servers answering several commands per connection
+ * \return		: NONE
+ */
+void ServerImporter::setPipelining(bool pipelining)
+{
+	this->pipelining = pipelining;
+}
+
+/**
+ * \brief		: Getter method for the pipelining setting
+ * \param		: NONE
+ * \return		: bool - true if the commands are pipelined over one connection
+ */
+bool ServerImporter::isPipelining() const
+{
+	return pipelining;
+}
+
+/**
+ * \brief		: Getter method for the number of records skipped by the last import
+ * \param		: NONE
+ * \return		: unsigned int - skipped records
+ */
+unsigned int ServerImporter::getSkippedRecords() const
+{
+	return skippedRecords;
+}
+
+/**
+ * \brief		: Helper method to decode a record and add the student to the database
+ * \param[IN]	: StudentDb &studentDb - database to add the student to
+ * \param[IN]	: StudentJsonDecoder &decoder - decoder reused between the records
+ * \param[IN]	: const std::string &record - JSON record as received
+ * \return		: bool - true if the student was added, false if the record was skipped
+ */
+bool ServerImporter::addRecord(StudentDb &studentDb, StudentJsonDecoder &decoder, const std::string &record)
+{
+	try
+	{
+		Student student = decoder.decode(record);
+
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+		studentDb.addStudentToDb(student);
+		return true;
+	}
+	catch (std::exception &e)
+	{
+		std::cerr << "Exception occurred: " << e.what() << ", record skipped" << std::endl;
+		skippedRecords++;
+		return false;
+	}
+}
+
+/**
+ * \brief		: Helper method to fetch records over one connection with pipelined commands
+ * \param[IN]	: StudentDb &studentDb - database to add the students to
+ * \param[IN]	: StudentJsonDecoder &decoder - decoder reused between the records
+ * \param[IN]	: unsigned int numberOfStudents - number of records to request
+ * \param[OUT]	: unsigned int &addedStudents - incremented for every student added
+ * \return		: unsigned int - number of records received before the server closed the connection
+ */
+unsigned int ServerImporter::importPipelined(StudentDb &studentDb, StudentJsonDecoder &decoder,
+											 unsigned int numberOfStudents, unsigned int &addedStudents)
+{
+	Poco::Net::SocketAddress serverAddress (host, port);
+	Poco::Net::StreamSocket socket (serverAddress);
+	Poco::Net::SocketStream serverStream (socket);
+
+	std::string record;
+	unsigned int received {};
+
+	while (received < numberOfStudents)
+	{
+		unsigned int batch = std::min(batchSize, numberOfStudents - received);
+
+		//! Pipeline the commands of one batch, the stream buffers them into few packets
+		for (unsigned int i = 0; i < batch; i++)
+		{
+			serverStream << "generate\n";
+		}
+		serverStream.flush();
+
+		//! Each command is answered with exactly one line
+		for (unsigned int i = 0; i < batch; i++)
+		{
+			if (!getline(serverStream, record))
+			{
+				std::cerr << "Connection closed by the server after " << received
+						  << " records, continuing with one connection per record" << std::endl;
+				return received;
+			}
+			received++;
+
+			if (addRecord(studentDb, decoder, record))
+			{
+				addedStudents++;
+			}
+		}
+	}
+
+	//! Close the session
+	serverStream << "quit\n";
+	serverStream.flush();
+
+	return received;
+}
+
+/**
+ * \brief		: Method to fetch students from the server and add them to the database
+ * \param[IN]	: StudentDb &studentDb - database to add the students to
+ * \param[IN]	: unsigned int numberOfStudents - number of records to request
+ * \return		: unsigned int - number of students added to the database
+ * \throw		: Poco::Exception if the server cannot be reached
+ */
+unsigned int ServerImporter::importStudents(StudentDb &studentDb, unsigned int numberOfStudents)
+{
+	unsigned int addedStudents {};
+	skippedRecords = 0;
+
+	StudentJsonDecoder decoder;
+	unsigned int received {};
+
+	if (pipelining)
+	{
+		received = importPipelined(studentDb, decoder, numberOfStudents, addedStudents);
+	}
+
+	//! mnl.de answers one 'generate' per connection and closes it, so every record connects anew
+	for (; received < numberOfStudents; received++)
+	{
+		Poco::Net::SocketAddress serverAddress (host, port);
+		Poco::Net::StreamSocket socket (serverAddress);
+		Poco::Net::SocketStream serverStream (socket);
+
+		serverStream << "generate\n";
+		serverStream.flush();
+
+		std::string record;
+		if (!getline(serverStream, record))
+		{
+			std::cerr << "Connection closed by the server without a record after " << received
+					  << " records" << std::endl;
+			break;
+		}
+
+		if (addRecord(studentDb, decoder, record))
+		{
+			addedStudents++;
+		}
+	}
+
+	return addedStudents;
+}
+
+/**
+ * \brief		: Destructor
+ */
+ServerImporter::~ServerImporter()
+{}
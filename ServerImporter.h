@@ -0,0 +1,153 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ServerImporter.h
+ *	\brief Header file for ServerImporter class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef SERVERIMPORTER_H_
+#define SERVERIMPORTER_H_
+
+//! System Includes
+#include <string>
+
+//! User Includes
+#include "StudentDb.h"
+#include "StudentJsonDecoder.h"
+
+/**
+ * \brief		: Imports generated students from a generator server into the database
+ * \details		: The server understands two line commands, 'generate' and 'quit'. A
+ *				  'generate' is answered with one JSON record on its own line; mnl.de then
+ *				  closes the connection, so by default every record gets a connection of its
+ *				  own. For servers keeping the connection open, pipelining sends the
+ *				  'generate' commands in batches over a single connection and falls back to
+ *				  one connection per record if the server closes it early.
+ */
+class ServerImporter
+{
+private:
+
+	/**
+	 * \brief		: Host name of the generator server
+	 */
+	std::string host;
+
+	/**
+	 * \brief		: Port of the generator server
+	 */
+	unsigned short port;
+
+	/**
+	 * \brief		: True to pipeline the commands over one connection
+	 */
+	bool pipelining;
+
+	/**
+	 * \brief		: Number of records skipped by the last import
+	 */
+	unsigned int skippedRecords;
+
+	/**
+	 * \brief		: Helper method to decode a record and add the student to the database
+	 * \param[IN]	: StudentDb &studentDb - database to add the student to
+	 * \param[IN]	: StudentJsonDecoder &decoder - decoder reused between the records
+	 * \param[IN]	: const std::string &record - JSON record as received
+	 * \return		: bool - true if the student was added, false if the record was skipped
+	 */
+	bool addRecord(StudentDb &studentDb, StudentJsonDecoder &decoder, const std::string &record);
+
+	/**
+	 * \brief		: Helper method to fetch records over one connection with pipelined commands
+	 * \param[IN]	: StudentDb &studentDb - database to add the students to
+	 * \param[IN]	: StudentJsonDecoder &decoder - decoder reused between the records
+	 * \param[IN]	: unsigned int numberOfStudents - number of records to request
+	 * \param[OUT]	: unsigned int &addedStudents - incremented for every student added
+	 * \return		: unsigned int - number of records received before the server closed the connection
+	 */
+	unsigned int importPipelined(StudentDb &studentDb, StudentJsonDecoder &decoder, unsigned int numberOfStudents,
+								 unsigned int &addedStudents);
+
+public:
+
+	/**
+	 * \brief		: Default host and port of the generator server
+	 */
+	static const std::string defaultHost;
+	static const unsigned short defaultPort = 4242;
+
+	/**
+	 * \brief		: Number of pipelined 'generate' commands sent before the answers are read
+	 */
+	static constexpr unsigned int batchSize = 256;
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: const std::string &host - host name of the generator server
+	 * \param[IN]	: unsigned short port - port of the generator server
+	 */
+	ServerImporter(const std::string &host = defaultHost, unsigned short port = defaultPort);
+
+	/**
+	 * \brief		: Method to change the server endpoint
+	 * \param[IN]	: const std::string &host - host name of the generator server
+	 * \param[IN]	: unsigned short port - port of the generator server
+	 * \return		: NONE
+	 */
+	void setEndpoint(const std::string &host, unsigned short port);
+
+	/**
+	 * \brief		: Getter method for the host name
+	 * \param		: NONE
+	 * \return		: const std::string& - host name
+	 */
+	const std::string& getHost() const;
+
+	/**
+	 * \brief		: Getter method for the port
+	 * \param		: NONE
+	 * \return		: unsigned short - port
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * \brief		: Method to switch pipelining on or off, off by default
+	 * \param[IN]	: bool pipelining - true only for servers answering several commands per connection
+	 * \return		: NONE
+	 */
+	void setPipelining(bool pipelining);
+
+	/**
+	 * \brief		: Getter method for the pipelining setting
+	 * \param		: NONE
+	 * \return		: bool - true if the commands are pipelined over one connection
+	 */
+	bool isPipelining() const;
+
+	/**
+	 * \brief		: Getter method for the number of records skipped by the last import
+	 * \param		: NONE
+	 * \return		: unsigned int - skipped records
+	 */
+	unsigned int getSkippedRecords() const;
+
+	/**
+	 * \brief		: Method to fetch students from the server and add them to the database
+	 * \param[IN]	: StudentDb &studentDb - database to add the students to
+	 * \param[IN]	: unsigned int numberOfStudents - number of records to request
+	 * \return		: unsigned int - number of students added to the database
+	 * \throw		: Poco::Exception if the server cannot be reached
+	 */
+	unsigned int importStudents(StudentDb &studentDb, unsigned int numberOfStudents);
+
+	/**
+	 * \brief		: Destructor
+	 */
+	~ServerImporter();
+};
+
+#endif /* SERVERIMPORTER_H_ */
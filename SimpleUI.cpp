@@ -13,27 +13,25 @@
 #include <iostream>
 #include <fstream>
 #include <exception>
+#include <mutex>
+#include <shared_mutex>
 
 //! User includes
 #include "SimpleUI.h"
 #include "StudentDb.h"
+#include "WeeklyCourse.h"
+#include "BlockCourse.h"
 
 #include "Poco/Data/Date.h"
-#include "Poco/Net/SocketAddress.h"
-#include "Poco/Net/StreamSocket.h"
-#include "Poco/Net/SocketStream.h"
-#include "Poco/Dynamic/Var.h"
-#include "Poco/JSON/Parser.h"
-#include "Poco/StreamCopier.h"
-
-using namespace Poco::JSON;
-using namespace Poco::Dynamic;
 
 /**
  * \brief		: Parametrised Constructor
+ * \param[IN]	: StudentDb &studentDb - database operated by the UI
+ * \param[IN]	: const std::string &serverHost - host of the student generator server
+ * \param[IN]	: unsigned short serverPort - port of the student generator server
  */
-SimpleUI::SimpleUI(StudentDb &studentDb)
-	:studentDb{studentDb}
+SimpleUI::SimpleUI(StudentDb &studentDb, const std::string &serverHost, unsigned short serverPort)
+	:studentDb{studentDb}, serverImporter{serverHost, serverPort}
 {
 	this->userInput = 0;
 }
@@ -102,6 +100,7 @@ void SimpleUI::run()
 
 				if(outFile)
 				{
+					std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
 					studentDb.write(outFile);
 					outFile.close();
 				}
@@ -126,6 +125,7 @@ void SimpleUI::run()
 
 				if(inFile.good())
 				{
+					std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
 					studentDb.read(inFile);
 					std::cout << "Read from file successfully. Exiting switch case" << std::endl;
 					inFile.close ();
@@ -152,6 +152,33 @@ void SimpleUI::run()
 				std::cout << "Quit" << std::endl;
 				break;
 
+			case 12: //Print the operation metrics
+			{
+				char format{};
+				std::cout << "Enter the format, J for JSON or P for Prometheus: ";
+				std::cin >> format;
+
+				//! Recording goes on while the metrics are printed, no lock of the database is needed
+				if (format == 'P' || format == 'p')
+				{
+					studentDb.getMetrics().writePrometheus(std::cout);
+				}
+				else
+				{
+					studentDb.getMetrics().writeJson(std::cout);
+					std::cout << std::endl;
+				}
+				break;
+			}
+
+			case 13: //Print the memory used by the database
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				studentDb.getMemoryReport().writeJson(std::cout);
+				std::cout << std::endl;
+				break;
+			}
+
 			default:
 				std::cout << "Invalid input - Please choose correct option." << std::endl;
 				break;
@@ -226,6 +253,7 @@ void SimpleUI::addNewCourse()
 						Poco::Data::Time (startTimeHour, startTimeMinute, startTimeSecond),
 						Poco::Data::Time (endTimeHour, endTimeMinute, endTimeSecond));
 
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
 		studentDb.addWeeklyCourseToDb(weeklyCourse);
 
 	}
@@ -255,6 +283,7 @@ void SimpleUI::addNewCourse()
 								Poco::Data::Time (startTimeHour, startTimeMinute, startTimeSecond),
 								Poco::Data::Time (endTimeHour, endTimeMinute, endTimeSecond));
 
+		std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
 		studentDb.addBlockCourseToDb(blockCourse);
 
 	}
@@ -272,7 +301,12 @@ void SimpleUI::addNewCourse()
  */
 void SimpleUI::listCourses()
 {
-	studentDb.listCoursesInDb();
+	std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+	studentDb.listCourses([this](const Course &course)
+	{
+		printCourse(course);
+		return true;
+	});
 }
 
 /**
@@ -315,6 +349,8 @@ void SimpleUI::addNewStudent()
 	//! Add student to the database
 	Student student(firstName, lastName, Poco::Data::Date(year, month, date),
 									Address(street, postalCode, cityName, additionalInfo));
+
+	std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
 	studentDb.addStudentToDb(student);
 
 }
@@ -336,6 +372,8 @@ void SimpleUI::addEnrollment ()
 	std::cout << "Enter the course key: " << std::endl;
 	std::cin >> courseKey;
 
+	std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+
 	//! Check if student exists with the provided matrikulation number
 	if(studentDb.isStudentExists(matrikelNumber) == false)
 	{
@@ -350,12 +388,30 @@ void SimpleUI::addEnrollment ()
 		return;
 	}
 
+	//! Do not block other front ends while waiting for the user
+	writeLock.unlock();
 	std::cin.ignore();
 	std::cout << "Enter the semester: " << std::endl;
 	getline(std::cin, semester);
 
-	//! Add enrollment
-	studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, semester);
+	//! Add enrollment, the student and course cannot be removed in between
+	writeLock.lock();
+	switch (studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, semester))
+	{
+	case StudentDb::ENROLLED:
+		std::cout << "Enrollment added" << std::endl;
+		break;
+	case StudentDb::UNKNOWN_COURSE:
+		std::cout << "Course does not exist" << std::endl;
+		break;
+	case StudentDb::ALREADY_ENROLLED:
+		std::cout << "Enrollment already exists" << std::endl;
+		break;
+	case StudentDb::SCHEDULE_CONFLICT:
+		std::cout << "Enrollment clashes with course "
+				  << studentDb.findScheduleConflicts(matrikelNumber, courseKey, semester).front() << std::endl;
+		break;
+	}
 }
 
 /**
@@ -370,10 +426,16 @@ void SimpleUI::printStudent ()
 	std::cout << "Enter the matrikel number of the student: " << std::endl;
 	std::cin >> matrikelNumber;
 
+	std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+
 	//! Check for valid matrikulation number and print the student
 	if(studentDb.isStudentExists(matrikelNumber))
 	{
-		studentDb.printStudent(matrikelNumber);
+		printStudentDetails(studentDb.getStudent(matrikelNumber));
+	}
+	else
+	{
+		std::cout << "No student exists by this matrikel number" << std::endl;
 	}
 }
 
@@ -390,7 +452,27 @@ void SimpleUI::searchStudent ()
 	std::cout << "Enter the student name to be searched" << std::endl;
 	getline(std::cin, subString);
 
-	studentDb.searchStudentInDb (subString);
+	std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+	std::size_t found = studentDb.searchStudents(subString, [this](const Student &student)
+	{
+		printStudentSummary(student);
+		return true;
+	});
+
+	//! Nothing contains the string, it may be misspelled
+	if (found == 0)
+	{
+		std::vector<std::pair<unsigned int, unsigned int>> similar = studentDb.findStudentsFuzzy(subString, 5);
+
+		if (!similar.empty())
+		{
+			std::cout << "No exact match, did you mean:" << std::endl;
+		}
+		for (const auto &match: similar)
+		{
+			printStudentSummary(studentDb.getStudents().at(match.first));
+		}
+	}
 }
 
 /**
@@ -404,8 +486,13 @@ void SimpleUI::updateStudent()
 	std::cout << "Enter the Matrikel Number of the student to be updated: " << std::endl;
 	std::cin >> matrikelNumber;
 
+	//! Students are never removed, the check stays valid while the user types
+	std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+	bool studentExists = studentDb.isStudentExists(matrikelNumber);
+	readLock.unlock();
+
 	//! If student exists in the database then update the student information in the database
-	if(studentDb.isStudentExists(matrikelNumber) == true)
+	if(studentExists == true)
 	{
 		std::cout << "Enter the attribute number that you wish to change" << std::endl
 				  << "0 - Terminate" 	<< std::endl
@@ -417,8 +504,10 @@ void SimpleUI::updateStudent()
 
 		std::cin >> changeAttribute;
 
-		studentDb.updateStudentInDb(matrikelNumber, changeAttribute);
-		studentDb.printStudent(matrikelNumber);
+		updateStudentAttribute(matrikelNumber, changeAttribute);
+
+		readLock.lock();
+		printStudentDetails(studentDb.getStudent(matrikelNumber));
 	}
 	else
 	{
@@ -427,145 +516,226 @@ void SimpleUI::updateStudent()
 }
 
 /**
- * \brief		: Helper function to read database from the server
- * \param		: NONE
+ * \brief		: Helper function to read the new value of a student attribute from the console and store it
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: unsigned int changeAttribute - Indicates which attribute has to be changed
+ * 				 0 - Terminate
+ *			  	 1 - First Name
+ *				 2 - Last Name
+ *			  	 3 - Date Of Birth
+ *			  	 4 - Enrollment
+ *			  	 5 - Address
  * \return		: NONE
  */
-void SimpleUI::addStudentFromServerToDatabase(unsigned int numberOfStudents)
+void SimpleUI::updateStudentAttribute(unsigned int matrikelNumber, unsigned int changeAttribute)
 {
-
-	//! Vector container of strings to store the json data from the server
-	std::vector<std::string> data;
-
-	for (unsigned int i = 0; i < numberOfStudents; i++)
+	//! To terminate the program
+	if (changeAttribute == 0)
 	{
-		//! Create host address object and initialise the host and its port
-		Poco::Net::SocketAddress host ("mnl.de", 4242);
-
-		//! Create a socket for the host
-		Poco::Net::StreamSocket socket (host);
-
-		//! Create a stream for the socket to read the data from the host
-		Poco::Net::SocketStream serverStream (socket);
-
-		/**
-		 * The server understands two commands 'generate' and 'quit'.
-		 * Commands to initiate and close communication with the server
-		 */
-		std::string generate {"generate\n"};
-		std::string quit {"quit"};
-
-		//! Establish connection with the server
-		serverStream << generate;
-
-		/*
-		 * Data written to a network stream is buffered internally before being sent. If
-		 * writing a single character to a network stream led to immediate transmission
-		 * of the character, the network would be congested with packets containing only
-		 * a small amount of useful information.
-		 * The buffered data will therefore only be written to the network when the
-		 * buffer becomes full or you trigger writing by calling the flush method.
-		 */
-		serverStream.flush();
-
-		//! String to receive the json data from the server stream
-		std::string receivedJsonData{};
-
-		//! Get the data and store it in a vector container of strings
-		while (getline(serverStream, receivedJsonData))
+		std::cout << "Terminating..." << std::endl;
+		return;
+	}
+	else
+	{
+		switch(changeAttribute)
+		{
+		//! Change first name
+		case 1:
+		{
+			std::string newFirstName = " ";
+			std::cin.ignore();
+			std::cout << "Enter the new first name: " << std::endl;
+			std::cin >> newFirstName;
+
+			//! Change the first name based on the matrikulation number input
+			std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+			studentDb.updateFirstName(matrikelNumber, newFirstName);
+			break;
+		}
+		//! Change last name
+		case 2:
 		{
-			data.push_back(receivedJsonData);
+			std::string newLastName = " ";
+			std::cin.ignore ();
+			std::cout << "Enter the new last name: " << std::endl;
+			getline (std::cin, newLastName);
+
+			//! Change the last name based on the matrikulation number input
+			std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+			studentDb.updateLastName(matrikelNumber, newLastName);
+			break;
 		}
+		//! Change date of birth
+		case 3:
+		{
+			int newDate {}, newMonth {}, newYear {};
+			std::cout << "Enter the new date of birth (dd mm yyyy): " << std::endl;
+			std::cin >> newDate >> newMonth >> newYear;
+
+			//! Change the date of birth based on the matrikulation number input
+			std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+			studentDb.updateDateOfBirth(matrikelNumber, Poco::Data::Date (newYear, newMonth, newDate));
+			break;
+		}
+		//! Change enrollment
+		case 4:
+		{
+			unsigned int courseKey {}, enrollmentAction {};
+			float newGrade {};
 
-		//! Quit the connection and flush the data onto the stream
-		serverStream << quit;
-		serverStream.flush();
+			std::cout << "1 - Change Grade" 	 << std::endl
+					  << "2 - Delete Enrollment" << std::endl;
+			std::cin >> enrollmentAction;
+
+			std::cout << "Enter the course key" << std::endl;
+			std::cin >> courseKey;
+
+			//! Change grade of the student
+			if (1 == enrollmentAction)
+			{
+				std::cout << "Enter the new grade: " << std::endl;
+				std::cin >> newGrade;
+
+				//! Change the grade based on the matrikulation number input
+				std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+				if (!studentDb.updateStudentGradeInDb(matrikelNumber, courseKey, newGrade))
+				{
+					std::cout << "Course not found. Enter the correct course key" << std::endl;
+				}
+			}
+			//! Delete enrollment
+			else if (2 == enrollmentAction)
+			{
+				//! Delete the enrollment based on the matrikulation number input
+				std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+				studentDb.deleteEnrollmentFromStudent(matrikelNumber, courseKey);
+			}
+			else
+			{
+				std::cout << "Incorrect option!" << std::endl;
+			}
+			break;
+		}
+		//! Change address
+		case 5:
+		{
+			std::string newStreetName = " ", newCityName = " ", newAdditionalInfo = " ";
+			unsigned short newPostalCode {};
+
+			std::cout << "Enter the new address" << std::endl;
+			std::cout << "---------------------" << std::endl;
+
+			std::cin.ignore();
+			std::cout << "Street Name: " << std::endl;
+			getline (std::cin, newStreetName);
+
+			std::cin.ignore();
+			std::cout << "City Name: " << std::endl;
+			getline (std::cin, newCityName);
+
+			std::cout << "Postal Code: " << std::endl;
+			std::cin >> newPostalCode;
+
+			std::cin.ignore();
+			std::cout << "Additional Info: ";
+			getline (std::cin, newAdditionalInfo);
+
+			//! Set the address based on the matrikulation number input
+			std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+			studentDb.updateAddress(matrikelNumber, Address(newStreetName, newPostalCode, newCityName, newAdditionalInfo));
+			break;
+		}
+		}
 	}
-	for (auto serverData: data)//.begin(); serverData != data.end(); serverData++)
+}
+
+/**
+ * \brief		: Helper function to print the details of a course
+ * \param[IN]	: const Course &course - weekly or block course
+ * \return		: NONE
+ */
+void SimpleUI::printCourse (const Course &course) const
+{
+	std::cout << "Course Key: " << course.getCourseKey() << std::endl << "Title: " << course.getTitle() << std::endl
+			  << "Major: " << course.getMajorName() << std::endl << "Credit Points: " << course.getCreditPoints() << std::endl;
+
+	if (const WeeklyCourse *weeklyCourse = dynamic_cast<const WeeklyCourse*>(&course))
 	{
-		std::cout << serverData << " " << std::endl;
+		std::cout << "Day of week - " << weeklyCourse->getDayOfWeek() << std::endl
+				  << "Timings - " << weeklyCourse->getStartTime().hour() << ":" << weeklyCourse->getStartTime().minute()
+				  << " to " << weeklyCourse->getEndTime().hour() << ":" << weeklyCourse->getEndTime().minute() << std::endl;
 	}
-
-	//! Iterate over the data from the server stream, parse and extract it to local variables
-	for (auto vec: data)
+	else if (const BlockCourse *blockCourse = dynamic_cast<const BlockCourse*>(&course))
 	{
-		std::cout << "in for loop" << std::endl;
-//		std::string json = *it;
-		Poco::JSON::Parser jsonDataFromServer;
-		Poco::Dynamic::Var result = jsonDataFromServer.parse(vec);
-		//TODO: Check the pointer
-		Object::Ptr object = result.extract<Object::Ptr>();
-
-		std::cout << "Getting the name" << std::endl;
-		//Get name
-		Var value = object->get("name");
-		object = value.extract<Object::Ptr>();
-
-		value = object->get("firstName");
-		std::string firstName = value.convert<std::string>();
-		std::cout << firstName << std::endl;
-
-		value = object->get("lastName");
-		std::string lastName = value.convert<std::string>();
-		std::cout << lastName << std::endl;
-
-		//Get date of birth
-		object = result.extract<Object::Ptr>();
-		value = object->get("dateOfBirth");
-		object = value.extract<Object::Ptr>();
-
-		value = object->get("date");
-		int date = value.convert<int>();
-		std::cout << date << std::endl;
-
-		value = object->get("month");
-		int month = value.convert<int>();
-		std::cout << month << std::endl;
-
-		value = object->get("year");
-		int year = value.convert<int>();
-		std::cout << year << std::endl;
-
-		//Get Address
-		object = result.extract<Object::Ptr>();
-		value = object->get("location");
-		object = result.extract<Object::Ptr>();
-
-		value = object->get("city");
-		std::string cityName = value.convert<std::string>();
-		std::cout << cityName << std::endl;
-
-		value = object->get("postCode");
-		unsigned short postalCode = 0;
-		postalCode = value.convert<unsigned short>();
-		std::cout << postalCode << std::endl;
-		try
-		{
-			postalCode = value.convert<unsigned short>();
-		} catch (std::exception &e)
-		{
-			std::cout << "\nException occurred: " << e.what()
-					<< ", Invalid postal code received: "
-					<< value.convert<std::string>();
-			continue;
-		}
+		const Poco::Data::Date &startDate = blockCourse->getStartDate();
+		const Poco::Data::Date &endDate = blockCourse->getEndDate();
 
+		std::cout << "Duration - " << startDate.day() << "/" << startDate.month() << "/" << startDate.year()
+				  << " to " << endDate.day() << "/" << endDate.month() <<"/" << endDate.year() << std::endl
+				  << "Timings - " << blockCourse->getStartTime().hour() << ":" << blockCourse->getStartTime().minute()
+				  << " to " << blockCourse->getEndTime().hour() << ":" << blockCourse->getEndTime().minute() << std::endl;
+	}
+}
 
-		value = object->get("street");
-		std::string street = value.convert<std::string>();
-		std::cout << street << std::endl;
+/**
+ * \brief		: Helper function to print the details and enrollments of a student
+ * \param[IN]	: const Student &student - student to be printed
+ * \return		: NONE
+ */
+void SimpleUI::printStudentDetails (const Student &student) const
+{
+	const Poco::Data::Date &dateOfBirth = student.getDateOfBirth();
+	const Address &address = student.getAddress();
+
+	std::cout << "Student Name: " << student.getFirstName() << " " << student.getLastName() << std::endl
+			  << "Matrikel Number: " << student.getMatrikelNumber() << std::endl
+			  << "Date Of Birth(dd/mm/yyyy): " << dateOfBirth.day() << "/" << dateOfBirth.month() << "/" << dateOfBirth.year() << std::endl
+			  << "Address Of Student" << std::endl
+			  << address.getStreet() << " - "
+			  << address.getCityName() << ", "
+			  << address.getPostalCode() << std::endl
+			  << address.getAdditionalInfo() << std::endl;
 
-		value = object->get("state");
-		std::string additionalInfo = value.convert<std::string>();
-		std::cout << additionalInfo << std::endl;
+	std::cout << "Enrollments" << std::endl;
 
-		Student student(firstName, lastName, Poco::Data::Date(date, month, year),
-								Address(street, postalCode, cityName, additionalInfo));
+	for (const Enrollment &enrollment: student.getEnrollments())
+	{
+		std::cout << "Course: " << enrollment.getCourse().getTitle() << std::endl
+				  << "Semester: " << enrollment.getSemester() << std::endl
+				  << "Grade: " << enrollment.getGrade() << std::endl;
+	}
+}
 
-		studentDb.addStudentToDb (student);
+/**
+ * \brief		: Helper function to print the matrikel number and names of a student in one line
+ * \param[IN]	: const Student &student - student to be printed
+ * \return		: NONE
+ */
+void SimpleUI::printStudentSummary (const Student &student) const
+{
+	std::cout << "Matrikel Number: " << student.getMatrikelNumber()
+			  << ", Last Name: " << student.getLastName()
+			  << ", First Name: " << student.getFirstName() << std::endl;
+}
 
-		std::cout << "Added students to database" << std::endl;
+/**
+ * \brief		: Helper function to read database from the server
+ * \param[IN]	: unsigned int numberOfStudents - number of students to request from the server
+ * \return		: NONE
+ */
+void SimpleUI::addStudentFromServerToDatabase(unsigned int numberOfStudents)
+{
+	try
+	{
+		unsigned int addedStudents = serverImporter.importStudents(studentDb, numberOfStudents);
 
+		std::cout << "Added " << addedStudents << " students to database, skipped "
+				  << serverImporter.getSkippedRecords() << " invalid records" << std::endl;
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "Could not read from server " << serverImporter.getHost() << ":"
+				  << serverImporter.getPort() << " - " << e.what() << std::endl;
 	}
 }
 
@@ -586,6 +756,8 @@ void SimpleUI::printCommands ()
 			  << "8. Write to File"	  << std::endl
 			  << "9. Read from File"  << std::endl
 			  << "10. Add student from server database" << std::endl
-			  << "11. QUIT"			  << std::endl;
+			  << "11. QUIT"			  << std::endl
+			  << "12. Show operation metrics" << std::endl
+			  << "13. Show memory usage" << std::endl;
 }
 
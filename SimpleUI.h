@@ -16,6 +16,7 @@
 
 //! User includes
 #include "StudentDb.h"
+#include "ServerImporter.h"
 
 
 class SimpleUI {
@@ -32,12 +33,56 @@ private:
 	 */
     StudentDb &studentDb;
 
+	/**
+	 * \brief		:Importer for the student generator server
+	 */
+    ServerImporter serverImporter;
+
+	/**
+	 * \brief		: Helper function to print the details of a course
+	 * \param[IN]	: const Course &course - weekly or block course
+	 * \return		: NONE
+	 */
+	void printCourse (const Course &course) const;
+
+	/**
+	 * \brief		: Helper function to print the details and enrollments of a student
+	 * \param[IN]	: const Student &student - student to be printed
+	 * \return		: NONE
+	 */
+	void printStudentDetails (const Student &student) const;
+
+	/**
+	 * \brief		: Helper function to print the matrikel number and names of a student in one line
+	 * \param[IN]	: const Student &student - student to be printed
+	 * \return		: NONE
+	 */
+	void printStudentSummary (const Student &student) const;
+
+	/**
+	 * \brief		: Helper function to read the new value of a student attribute from the console and store it
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: unsigned int changeAttribute - Indicates which attribute has to be changed
+	 * 				 0 - Terminate
+	 *			  	 1 - First Name
+	 *				 2 - Last Name
+	 *			  	 3 - Date Of Birth
+	 *			  	 4 - Enrollment
+	 *			  	 5 - Address
+	 * \return		: NONE
+	 */
+	void updateStudentAttribute (unsigned int matrikelNumber, unsigned int changeAttribute);
+
 public:
 
     /**
      * \brief		: Parametrised Constructor
+     * \param[IN]	: StudentDb &studentDb - database operated by the UI
+     * \param[IN]	: const std::string &serverHost - host of the student generator server
+     * \param[IN]	: unsigned short serverPort - port of the student generator server
      */
-	SimpleUI(StudentDb &studentDb);
+	SimpleUI(StudentDb &studentDb, const std::string &serverHost = ServerImporter::defaultHost,
+			unsigned short serverPort = ServerImporter::defaultPort);
 
 	/**
 	 * \brief		: Helper function to add new student to the database
@@ -90,7 +135,7 @@ public:
 
 	/**
 	 * \brief		: Helper function to read database from the server
-	 * \param		: NONE
+	 * \param[IN]	: unsigned int numberOfStudents - number of students to request from the server
 	 * \return		: NONE
 	 */
 	void addStudentFromServerToDatabase (unsigned int numberOfStudents);
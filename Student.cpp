@@ -10,11 +10,26 @@
 /****************************************************************************/
 
 //! System Includes
-#include <iostream>
+#include <cmath>
+#include <ostream>
 
 //! User includes
 #include "Student.h"
 #include "Address.h"
+#include "Course.h"
+
+namespace
+{
+	//! Grades and credit points in hundredths, see Student::addToTotals
+	long long toHundredths(float value)
+	{
+		return std::llround(value * 100.0);
+	}
+
+	//! Best and worst passing grade
+	const long long bestGrade = 100;
+	const long long passLimit = 400;
+}
 
 //! Attribute that stores the next matrikel number
 unsigned int nextMatrikelNumber = 100000;
@@ -81,39 +96,34 @@ unsigned int Student::getMatrikelNumber() const
 }
 
 /**
- * \brief		: Method to add enrollment to the enrollment vector
- * \param		: Enrollment& enrollment - Reference object of the enrollment class
- * \return		: NONE
+ * \brief		: Getter method for date of birth
+ * \param		: NONE
+ * \return		: const Poco::Data::Date& - date of birth
  */
-void Student::updateEnrollments(Enrollment& enrollment)
+const Poco::Data::Date& Student::getDateOfBirth() const
 {
-	enrollments.push_back(enrollment);
+	return dateOfBirth;
 }
 
 /**
- * \brief		: Method to print the student details
+ * \brief		: Getter method for address
  * \param		: NONE
- * \return		: NONE
+ * \return		: const Address& - address of the student
  */
-void Student::printStudent () const
+const Address& Student::getAddress() const
 {
-	std::cout << "Student Name: " << this->firstName << " " << this->lastName << std::endl
-			  << "Matrikel Number: " << this->matrikelNumber << std::endl
-			  << "Date Of Birth(dd/mm/yyyy): " << this->dateOfBirth.day() << "/" << this->dateOfBirth.month() << "/" << this->dateOfBirth.year() << std::endl
-			  << "Address Of Student" << std::endl
-			  << this->address.getStreet() << " - "
-			  << this->address.getCityName() << ", "
-			  << this->address.getPostalCode() << std::endl
-			  << this->address.getAdditionalInfo() << std::endl;
-
-	std::cout << "Enrollments" << std::endl;
+	return address;
+}
 
-	for (auto enrollment = enrollments.begin(); enrollment < enrollments.end(); enrollment++)
-	{
-		std::cout << "Course: " << (*enrollment).getCourse().getTitle() << std::endl
-				  << "Semester: " << (*enrollment).getSemester() << std::endl
-				  << "Grade: " << (*enrollment).getGrade() << std::endl;
-	}
+/**
+ * \brief		: Method to add enrollment to the enrollment vector
+ * \param		: Enrollment& enrollment - Reference object of the enrollment class
+ * \return		: NONE
+ */
+void Student::updateEnrollments(Enrollment& enrollment)
+{
+	enrollments.push_back(enrollment);
+	addToTotals(enrollments.back(), 1);
 }
 
 /**
@@ -160,29 +170,29 @@ void Student::setLastName(const std::string &lastName)
  * \brief		: Method to update the grade
  * \param[IN]	: unsigned int courseKey
  * \param[IN]	: float newGrade
- * \return		: NONE
+ * \return		: bool - true if the student is enrolled in the course, false otherwise
  */
-void Student::updateGrade (unsigned int courseKey, float newGrade)
+bool Student::updateGrade (unsigned int courseKey, float newGrade)
 {
 	for (auto eachEnrollment = enrollments.begin(); eachEnrollment != enrollments.end(); eachEnrollment++)
 	{
 		if (courseKey == eachEnrollment->getCourse().getCourseKey())
 		{
+			addToTotals(*eachEnrollment, -1);
 			eachEnrollment->setGrade(newGrade);
-		}
-		else
-		{
-			std::cout << "Course not found. Enter the correct course key" << std::endl;
+			addToTotals(*eachEnrollment, 1);
+			return true;
 		}
 	}
+	return false;
 }
 
 /**
  * \brief		: Method to delete the enrollment for a particular course
  * \param[IN]	: unsigned int courseKey
- * \return		: NONE
+ * \return		: bool - true if the enrollment was deleted, false if the student is not enrolled in the course
  */
-void Student::deleteEnrollment (unsigned int courseKey)
+bool Student::deleteEnrollment (unsigned int courseKey)
 {
 	/** Range based auto for loop could not be used since erase() operation on a vector invalidates all iterators
 	 *  beginning with the element being erased upto the end(). We have to make sure that the iterators remain valid
@@ -197,14 +207,16 @@ void Student::deleteEnrollment (unsigned int courseKey)
 	{
 		if(courseKey == enrollment->getCourse().getCourseKey())
 		{
+			addToTotals(*enrollment, -1);
 			enrollment = enrollments.erase(enrollment);
-			return;
+			return true;
 		}
 		else
 		{
 			++enrollment;
 		}
 	}
+	return false;
 }
 
 /**
@@ -212,13 +224,125 @@ void Student::deleteEnrollment (unsigned int courseKey)
  * \param[IN]	: std::ostream& out - reference of stream object
  * \return		: NONE
  */
-void Student::write(std::ostream &out)
+void Student::write(std::ostream &out) const
 {
 	out << matrikelNumber << ";" << lastName << ";" << firstName << ";"
 		<< dateOfBirth.day() << "." << dateOfBirth.month() << "." << dateOfBirth.year() << ";"
 		<< address.getStreet() << ";" << address.getPostalCode() << ";" << address.getCityName() << ";" << address.getAdditionalInfo() << ";" << std::endl;
 }
 
+/**
+ * \brief		: Method to get the grade point average, weighted by the credit points of the graded courses
+ * \param		: NONE
+ * \return		: float - average grade, 0 if no course is graded
+ */
+float Student::getGradePointAverage() const
+{
+	return gradedCredits == 0 ? 0 : static_cast<float>(static_cast<double>(weightedGradeSum) / gradedCredits / 100.0);
+}
+
+/**
+ * \brief		: Method to get the credit points of the graded courses
+ * \param		: NONE
+ * \return		: float - credit points
+ */
+float Student::getGradedCredits() const
+{
+	return gradedCredits / 100.0f;
+}
+
+/**
+ * \brief		: Method to get the credit points earned with a passed course (grade 1.0 to 4.0)
+ * \param		: NONE
+ * \return		: float - credit points
+ */
+float Student::getEarnedCredits() const
+{
+	return earnedCredits / 100.0f;
+}
+
+/**
+ * \brief		: Method to get the credit points of all enrolled courses
+ * \param		: NONE
+ * \return		: float - credit points
+ */
+float Student::getEnrolledCredits() const
+{
+	return enrolledCredits / 100.0f;
+}
+
+/**
+ * \brief		: Method to get the credit points earned in a semester
+ * \param[IN]	: const std::string &semester - semester
+ * \return		: float - credit points
+ */
+float Student::getSemesterCredits(const std::string &semester) const
+{
+	auto credits = semesterCredits.find(semester);
+	return credits == semesterCredits.end() ? 0 : credits->second / 100.0f;
+}
+
+/**
+ * \brief		: Helper method to add an enrollment to the running totals or remove it again
+ * \param[IN]	: const Enrollment &enrollment - enrollment with its current grade
+ * \param[IN]	: int sign - 1 to add, -1 to remove
+ * \return		: NONE
+ */
+void Student::addToTotals(const Enrollment &enrollment, int sign)
+{
+	long long credits = sign * toHundredths(enrollment.getCourse().getCreditPoints());
+	long long grade = toHundredths(enrollment.getGrade());
+
+	enrolledCredits += credits;
+
+	//! A grade of 0 marks a course that is not graded yet
+	if (grade > 0)
+	{
+		weightedGradeSum += grade * credits;
+		gradedCredits += credits;
+	}
+	if (grade >= bestGrade && grade <= passLimit)
+	{
+		earnedCredits += credits;
+
+		long long &semester = semesterCredits[enrollment.getSemester()];
+		semester += credits;
+		if (semester == 0)
+		{
+			semesterCredits.erase(enrollment.getSemester());
+		}
+	}
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the student to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the names, the address, the
+ *				  enrollments and the credits per semester
+ * \return		: NONE
+ */
+void Student::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::NAME_STRINGS, 2);
+	report.addString(MemoryReport::NAME_STRINGS, firstName);
+	report.addString(MemoryReport::NAME_STRINGS, lastName);
+
+	address.reportMemory(report);
+
+	report.addObjects(MemoryReport::ENROLLMENT_VECTORS, enrollments.size());
+	report.addVector(MemoryReport::ENROLLMENT_VECTORS, enrollments);
+	for (const Enrollment &enrollment: enrollments)
+	{
+		enrollment.reportMemory(report);
+	}
+
+	report.addObjects(MemoryReport::SEMESTER_CREDITS, semesterCredits.size());
+	report.addHashTable(MemoryReport::SEMESTER_CREDITS, semesterCredits);
+	for (const auto &semester: semesterCredits)
+	{
+		report.addString(MemoryReport::SEMESTER_CREDITS, semester.first);
+	}
+}
+
 /**
  * \brief		: Destructor
  */
@@ -14,6 +14,7 @@
 
 //! System Includes
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <Poco/Data/Date.h>
 #include <Poco/Data/Time.h>
@@ -44,6 +45,24 @@ private:
 	//! Object of the address class
     Address address;
 
+	/**
+	 * \brief		: Running totals over the enrollments, kept in hundredths of a grade and of a credit point
+	 *				  so that adding and removing an enrollment leaves no rounding error
+	 */
+	long long weightedGradeSum {};									//!< grade times credits of the graded enrollments
+	long long gradedCredits {};										//!< credits of the graded enrollments
+	long long earnedCredits {};										//!< credits of the passed enrollments
+	long long enrolledCredits {};									//!< credits of all enrollments
+	std::unordered_map<std::string, long long> semesterCredits;		//!< credits of the passed enrollments per semester
+
+	/**
+	 * \brief		: Helper method to add an enrollment to the running totals or remove it again
+	 * \param[IN]	: const Enrollment &enrollment - enrollment with its current grade
+	 * \param[IN]	: int sign - 1 to add, -1 to remove
+	 * \return		: NONE
+	 */
+	void addToTotals(const Enrollment &enrollment, int sign);
+
 public:
     //! Default constructor
     Student ();
@@ -87,18 +106,25 @@ public:
 	unsigned int getMatrikelNumber() const;
 
 	/**
-	 * \brief		: Method to add enrollment to the enrollment vector
-	 * \param		: Enrollment& enrollment - Reference object of the enrollment class
-	 * \return		: NONE
+	 * \brief		: Getter method for date of birth
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Date& - date of birth
 	 */
-	void updateEnrollments(Enrollment& enrollment);
+	const Poco::Data::Date& getDateOfBirth() const;
 
 	/**
-	 * \brief		: Method to print the student details
+	 * \brief		: Getter method for address
 	 * \param		: NONE
+	 * \return		: const Address& - address of the student
+	 */
+	const Address& getAddress() const;
+
+	/**
+	 * \brief		: Method to add enrollment to the enrollment vector
+	 * \param		: Enrollment& enrollment - Reference object of the enrollment class
 	 * \return		: NONE
 	 */
-	void printStudent () const;
+	void updateEnrollments(Enrollment& enrollment);
 
 	/**
 	 * \brief		: Setter method for address
@@ -132,23 +158,68 @@ public:
 	 * \brief		: Method to update the grade
 	 * \param[IN]	: unsigned int courseKey
 	 * \param[IN]	: float newGrade
-	 * \return		: NONE
+	 * \return		: bool - true if the student is enrolled in the course, false otherwise
 	 */
-	void updateGrade (unsigned int courseKey, float newGrade);
+	bool updateGrade (unsigned int courseKey, float newGrade);
 
 	/**
 	 * \brief		: Method to write the student information on to the stream
 	 * \param[IN]	: std::ostream& out - reference of stream object
 	 * \return		: NONE
 	 */
-	void write(std::ostream& out);
+	void write(std::ostream& out) const;
 
 	/**
 	 * \brief		: Method to delete the enrollment for a particular course
 	 * \param[IN]	: unsigned int courseKey
+	 * \return		: bool - true if the enrollment was deleted, false if the student is not enrolled in the course
+	 */
+	bool deleteEnrollment (unsigned int courseKey);
+
+	/**
+	 * \brief		: Method to get the grade point average, weighted by the credit points of the graded courses
+	 * \param		: NONE
+	 * \return		: float - average grade, 0 if no course is graded
+	 */
+	float getGradePointAverage() const;
+
+	/**
+	 * \brief		: Method to get the credit points of the graded courses
+	 * \param		: NONE
+	 * \return		: float - credit points
+	 */
+	float getGradedCredits() const;
+
+	/**
+	 * \brief		: Method to get the credit points earned with a passed course (grade 1.0 to 4.0)
+	 * \param		: NONE
+	 * \return		: float - credit points
+	 */
+	float getEarnedCredits() const;
+
+	/**
+	 * \brief		: Method to get the credit points of all enrolled courses
+	 * \param		: NONE
+	 * \return		: float - credit points
+	 */
+	float getEnrolledCredits() const;
+
+	/**
+	 * \brief		: Method to get the credit points earned in a semester
+	 * \param[IN]	: const std::string &semester - semester
+	 * \return		: float - credit points
+	 */
+	float getSemesterCredits(const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the student to a memory report
+	 * \details		: The Student object itself lives in the node of the students map and
+	 *				  is counted there
+	 * \param[IN]	: MemoryReport &report - report, gets the names, the address, the
+	 *				  enrollments and the credits per semester
 	 * \return		: NONE
 	 */
-	void deleteEnrollment (unsigned int courseKey);
+	void reportMemory(MemoryReport &report) const;
 
 	/**
 	 * \brief		: Destructor
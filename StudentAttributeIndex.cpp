@@ -0,0 +1,214 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentAttributeIndex.cpp
+ *	\brief Source file for StudentAttributeIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+
+//! User Includes
+#include "StudentAttributeIndex.h"
+#include "StudentNameIndex.h"
+#include "Address.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to add a student or move it to its new date of birth and address
+ * \param[IN]	: const Student &student - student with the current attributes
+ * \return		: NONE
+ */
+void StudentAttributeIndex::updateStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	Keys keys {dateKey(student.getDateOfBirth()), student.getAddress().getPostalCode(),
+			   StudentNameIndex::fold(student.getAddress().getCityName())};
+
+	auto existing = studentKeys.find(matrikelNumber);
+	if (existing != studentKeys.end())
+	{
+		datesOfBirth.erase(std::make_pair(existing->second.dateOfBirth, matrikelNumber));
+		postalCodes.erase(std::make_pair(existing->second.postalCode, matrikelNumber));
+		removeFromCity(existing->second.city, matrikelNumber);
+	}
+
+	datesOfBirth.insert(std::make_pair(keys.dateOfBirth, matrikelNumber));
+	postalCodes.insert(std::make_pair(keys.postalCode, matrikelNumber));
+
+	std::vector<unsigned int> &cityStudents = cities[keys.city];
+	cityStudents.insert(std::lower_bound(cityStudents.begin(), cityStudents.end(), matrikelNumber), matrikelNumber);
+
+	studentKeys[matrikelNumber] = std::move(keys);
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentAttributeIndex::clear()
+{
+	datesOfBirth.clear();
+	postalCodes.clear();
+	cities.clear();
+	studentKeys.clear();
+}
+
+/**
+ * \brief		: Method to find the students born in a period
+ * \param[IN]	: const Poco::Data::Date &from - first day of the period
+ * \param[IN]	: const Poco::Data::Date &to - last day of the period
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by date of birth, then matrikel number
+ */
+std::vector<unsigned int> StudentAttributeIndex::findByDateOfBirth(const Poco::Data::Date &from,
+																	const Poco::Data::Date &to) const
+{
+	std::vector<unsigned int> matches;
+	int toKey = dateKey(to);
+
+	for (auto entry = datesOfBirth.lower_bound(std::make_pair(dateKey(from), 0u));
+		 entry != datesOfBirth.end() && entry->first <= toKey; entry++)
+	{
+		matches.push_back(entry->second);
+	}
+
+	return matches;
+}
+
+/**
+ * \brief		: Method to find the students living in a range of postal codes
+ * \param[IN]	: unsigned short from - lowest postal code
+ * \param[IN]	: unsigned short to - highest postal code, equal to from for a single postal code
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by postal code, then matrikel number
+ */
+std::vector<unsigned int> StudentAttributeIndex::findByPostalCode(unsigned short from, unsigned short to) const
+{
+	std::vector<unsigned int> matches;
+
+	for (auto entry = postalCodes.lower_bound(std::make_pair(from, 0u));
+		 entry != postalCodes.end() && entry->first <= to; entry++)
+	{
+		matches.push_back(entry->second);
+	}
+
+	return matches;
+}
+
+/**
+ * \brief		: Method to find the students living in a city
+ * \param[IN]	: const std::string &city - city name, case insensitive
+ * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+ */
+std::vector<unsigned int> StudentAttributeIndex::findByCity(const std::string &city) const
+{
+	auto cityStudents = cities.find(StudentNameIndex::fold(city));
+	if (cityStudents == cities.end())
+	{
+		return std::vector<unsigned int>();
+	}
+	return cityStudents->second;
+}
+
+/**
+ * \brief		: Methods to count the students a find method would return, used to plan queries
+ * \param[IN]	: std::size_t limit - counting stops here, a range is walked at most this far
+ * \return		: std::size_t - number of students, at most limit
+ */
+std::size_t StudentAttributeIndex::countByDateOfBirth(const Poco::Data::Date &from, const Poco::Data::Date &to,
+													  std::size_t limit) const
+{
+	std::size_t count = 0;
+	int toKey = dateKey(to);
+
+	for (auto entry = datesOfBirth.lower_bound(std::make_pair(dateKey(from), 0u));
+		 entry != datesOfBirth.end() && entry->first <= toKey && count < limit; entry++)
+	{
+		count++;
+	}
+
+	return count;
+}
+
+std::size_t StudentAttributeIndex::countByPostalCode(unsigned short from, unsigned short to, std::size_t limit) const
+{
+	std::size_t count = 0;
+
+	for (auto entry = postalCodes.lower_bound(std::make_pair(from, 0u));
+		 entry != postalCodes.end() && entry->first <= to && count < limit; entry++)
+	{
+		count++;
+	}
+
+	return count;
+}
+
+std::size_t StudentAttributeIndex::countByCity(const std::string &city) const
+{
+	auto cityStudents = cities.find(StudentNameIndex::fold(city));
+	return cityStudents == cities.end() ? 0 : cityStudents->second.size();
+}
+
+/**
+ * \brief		: Helper method to compute the ordered key of a date
+ * \param[IN]	: const Poco::Data::Date &date - date
+ * \return		: int - year * 10000 + month * 100 + day
+ */
+int StudentAttributeIndex::dateKey(const Poco::Data::Date &date)
+{
+	return date.year() * 10000 + date.month() * 100 + date.day();
+}
+
+/**
+ * \brief		: Helper method to remove a student from the list of a city
+ * \param[IN]	: const std::string &city - case folded city name
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \return		: NONE
+ */
+void StudentAttributeIndex::removeFromCity(const std::string &city, unsigned int matrikelNumber)
+{
+	auto cityStudents = cities.find(city);
+	if (cityStudents == cities.end())
+	{
+		return;
+	}
+
+	auto position = std::lower_bound(cityStudents->second.begin(), cityStudents->second.end(), matrikelNumber);
+	if (position != cityStudents->second.end() && *position == matrikelNumber)
+	{
+		cityStudents->second.erase(position);
+	}
+	if (cityStudents->second.empty())
+	{
+		cities.erase(cityStudents);
+	}
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the keys of all attributes as ATTRIBUTE_INDEX
+ * \return		: NONE
+ */
+void StudentAttributeIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::ATTRIBUTE_INDEX, studentKeys.size());
+	report.addTreeNodes(MemoryReport::ATTRIBUTE_INDEX, datesOfBirth);
+	report.addTreeNodes(MemoryReport::ATTRIBUTE_INDEX, postalCodes);
+	report.addHashTable(MemoryReport::ATTRIBUTE_INDEX, cities);
+	for (const auto &city: cities)
+	{
+		report.addString(MemoryReport::ATTRIBUTE_INDEX, city.first);
+		report.addVector(MemoryReport::ATTRIBUTE_INDEX, city.second);
+	}
+	report.addHashTable(MemoryReport::ATTRIBUTE_INDEX, studentKeys);
+	for (const auto &keys: studentKeys)
+	{
+		report.addString(MemoryReport::ATTRIBUTE_INDEX, keys.second.city);
+	}
+}
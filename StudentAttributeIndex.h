@@ -0,0 +1,140 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentAttributeIndex.h
+ *	\brief Header file for StudentAttributeIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTATTRIBUTEINDEX_H_
+#define STUDENTATTRIBUTEINDEX_H_
+
+//! System Includes
+#include <cstddef>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "MemoryReport.h"
+#include "Poco/Data/Date.h"
+
+/**
+ * \brief		: Secondary indexes on the date of birth, postal code and city of the students
+ * \details		: Date of birth and postal code are kept in ordered sets of (key, matrikel number),
+ *				  so a range is found by binary search and read in the order of the key. Cities
+ *				  are hashed by their case folded name to a sorted list of matrikel numbers.
+ *				  A query costs O(log n + k) for k results instead of a pass over all students.
+ */
+class StudentAttributeIndex
+{
+private:
+
+	/**
+	 * \brief		: Keys of one student, to remove the old entries on a change
+	 */
+	struct Keys
+	{
+		int dateOfBirth;				//!< year * 10000 + month * 100 + day
+		unsigned short postalCode;
+		std::string city;				//!< case folded
+	};
+
+	/**
+	 * \brief		: Date of birth key with the matrikel number
+	 */
+	std::set<std::pair<int, unsigned int>> datesOfBirth;
+
+	/**
+	 * \brief		: Postal code with the matrikel number
+	 */
+	std::set<std::pair<unsigned short, unsigned int>> postalCodes;
+
+	/**
+	 * \brief		: Students by case folded city name, each list in ascending matrikel order
+	 */
+	std::unordered_map<std::string, std::vector<unsigned int>> cities;
+
+	/**
+	 * \brief		: Indexed keys of every student
+	 */
+	std::unordered_map<unsigned int, Keys> studentKeys;
+
+	/**
+	 * \brief		: Helper method to compute the ordered key of a date
+	 * \param[IN]	: const Poco::Data::Date &date - date
+	 * \return		: int - year * 10000 + month * 100 + day
+	 */
+	static int dateKey(const Poco::Data::Date &date);
+
+	/**
+	 * \brief		: Helper method to remove a student from the list of a city
+	 * \param[IN]	: const std::string &city - case folded city name
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \return		: NONE
+	 */
+	void removeFromCity(const std::string &city, unsigned int matrikelNumber);
+
+public:
+
+	/**
+	 * \brief		: Method to add a student or move it to its new date of birth and address
+	 * \param[IN]	: const Student &student - student with the current attributes
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students born in a period
+	 * \param[IN]	: const Poco::Data::Date &from - first day of the period
+	 * \param[IN]	: const Poco::Data::Date &to - last day of the period
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by date of birth, then matrikel number
+	 */
+	std::vector<unsigned int> findByDateOfBirth(const Poco::Data::Date &from, const Poco::Data::Date &to) const;
+
+	/**
+	 * \brief		: Method to find the students living in a range of postal codes
+	 * \param[IN]	: unsigned short from - lowest postal code
+	 * \param[IN]	: unsigned short to - highest postal code, equal to from for a single postal code
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by postal code, then matrikel number
+	 */
+	std::vector<unsigned int> findByPostalCode(unsigned short from, unsigned short to) const;
+
+	/**
+	 * \brief		: Method to find the students living in a city
+	 * \param[IN]	: const std::string &city - city name, case insensitive
+	 * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+	 */
+	std::vector<unsigned int> findByCity(const std::string &city) const;
+
+	/**
+	 * \brief		: Methods to count the students a find method would return, used to plan queries
+	 * \param[IN]	: std::size_t limit - counting stops here, a range is walked at most this far
+	 * \return		: std::size_t - number of students, at most limit
+	 */
+	std::size_t countByDateOfBirth(const Poco::Data::Date &from, const Poco::Data::Date &to, std::size_t limit) const;
+	std::size_t countByPostalCode(unsigned short from, unsigned short to, std::size_t limit) const;
+	std::size_t countByCity(const std::string &city) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the keys of all attributes as ATTRIBUTE_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTATTRIBUTEINDEX_H_ */
@@ -0,0 +1,404 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentBitmap.cpp
+ *	\brief Source file for StudentBitmap class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+
+//! User Includes
+#include "StudentBitmap.h"
+
+namespace
+{
+	const std::size_t bitsetWords = 65536 / 64;
+
+	std::uint16_t upperHalf(unsigned int value)
+	{
+		return static_cast<std::uint16_t>(value >> 16);
+	}
+
+	std::uint16_t lowerHalf(unsigned int value)
+	{
+		return static_cast<std::uint16_t>(value & 0xFFFF);
+	}
+
+	std::size_t countBits(const std::vector<std::uint64_t> &bits)
+	{
+		std::size_t count = 0;
+		for (std::uint64_t word: bits)
+		{
+			count += __builtin_popcountll(word);
+		}
+		return count;
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+bool StudentBitmap::Container::contains(std::uint16_t value) const
+{
+	if (isBitset())
+	{
+		return (bits[value >> 6] >> (value & 63)) & 1;
+	}
+	return std::binary_search(values.begin(), values.end(), value);
+}
+
+/**
+ * \brief		: Method to add a matrikel number
+ * \param[IN]	: unsigned int value - matrikel number
+ * \return		: NONE
+ */
+void StudentBitmap::add(unsigned int value)
+{
+	std::uint16_t key = upperHalf(value), low = lowerHalf(value);
+	auto chunk = std::lower_bound(containers.begin(), containers.end(), key,
+								  [](const std::pair<std::uint16_t, Container> &entry, std::uint16_t key) { return entry.first < key; });
+	if (chunk == containers.end() || chunk->first != key)
+	{
+		chunk = containers.insert(chunk, std::make_pair(key, Container()));
+	}
+
+	Container &container = chunk->second;
+	if (container.isBitset())
+	{
+		std::uint64_t &word = container.bits[low >> 6];
+		std::uint64_t mask = std::uint64_t(1) << (low & 63);
+		container.cardinality += (word & mask) == 0;
+		word |= mask;
+		return;
+	}
+
+	auto position = std::lower_bound(container.values.begin(), container.values.end(), low);
+	if (position != container.values.end() && *position == low)
+	{
+		return;
+	}
+	container.values.insert(position, low);
+	container.cardinality++;
+	if (container.cardinality > arrayLimit)
+	{
+		toBitset(container);
+	}
+}
+
+/**
+ * \brief		: Method to remove a matrikel number
+ * \param[IN]	: unsigned int value - matrikel number
+ * \return		: NONE
+ */
+void StudentBitmap::remove(unsigned int value)
+{
+	std::uint16_t key = upperHalf(value), low = lowerHalf(value);
+	auto chunk = std::lower_bound(containers.begin(), containers.end(), key,
+								  [](const std::pair<std::uint16_t, Container> &entry, std::uint16_t key) { return entry.first < key; });
+	if (chunk == containers.end() || chunk->first != key || !chunk->second.contains(low))
+	{
+		return;
+	}
+
+	Container &container = chunk->second;
+	if (container.isBitset())
+	{
+		container.bits[low >> 6] &= ~(std::uint64_t(1) << (low & 63));
+		if (--container.cardinality <= arrayLimit)
+		{
+			toArray(container);
+		}
+	}
+	else
+	{
+		container.values.erase(std::lower_bound(container.values.begin(), container.values.end(), low));
+		container.cardinality--;
+	}
+
+	if (container.cardinality == 0)
+	{
+		containers.erase(chunk);
+	}
+}
+
+/**
+ * \brief		: Method to check for a matrikel number
+ * \param[IN]	: unsigned int value - matrikel number
+ * \return		: bool - true if the number is in the set
+ */
+bool StudentBitmap::contains(unsigned int value) const
+{
+	std::uint16_t key = upperHalf(value);
+	auto chunk = std::lower_bound(containers.begin(), containers.end(), key,
+								  [](const std::pair<std::uint16_t, Container> &entry, std::uint16_t key) { return entry.first < key; });
+	return chunk != containers.end() && chunk->first == key && chunk->second.contains(lowerHalf(value));
+}
+
+/**
+ * \brief		: Method to count the members
+ * \param		: NONE
+ * \return		: std::size_t - number of matrikel numbers in the set
+ */
+std::size_t StudentBitmap::cardinality() const
+{
+	std::size_t count = 0;
+	for (const auto &chunk: containers)
+	{
+		count += chunk.second.cardinality;
+	}
+	return count;
+}
+
+/**
+ * \brief		: Method to compute the members of both sets
+ * \param[IN]	: const StudentBitmap &other - second set
+ * \return		: StudentBitmap - intersection
+ */
+StudentBitmap StudentBitmap::intersect(const StudentBitmap &other) const
+{
+	StudentBitmap result;
+	auto a = containers.begin(), b = other.containers.begin();
+
+	while (a != containers.end() && b != other.containers.end())
+	{
+		if (a->first < b->first)
+		{
+			a++;
+		}
+		else if (b->first < a->first)
+		{
+			b++;
+		}
+		else
+		{
+			Container both = intersect(a->second, b->second);
+			if (both.cardinality > 0)
+			{
+				result.containers.push_back(std::make_pair(a->first, std::move(both)));
+			}
+			a++;
+			b++;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * \brief		: Method to compute the members of either set
+ * \param[IN]	: const StudentBitmap &other - second set
+ * \return		: StudentBitmap - union
+ */
+StudentBitmap StudentBitmap::unite(const StudentBitmap &other) const
+{
+	StudentBitmap result;
+	auto a = containers.begin(), b = other.containers.begin();
+
+	while (a != containers.end() || b != other.containers.end())
+	{
+		if (b == other.containers.end() || (a != containers.end() && a->first < b->first))
+		{
+			result.containers.push_back(*a++);
+		}
+		else if (a == containers.end() || b->first < a->first)
+		{
+			result.containers.push_back(*b++);
+		}
+		else
+		{
+			result.containers.push_back(std::make_pair(a->first, unite(a->second, b->second)));
+			a++;
+			b++;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * \brief		: Method to list the members
+ * \param		: NONE
+ * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+ */
+std::vector<unsigned int> StudentBitmap::toVector() const
+{
+	std::vector<unsigned int> members;
+	members.reserve(cardinality());
+
+	for (const auto &chunk: containers)
+	{
+		unsigned int high = static_cast<unsigned int>(chunk.first) << 16;
+
+		if (chunk.second.isBitset())
+		{
+			for (std::size_t word = 0; word < bitsetWords; word++)
+			{
+				//! Visit the set bits only, lowest first
+				for (std::uint64_t bits = chunk.second.bits[word]; bits != 0; bits &= bits - 1)
+				{
+					members.push_back(high | static_cast<unsigned int>(word * 64 + __builtin_ctzll(bits)));
+				}
+			}
+		}
+		else
+		{
+			for (std::uint16_t low: chunk.second.values)
+			{
+				members.push_back(high | low);
+			}
+		}
+	}
+
+	return members;
+}
+
+/**
+ * \brief		: Method to estimate the memory used by the set
+ * \param		: NONE
+ * \return		: std::size_t - bytes of the arrays and bitsets
+ */
+std::size_t StudentBitmap::getSizeInBytes() const
+{
+	std::size_t bytes = containers.capacity() * sizeof(containers[0]);
+	for (const auto &chunk: containers)
+	{
+		bytes += chunk.second.values.capacity() * sizeof(std::uint16_t) + chunk.second.bits.capacity() * sizeof(std::uint64_t);
+	}
+	return bytes;
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the set to a memory report
+ * \param[IN]	: MemoryReport &report - report
+ * \param[IN]	: MemoryReport::Category category - category of the owner
+ * \return		: NONE
+ */
+void StudentBitmap::reportMemory(MemoryReport &report, MemoryReport::Category category) const
+{
+	report.addVector(category, containers);
+	for (const auto &chunk: containers)
+	{
+		report.addVector(category, chunk.second.values);
+		report.addVector(category, chunk.second.bits);
+	}
+}
+
+/**
+ * \brief		: Helper methods to switch a container between array and bitset
+ * \param[INOUT]: Container &container - container to be converted
+ * \return		: NONE
+ */
+void StudentBitmap::toBitset(Container &container)
+{
+	container.bits.assign(bitsetWords, 0);
+	for (std::uint16_t value: container.values)
+	{
+		container.bits[value >> 6] |= std::uint64_t(1) << (value & 63);
+	}
+	std::vector<std::uint16_t>().swap(container.values);
+}
+
+void StudentBitmap::toArray(Container &container)
+{
+	container.values.clear();
+	container.values.reserve(container.cardinality);
+	for (std::size_t word = 0; word < bitsetWords; word++)
+	{
+		for (std::uint64_t bits = container.bits[word]; bits != 0; bits &= bits - 1)
+		{
+			container.values.push_back(static_cast<std::uint16_t>(word * 64 + __builtin_ctzll(bits)));
+		}
+	}
+	std::vector<std::uint64_t>().swap(container.bits);
+}
+
+/**
+ * \brief		: Helper methods to combine two containers of the same chunk
+ * \param[IN]	: const Container &a, const Container &b - containers
+ * \return		: Container - intersection or union, empty if nothing remains
+ */
+StudentBitmap::Container StudentBitmap::intersect(const Container &a, const Container &b)
+{
+	Container result;
+
+	if (a.isBitset() && b.isBitset())
+	{
+		result.bits.resize(bitsetWords);
+		for (std::size_t word = 0; word < bitsetWords; word++)
+		{
+			result.bits[word] = a.bits[word] & b.bits[word];
+		}
+		result.cardinality = countBits(result.bits);
+		if (result.cardinality <= arrayLimit)
+		{
+			toArray(result);
+		}
+		return result;
+	}
+
+	if (a.isBitset() || b.isBitset())
+	{
+		//! Probe the array into the bitset
+		const Container &array = a.isBitset() ? b : a;
+		const Container &bitset = a.isBitset() ? a : b;
+		for (std::uint16_t value: array.values)
+		{
+			if (bitset.contains(value))
+			{
+				result.values.push_back(value);
+			}
+		}
+	}
+	else
+	{
+		std::set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+							  std::back_inserter(result.values));
+	}
+	result.cardinality = result.values.size();
+	return result;
+}
+
+StudentBitmap::Container StudentBitmap::unite(const Container &a, const Container &b)
+{
+	Container result;
+
+	if (!a.isBitset() && !b.isBitset() && a.cardinality + b.cardinality <= arrayLimit)
+	{
+		std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+					   std::back_inserter(result.values));
+		result.cardinality = result.values.size();
+		return result;
+	}
+
+	result.bits.assign(bitsetWords, 0);
+	for (const Container *part: {&a, &b})
+	{
+		if (part->isBitset())
+		{
+			for (std::size_t word = 0; word < bitsetWords; word++)
+			{
+				result.bits[word] |= part->bits[word];
+			}
+		}
+		else
+		{
+			for (std::uint16_t value: part->values)
+			{
+				result.bits[value >> 6] |= std::uint64_t(1) << (value & 63);
+			}
+		}
+	}
+	result.cardinality = countBits(result.bits);
+	if (result.cardinality <= arrayLimit)
+	{
+		toArray(result);
+	}
+	return result;
+}
@@ -0,0 +1,146 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentBitmap.h
+ *	\brief Header file for StudentBitmap class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTBITMAP_H_
+#define STUDENTBITMAP_H_
+
+//! System Includes
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Compressed set of matrikel numbers in the layout of a roaring bitmap
+ * \details		: The numbers are split by their upper 16 bits into chunks. A chunk with at
+ *				  most 4096 members stores their lower 16 bits as a sorted array, a fuller
+ *				  chunk as a bitset of 65536 bits (8 KiB), so no chunk takes more than 8 KiB
+ *				  and a chunk of consecutive matrikel numbers costs one bit per student.
+ *				  Intersection and union work chunk by chunk: two bitsets are combined
+ *				  word by word, an array is merged with an array or probed into a bitset.
+ */
+class StudentBitmap
+{
+private:
+
+	/**
+	 * \brief		: Members of one chunk, either values or bits is used
+	 */
+	struct Container
+	{
+		std::vector<std::uint16_t> values;		//!< sorted lower halves, used up to arrayLimit members
+		std::vector<std::uint64_t> bits;		//!< 1024 words, used above arrayLimit members
+		std::size_t cardinality = 0;
+
+		bool isBitset() const
+		{
+			return !bits.empty();
+		}
+		bool contains(std::uint16_t value) const;
+	};
+
+	/**
+	 * \brief		: Members up to which a chunk is stored as array
+	 */
+	static constexpr std::size_t arrayLimit = 4096;
+
+	/**
+	 * \brief		: Chunks with at least one member, sorted by the upper 16 bits
+	 */
+	std::vector<std::pair<std::uint16_t, Container>> containers;
+
+	/**
+	 * \brief		: Helper methods to switch a container between array and bitset
+	 * \param[INOUT]: Container &container - container to be converted
+	 * \return		: NONE
+	 */
+	static void toBitset(Container &container);
+	static void toArray(Container &container);
+
+	/**
+	 * \brief		: Helper methods to combine two containers of the same chunk
+	 * \param[IN]	: const Container &a, const Container &b - containers
+	 * \return		: Container - intersection or union, empty if nothing remains
+	 */
+	static Container intersect(const Container &a, const Container &b);
+	static Container unite(const Container &a, const Container &b);
+
+public:
+
+	/**
+	 * \brief		: Method to add a matrikel number
+	 * \param[IN]	: unsigned int value - matrikel number
+	 * \return		: NONE
+	 */
+	void add(unsigned int value);
+
+	/**
+	 * \brief		: Method to remove a matrikel number
+	 * \param[IN]	: unsigned int value - matrikel number
+	 * \return		: NONE
+	 */
+	void remove(unsigned int value);
+
+	/**
+	 * \brief		: Method to check for a matrikel number
+	 * \param[IN]	: unsigned int value - matrikel number
+	 * \return		: bool - true if the number is in the set
+	 */
+	bool contains(unsigned int value) const;
+
+	/**
+	 * \brief		: Method to count the members
+	 * \param		: NONE
+	 * \return		: std::size_t - number of matrikel numbers in the set
+	 */
+	std::size_t cardinality() const;
+
+	/**
+	 * \brief		: Method to compute the members of both sets
+	 * \param[IN]	: const StudentBitmap &other - second set
+	 * \return		: StudentBitmap - intersection
+	 */
+	StudentBitmap intersect(const StudentBitmap &other) const;
+
+	/**
+	 * \brief		: Method to compute the members of either set
+	 * \param[IN]	: const StudentBitmap &other - second set
+	 * \return		: StudentBitmap - union
+	 */
+	StudentBitmap unite(const StudentBitmap &other) const;
+
+	/**
+	 * \brief		: Method to list the members
+	 * \param		: NONE
+	 * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+	 */
+	std::vector<unsigned int> toVector() const;
+
+	/**
+	 * \brief		: Method to estimate the memory used by the set
+	 * \param		: NONE
+	 * \return		: std::size_t - bytes of the arrays and bitsets
+	 */
+	std::size_t getSizeInBytes() const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the set to a memory report
+	 * \param[IN]	: MemoryReport &report - report
+	 * \param[IN]	: MemoryReport::Category category - category of the owner
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report, MemoryReport::Category category) const;
+};
+
+#endif /* STUDENTBITMAP_H_ */
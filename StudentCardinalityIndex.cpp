@@ -0,0 +1,121 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentCardinalityIndex.cpp
+ *	\brief Source file for StudentCardinalityIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! User Includes
+#include "StudentCardinalityIndex.h"
+#include "StudentEnrollmentIndex.h"
+#include "StudentNameIndex.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to add the city and the enrollments of a student
+ * \details		: Adding a value twice does not change a sketch, so this is called with
+ *				  the whole student after every added enrollment and changed address
+ * \param[IN]	: const Student &student - student with the current address and enrollments
+ * \return		: NONE
+ */
+void StudentCardinalityIndex::updateStudent(const Student &student)
+{
+	if (student.getEnrollments().empty())
+	{
+		return;
+	}
+
+	std::uint64_t cityHash = HyperLogLog::hash(StudentNameIndex::fold(student.getAddress().getCityName()));
+	for (const Enrollment &enrollment: student.getEnrollments())
+	{
+		const Course &course = enrollment.getCourse();
+		courseCities[course.getCourseKey()].addHash(cityHash);
+		majorSemesterStudents[std::make_pair(course.getMajor(), enrollment.getSemester())].add(student.getMatrikelNumber());
+	}
+}
+
+/**
+ * \brief		: Method to estimate the number of distinct cities of the students of a course
+ * \param[IN]	: unsigned int courseKey - key of the course
+ * \return		: double - approximate count, 0 for a course without enrollments
+ */
+double StudentCardinalityIndex::estimateCities(unsigned int courseKey) const
+{
+	auto cities = courseCities.find(courseKey);
+	return cities == courseCities.end() ? 0 : cities->second.estimate();
+}
+
+/**
+ * \brief		: Method to get the merged sketch of the students of a major and semester
+ * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \return		: HyperLogLog - union of the matching shards, to be merged with the sketches of other databases
+ */
+HyperLogLog StudentCardinalityIndex::getStudentSketch(unsigned char major, const std::string &semester) const
+{
+	HyperLogLog students;
+	for (const auto &shard: majorSemesterStudents)
+	{
+		if ((major == StudentEnrollmentIndex::anyMajor || shard.first.first == major)
+			&& (semester.empty() || shard.first.second == semester))
+		{
+			students.merge(shard.second);
+		}
+	}
+	return students;
+}
+
+/**
+ * \brief		: Method to estimate the number of distinct students enrolled in a major and semester
+ * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \return		: double - approximate count
+ */
+double StudentCardinalityIndex::estimateStudents(unsigned char major, const std::string &semester) const
+{
+	//! One shard needs no merged copy
+	if (major != StudentEnrollmentIndex::anyMajor && !semester.empty())
+	{
+		auto students = majorSemesterStudents.find(std::make_pair(major, semester));
+		return students == majorSemesterStudents.end() ? 0 : students->second.estimate();
+	}
+	return getStudentSketch(major, semester).estimate();
+}
+
+/**
+ * \brief		: Method to remove all sketches
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentCardinalityIndex::clear()
+{
+	courseCities.clear();
+	majorSemesterStudents.clear();
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the sketches as CARDINALITY_INDEX
+ * \return		: NONE
+ */
+void StudentCardinalityIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::CARDINALITY_INDEX, courseCities.size() + majorSemesterStudents.size());
+	report.addHashTable(MemoryReport::CARDINALITY_INDEX, courseCities);
+	for (const auto &sketch: courseCities)
+	{
+		sketch.second.reportMemory(report, MemoryReport::CARDINALITY_INDEX);
+	}
+	report.addTreeNodes(MemoryReport::CARDINALITY_INDEX, majorSemesterStudents);
+	for (const auto &sketch: majorSemesterStudents)
+	{
+		report.addString(MemoryReport::CARDINALITY_INDEX, sketch.first.second);
+		sketch.second.reportMemory(report, MemoryReport::CARDINALITY_INDEX);
+	}
+}
@@ -0,0 +1,100 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentCardinalityIndex.h
+ *	\brief Header file for StudentCardinalityIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTCARDINALITYINDEX_H_
+#define STUDENTCARDINALITYINDEX_H_
+
+//! System Includes
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+//! User Includes
+#include "Student.h"
+#include "HyperLogLog.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: HyperLogLog sketches for the distinct counts of the dashboards
+ * \details		: One sketch of the case folded cities of the students enrolled per course,
+ *				  and one sketch of the matrikel numbers per major and semester of the
+ *				  enrollments. The sketches of the major and semester combinations are the
+ *				  shards of a query leaving the major or the semester open, they are merged
+ *				  for it. The error bounds are those of HyperLogLog, 1.6 % standard error.
+ *
+ *				  Sketches only grow: a deleted enrollment or the old city of a moved student
+ *				  stays counted until the database is read again.
+ */
+class StudentCardinalityIndex
+{
+private:
+
+	/**
+	 * \brief		: Cities of the enrolled students per course key
+	 */
+	std::unordered_map<unsigned int, HyperLogLog> courseCities;
+
+	/**
+	 * \brief		: Enrolled students per major and semester
+	 */
+	std::map<std::pair<unsigned char, std::string>, HyperLogLog> majorSemesterStudents;
+
+public:
+
+	/**
+	 * \brief		: Method to add the city and the enrollments of a student
+	 * \details		: Adding a value twice does not change a sketch, so this is called with
+	 *				  the whole student after every added enrollment and changed address
+	 * \param[IN]	: const Student &student - student with the current address and enrollments
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to estimate the number of distinct cities of the students of a course
+	 * \param[IN]	: unsigned int courseKey - key of the course
+	 * \return		: double - approximate count, 0 for a course without enrollments
+	 */
+	double estimateCities(unsigned int courseKey) const;
+
+	/**
+	 * \brief		: Method to get the merged sketch of the students of a major and semester
+	 * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \return		: HyperLogLog - union of the matching shards, to be merged with the sketches of other databases
+	 */
+	HyperLogLog getStudentSketch(unsigned char major, const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to estimate the number of distinct students enrolled in a major and semester
+	 * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \return		: double - approximate count
+	 */
+	double estimateStudents(unsigned char major, const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to remove all sketches
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the sketches as CARDINALITY_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTCARDINALITYINDEX_H_ */
@@ -13,398 +13,1399 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <tuple>
 #include <boost/algorithm/string.hpp>
 
 //!User Includes
 #include "StudentDb.h"
+#include "BoundedHeap.h"
 #include "Student.h"
 #include "Course.h"
 
+namespace
+{
+	/**
+	 * \brief		: Returns the enrollment of a student in a course, nullptr if there is none
+	 */
+	const Enrollment* findEnrollment(const Student &student, unsigned int courseKey)
+	{
+		for (const Enrollment &enrollment: student.getEnrollments())
+		{
+			if (enrollment.getCourse().getCourseKey() == courseKey)
+			{
+				return &enrollment;
+			}
+		}
+		return nullptr;
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+StudentDb::StudentDb()
+	: threadPool{nullptr}
+{}
+
+/**
+ * \brief		: Method to add weekly course to the database
+ * \param[IN]	: const WeeklyCourse &course - constant weekly course object reference
+ * \return		: NONE
+ */
+void StudentDb::addWeeklyCourseToDb(const WeeklyCourse &course)
+{
+	std::unique_ptr<const Course> weeklyCoursePtr (new WeeklyCourse(course));
+	auto inserted = courses.insert(std::make_pair(course.getCourseKey(), std::move(weeklyCoursePtr)));
+
+	if (inserted.second)
+	{
+		scheduleIndex.addCourse(*inserted.first->second);
+		for (StudentDbObserver *observer: observers)
+		{
+			observer->onCourseAdded(*inserted.first->second);
+		}
+	}
+}
+
+/**
+ * \brief		: Method to add Block course to the database
+ * \param[IN]	: const BlockCourse &course - constant block course object reference
+ * \return		: NONE
+ */
+void StudentDb::addBlockCourseToDb (const BlockCourse &course)
+{
+	std::unique_ptr<const Course> blockCoursePtr (new BlockCourse(course));
+	auto inserted = courses.insert(std::make_pair(course.getCourseKey(), std::move(blockCoursePtr)));
+
+	if (inserted.second)
+	{
+		scheduleIndex.addCourse(*inserted.first->second);
+		for (StudentDbObserver *observer: observers)
+		{
+			observer->onCourseAdded(*inserted.first->second);
+		}
+	}
+}
+
+/**
+ * \brief		: Method to visit the courses in the database, ordered by course key
+ * \param[IN]	: const CourseVisitor &visitor - called per course, returns false to stop
+ * \param[IN]	: std::size_t offset - number of courses to skip
+ * \param[IN]	: std::size_t limit - number of courses to visit at most
+ * \return		: std::size_t - number of courses visited
+ */
+std::size_t StudentDb::listCourses (const CourseVisitor &visitor, std::size_t offset, std::size_t limit) const
+{
+	std::size_t visited = 0;
+	auto eachCourse = courses.begin();
+
+	for (std::size_t skipped = 0; skipped < offset && eachCourse != courses.end(); skipped++)
+	{
+		eachCourse++;
+	}
+	for (; eachCourse != courses.end() && visited < limit; eachCourse++)
+	{
+		visited++;
+		if (!visitor(*eachCourse->second))
+		{
+			break;
+		}
+	}
+
+	return visited;
+}
+
+/**
+ * \brief		: Method to add students to the database
+ * \param[IN]	: Student &student - reference to object of student class
+ * \return		: NONE
+ */
+void StudentDb::addStudentToDb(Student &student)
+{
+	auto inserted = students.insert(std::make_pair(student.getMatrikelNumber(), student));
+
+	if (inserted.second)
+	{
+		nameIndex.updateStudent(inserted.first->second);
+		fuzzyIndex.updateStudent(inserted.first->second);
+		prefixIndex.updateStudent(inserted.first->second);
+		phoneticIndex.updateStudent(inserted.first->second);
+		attributeIndex.updateStudent(inserted.first->second);
+		enrollmentIndex.updateStudent(inserted.first->second);
+		cardinalityIndex.updateStudent(inserted.first->second);
+		for (const Enrollment &enrollment: inserted.first->second.getEnrollments())
+		{
+			courseStatistics[enrollment.getCourse().getCourseKey()].addGrade(enrollment.getGrade());
+		}
+		for (StudentDbObserver *observer: observers)
+		{
+			observer->onStudentAdded(inserted.first->second);
+		}
+	}
+}
+
+/**
+ * \brief		: Method to add enrollment to the student in the database
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student to be enrolled
+ * \param[IN]	: unsigned courseKey - Course key of the course to be added to
+ * \param[IN] 	: std::string semester - Semester to which the student has to be enrolled to
+ * \param[IN]	: bool allowConflicts - true to accept a course clashing with another one of the semester
+ * \return		: EnrollmentResult - ENROLLED or the reason the enrollment was rejected
+ */
+StudentDb::EnrollmentResult StudentDb::addEnrollmentToStudent(unsigned int matrikelNumber, unsigned courseKey,
+															  std::string semester, bool allowConflicts)
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::ENROLL);
+
+	//! Reject unknown courses, the enrollment keeps a pointer to the course
+	auto course = courses.find(courseKey);
+	if (course == courses.end())
+	{
+		return UNKNOWN_COURSE;
+	}
+
+	//! Get the existing enrollments of the student
+	const std::vector<Enrollment> &enrollment = students.at(matrikelNumber).getEnrollments();
+
+	//! Iterate through the enrollments to check if the student is already enrolled to a particular course
+	for (auto eachEnrollment = enrollment.begin(); eachEnrollment != enrollment.end(); eachEnrollment++)
+	{
+		if (courseKey == eachEnrollment->getCourse().getCourseKey())
+		{
+			return ALREADY_ENROLLED;
+		}
+		else { /* do nothing */}
+	}
+
+	//! Reject a course that meets at the same time as another one of the semester
+	if (!allowConflicts && !findScheduleConflicts(matrikelNumber, courseKey, semester).empty())
+	{
+		return SCHEDULE_CONFLICT;
+	}
+
+	//! Add the enrollments to the respective student in the database
+	Enrollment enrolStudent (0, semester, course->second.get());
+	Student &student = students.at(matrikelNumber);
+	student.updateEnrollments(enrolStudent);
+	enrollmentIndex.updateStudent(student);
+	cardinalityIndex.updateStudent(student);
+
+	for (StudentDbObserver *observer: observers)
+	{
+		observer->onEnrollmentAdded(matrikelNumber, student.getEnrollments().back());
+	}
+	return ENROLLED;
+}
+
+/**
+ * \brief		: Method to find the courses of a student in a semester that clash with a course
+ * \param[IN]	: unsigned int matrikelNumber - matrikel number of an existing student
+ * \param[IN]	: unsigned int courseKey - key of an existing course
+ * \param[IN]	: const std::string &semester - semester
+ * \return		: std::vector<unsigned int> - keys of the enrolled courses meeting at the same time
+ */
+std::vector<unsigned int> StudentDb::findScheduleConflicts (unsigned int matrikelNumber, unsigned int courseKey,
+															const std::string &semester) const
+{
+	std::vector<unsigned int> clashingCourses = scheduleIndex.findConflictingCourses(*courses.at(courseKey));
+	std::vector<unsigned int> conflicts;
+
+	for (const Enrollment &enrollment: students.at(matrikelNumber).getEnrollments())
+	{
+		if (enrollment.getSemester() == semester
+			&& std::binary_search(clashingCourses.begin(), clashingCourses.end(), enrollment.getCourse().getCourseKey()))
+		{
+			conflicts.push_back(enrollment.getCourse().getCourseKey());
+		}
+	}
+
+	std::sort(conflicts.begin(), conflicts.end());
+	return conflicts;
+}
+
+/**
+ * \brief		: Method to report all clashing enrollments of a semester
+ * \details		: One pass collects the students of every course in the semester as a
+ *				  bitmap, then the bitmaps of every clashing pair of courses are intersected.
+ * \param[IN]	: const std::string &semester - semester
+ * \return		: std::vector<ScheduleConflict> - ordered by matrikel number and course keys
+ */
+std::vector<ScheduleConflict> StudentDb::reportScheduleConflicts (const std::string &semester) const
+{
+	std::map<unsigned int, StudentBitmap> courseStudents;
+	for (const auto &eachStudent: students)
+	{
+		for (const Enrollment &enrollment: eachStudent.second.getEnrollments())
+		{
+			if (enrollment.getSemester() == semester)
+			{
+				courseStudents[enrollment.getCourse().getCourseKey()].add(eachStudent.first);
+			}
+		}
+	}
+
+	//! Every clashing pair once, from its smaller course key
+	std::vector<ScheduleConflict> conflicts;
+	for (const auto &course: courseStudents)
+	{
+		for (unsigned int otherKey: scheduleIndex.findConflictingCourses(*courses.at(course.first)))
+		{
+			auto other = courseStudents.find(otherKey);
+			if (otherKey < course.first || other == courseStudents.end())
+			{
+				continue;
+			}
+			for (unsigned int matrikelNumber: course.second.intersect(other->second).toVector())
+			{
+				conflicts.push_back(ScheduleConflict{matrikelNumber, course.first, otherKey});
+			}
+		}
+	}
+
+	std::sort(conflicts.begin(), conflicts.end(), [](const ScheduleConflict &left, const ScheduleConflict &right)
+	{
+		return std::tie(left.matrikelNumber, left.firstCourseKey, left.secondCourseKey)
+			 < std::tie(right.matrikelNumber, right.firstCourseKey, right.secondCourseKey);
+	});
+	return conflicts;
+}
+
+/**
+ * \brief		: Method to get the quarter hours of the week a student spends in courses
+ * \param[IN]	: unsigned int matrikelNumber - matrikel number of an existing student
+ * \param[IN]	: const std::string &semester - semester of the enrollments
+ * \return		: WeekOccupancy - busy quarter hours of the weekly and block courses of the semester
+ */
+WeekOccupancy StudentDb::getWeekOccupancy (unsigned int matrikelNumber, const std::string &semester) const
+{
+	WeekOccupancy occupancy;
+	for (const Enrollment &enrollment: students.at(matrikelNumber).getEnrollments())
+	{
+		if (enrollment.getSemester() == semester)
+		{
+			occupancy.addCourse(enrollment.getCourse());
+		}
+	}
+	return occupancy;
+}
+
+/**
+ * \brief		: Method to get the students with the best grade point average
+ * \param[IN]	: std::size_t count - number of students to return at most
+ * \param[IN]	: unsigned char major - only students enrolled in a course of this major,
+ *				  StudentEnrollmentIndex::anyMajor for all
+ * \return		: std::vector<std::pair<unsigned int, float>> - matrikel number and grade point average,
+ *				  best (lowest) average first, students without a graded course are left out
+ */
+std::vector<std::pair<unsigned int, float>> StudentDb::rankStudentsByGrade (std::size_t count, unsigned char major) const
+{
+	typedef std::pair<unsigned int, float> RankedStudent;
+	auto better = [](const RankedStudent &left, const RankedStudent &right)
+	{
+		return left.second != right.second ? left.second < right.second : left.first < right.first;
+	};
+
+	StudentBitmap majorStudents;
+	if (major != StudentEnrollmentIndex::anyMajor)
+	{
+		majorStudents = enrollmentIndex.find(major, "", StudentEnrollmentIndex::ANY_COURSE_TYPE);
+	}
+
+	std::size_t partCount = getStudentPartCount();
+	std::vector<BoundedHeap<RankedStudent, decltype(better)>> heaps(partCount, BoundedHeap<RankedStudent, decltype(better)>(count, better));
+
+	forEachStudentPart("student ranking", partCount, [&](std::size_t part, StudentIterator first, StudentIterator last)
+	{
+		for (; first != last; first++)
+		{
+			if ((major == StudentEnrollmentIndex::anyMajor || majorStudents.contains(first->first))
+				&& first->second.getGradedCredits() > 0)
+			{
+				heaps[part].push(RankedStudent(first->first, first->second.getGradePointAverage()));
+			}
+		}
+	});
+
+	for (std::size_t part = 1; part < partCount; part++)
+	{
+		heaps[0].merge(heaps[part]);
+	}
+	return heaps[0].take();
+}
+
+/**
+ * \brief		: Method to get the courses with the most enrollments
+ * \param[IN]	: std::size_t count - number of courses to return at most
+ * \param[IN]	: const std::string &semester - only enrollments of this semester, empty for all
+ * \return		: std::vector<std::pair<unsigned int, std::size_t>> - course key and number of enrollments,
+ *				  most enrollments first, courses without an enrollment are left out
+ */
+std::vector<std::pair<unsigned int, std::size_t>> StudentDb::rankCoursesByEnrollments (std::size_t count,
+																						const std::string &semester) const
+{
+	typedef std::pair<unsigned int, std::size_t> RankedCourse;
+	auto better = [](const RankedCourse &left, const RankedCourse &right)
+	{
+		return left.second != right.second ? left.second > right.second : left.first < right.first;
+	};
+
+	std::size_t partCount = getStudentPartCount();
+	std::vector<std::unordered_map<unsigned int, std::size_t>> partCounts(partCount);
+
+	forEachStudentPart("course ranking", partCount, [&](std::size_t part, StudentIterator first, StudentIterator last)
+	{
+		for (; first != last; first++)
+		{
+			for (const Enrollment &enrollment: first->second.getEnrollments())
+			{
+				if (semester.empty() || enrollment.getSemester() == semester)
+				{
+					partCounts[part][enrollment.getCourse().getCourseKey()]++;
+				}
+			}
+		}
+	});
+
+	for (std::size_t part = 1; part < partCount; part++)
+	{
+		for (const auto &courseCount: partCounts[part])
+		{
+			partCounts[0][courseCount.first] += courseCount.second;
+		}
+	}
+
+	BoundedHeap<RankedCourse, decltype(better)> heap(count, better);
+	for (const auto &courseCount: partCounts[0])
+	{
+		heap.push(courseCount);
+	}
+	return heap.take();
+}
+
+/**
+ * \brief		: Method to estimate the number of distinct cities the students of a course live in
+ * \details		: Read from a HyperLogLog sketch in microseconds, within 3.3 % of the exact
+ *				  count in 95 % of the cases. Cities of deleted enrollments and moved students
+ *				  stay counted until the database is read again.
+ * \param[IN]	: unsigned int courseKey - key of the course
+ * \return		: double - approximate count, 0 for a course without enrollments
+ */
+double StudentDb::estimateDistinctCities (unsigned int courseKey) const
+{
+	return cardinalityIndex.estimateCities(courseKey);
+}
+
+/**
+ * \brief		: Method to estimate the number of distinct students enrolled in a major and semester
+ * \details		: The sketches per major and semester are merged for an open major or semester,
+ *				  error bounds as for estimateDistinctCities
+ * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \return		: double - approximate count
+ */
+double StudentDb::estimateDistinctStudents (unsigned char major, const std::string &semester) const
+{
+	return cardinalityIndex.estimateStudents(major, semester);
+}
+
+/**
+ * \brief		: Method to get the sketch behind estimateDistinctStudents
+ * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \return		: HyperLogLog - sketch to merge with the one of another database, e.g. a replica of another shard
+ */
+HyperLogLog StudentDb::getDistinctStudentSketch (unsigned char major, const std::string &semester) const
+{
+	return cardinalityIndex.getStudentSketch(major, semester);
+}
+
+/**
+ * \brief		: Helper method to get the number of parts the students are split into
+ * \param		: NONE
+ * \return		: std::size_t - one per worker of the thread pool and the caller, 1 without a pool
+ */
+std::size_t StudentDb::getStudentPartCount () const
+{
+	const std::size_t minStudentsPerPart = 4096;
+	std::size_t threads = threadPool != nullptr ? threadPool->getWorkerCount() + 1 : 1;
+	return std::max<std::size_t>(1, std::min(threads, students.size() / minStudentsPerPart));
+}
+
+/**
+ * \brief		: Helper method to run a function on parts of the students, on the thread pool if there is one
+ * \param[IN]	: const std::string &taskName - name of the timing record of the pool
+ * \param[IN]	: std::size_t partCount - number of parts, split by ranges of matrikel numbers
+ * \param[IN]	: const std::function<void (std::size_t, StudentIterator, StudentIterator)> &function -
+ *				  called with the part and its students [first, last), concurrently
+ * \return		: NONE
+ */
+void StudentDb::forEachStudentPart (const std::string &taskName, std::size_t partCount,
+									const std::function<void (std::size_t, StudentIterator, StudentIterator)> &function) const
+{
+	if (partCount <= 1 || threadPool == nullptr || students.empty())
+	{
+		function(0, students.begin(), students.end());
+		return;
+	}
+
+	//! Matrikel numbers are dense, equal ranges of them hold about equally many students
+	long long lowest = students.begin()->first, range = static_cast<long long>(students.rbegin()->first) - lowest + 1;
+	auto boundary = [&](std::size_t part)
+	{
+		return part == partCount ? students.end() : students.lower_bound(static_cast<int>(lowest + range * part / partCount));
+	};
+
+	threadPool->parallelFor(taskName, 0, partCount, 1, [&](std::size_t firstPart, std::size_t endPart)
+	{
+		for (std::size_t part = firstPart; part < endPart; part++)
+		{
+			function(part, boundary(part), boundary(part + 1));
+		}
+	});
+}
+
+/**
+ * \brief		: Method to search the student in the database
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \return		: bool - true if the student already exists in the database, false otherwise
+ */
+bool StudentDb::isStudentExists (unsigned int matrikelNumber) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::LOOKUP);
+	return students.find(matrikelNumber) != students.end();
+}
+
+/**
+ * \brief		: Method to search the course in the database
+ * \param[IN]	: unsigned int courseKey - course key of the course
+ * \return		: bool - true if the course already exists in the database, false otherwise
+ */
+bool StudentDb::isCourseExists (unsigned int courseKey) const
+{
+	//! Iterate through the database of courses for the course key
+	for (const auto &eachCourse: courses)
+	{
+		if (courseKey == eachCourse.second->getCourseKey())
+		{
+			//! Return true if the course exists
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief		: Method to get the student with the given matrikel number
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \return		: const Student& - student in the database
+ * \throw		: std::out_of_range if no student exists with the matrikel number
+ */
+const Student& StudentDb::getStudent(unsigned int matrikelNumber) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::LOOKUP);
+	return students.at(matrikelNumber);
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name contains a substring (case insensitive)
+ * \param[IN]	: std::string subString - string that has to be searched for in the database of students
+ * \param[IN]	: std::size_t maxResults - number of students to return at most, the first ones by matrikel number
+ * \return		: std::vector<unsigned int> - matrikel numbers of the matching students in ascending order
+ */
+std::vector<unsigned int> StudentDb::findStudents (std::string subString, std::size_t maxResults) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::SEARCH);
+
+	/** Input string from the user could be the first name or last name of the student
+	 *  Therefore both first and last names are searched, in the case folded copy of the names
+	 */
+	return nameIndex.find(subString, maxResults, threadPool);
+}
+
+/**
+ * \brief		: Method to visit the students in the database, ordered by matrikel number
+ * \param[IN]	: const StudentVisitor &visitor - called per student, returns false to stop
+ * \param[IN]	: std::size_t offset - number of students to skip
+ * \param[IN]	: std::size_t limit - number of students to visit at most
+ * \return		: std::size_t - number of students visited
+ */
+std::size_t StudentDb::listStudents (const StudentVisitor &visitor, std::size_t offset, std::size_t limit) const
+{
+	std::size_t visited = 0;
+	auto eachStudent = students.begin();
+
+	for (std::size_t skipped = 0; skipped < offset && eachStudent != students.end(); skipped++)
+	{
+		eachStudent++;
+	}
+	for (; eachStudent != students.end() && visited < limit; eachStudent++)
+	{
+		visited++;
+		if (!visitor(eachStudent->second))
+		{
+			break;
+		}
+	}
+
+	return visited;
+}
+
+/**
+ * \brief		: Method to visit the students whose first or last name contains a substring (case insensitive)
+ * \param[IN]	: const std::string &subString - string that has to be searched for in the database of students
+ * \param[IN]	: const StudentVisitor &visitor - called per matching student in matrikel order, returns false to stop
+ * \param[IN]	: std::size_t offset - number of matching students to skip
+ * \param[IN]	: std::size_t limit - number of matching students to visit at most
+ * \return		: std::size_t - number of students visited
+ */
+std::size_t StudentDb::searchStudents (const std::string &subString, const StudentVisitor &visitor,
+									   std::size_t offset, std::size_t limit) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::SEARCH);
+
+	//! Only the requested page is searched for, the scan stops behind it
+	std::size_t visited = 0;
+	std::vector<unsigned int> matches = findStudents(subString, limit < noLimit - offset ? offset + limit : noLimit);
+
+	for (std::size_t match = offset; match < matches.size() && visited < limit; match++)
+	{
+		visited++;
+		if (!visitor(students.at(matches[match])))
+		{
+			break;
+		}
+	}
+
+	return visited;
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name is closest to a misspelled name
+ * \param[IN]	: const std::string &name - name as typed, case insensitive
+ * \param[IN]	: std::size_t maxResults - number of students to return at most
+ * \param[IN]	: unsigned int maxDistance - largest edit distance considered
+ * \return		: std::vector<std::pair<unsigned int, unsigned int>> - matrikel number and edit distance
+ *				  of the closest students, by ascending distance and matrikel number
+ */
+std::vector<std::pair<unsigned int, unsigned int>> StudentDb::findStudentsFuzzy (const std::string &name, std::size_t maxResults,
+																				  unsigned int maxDistance) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::SEARCH);
+	return fuzzyIndex.find(name, maxResults, maxDistance);
+}
+
+/**
+ * \brief		: Method to autocomplete a typed prefix of a first or last name
+ * \param[IN]	: const std::string &prefix - typed prefix, case insensitive
+ * \param[IN]	: std::size_t maxResults - number of students to return at most
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by the matching name, then matrikel number
+ */
+std::vector<unsigned int> StudentDb::completeStudentName (const std::string &prefix, std::size_t maxResults) const
+{
+	return prefixIndex.complete(prefix, maxResults);
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name sounds like the given name (Kölner Phonetik)
+ * \param[IN]	: const std::string &name - name as heard, e.g. "Meier" also finds "Meyer" and "Maier"
+ * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+ */
+std::vector<unsigned int> StudentDb::findStudentsBySound (const std::string &name) const
+{
+	return phoneticIndex.find(name);
+}
+
+/**
+ * \brief		: Method to find the students born in a period
+ * \param[IN]	: const Poco::Data::Date &from - first day of the period
+ * \param[IN]	: const Poco::Data::Date &to - last day of the period
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by date of birth, then matrikel number
+ */
+std::vector<unsigned int> StudentDb::findStudentsByDateOfBirth (const Poco::Data::Date &from, const Poco::Data::Date &to) const
+{
+	return attributeIndex.findByDateOfBirth(from, to);
+}
+
+/**
+ * \brief		: Method to find the students living in a range of postal codes
+ * \param[IN]	: unsigned short from - lowest postal code
+ * \param[IN]	: unsigned short to - highest postal code, equal to from for a single postal code
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by postal code, then matrikel number
+ */
+std::vector<unsigned int> StudentDb::findStudentsByPostalCode (unsigned short from, unsigned short to) const
+{
+	return attributeIndex.findByPostalCode(from, to);
+}
+
+/**
+ * \brief		: Method to find the students living in a city
+ * \param[IN]	: const std::string &city - city name, case insensitive
+ * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+ */
+std::vector<unsigned int> StudentDb::findStudentsByCity (const std::string &city) const
+{
+	return attributeIndex.findByCity(city);
+}
+
+/**
+ * \brief		: Method to find the students with an enrollment matching major, semester and course type
+ * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \param[IN]	: StudentEnrollmentIndex::CourseType type - type of the course, ANY_COURSE_TYPE for both
+ * \return		: StudentBitmap - matrikel numbers of the students
+ */
+StudentBitmap StudentDb::findStudentsByEnrollment (unsigned char major, const std::string &semester,
+												   StudentEnrollmentIndex::CourseType type) const
+{
+	return enrollmentIndex.find(major, semester, type);
+}
+
+/**
+ * \brief		: Method to get the live grade statistics of a course
+ * \param[IN]	: unsigned int courseKey - course key
+ * \return		: const CourseGradeStatistics& - count, mean, variance, minimum, maximum and
+ *				  histogram of the grades given, empty if the course has none
+ */
+const CourseGradeStatistics& StudentDb::getCourseStatistics (unsigned int courseKey) const
+{
+	static const CourseGradeStatistics noGrades;
+
+	auto statistics = courseStatistics.find(courseKey);
+	return statistics == courseStatistics.end() ? noGrades : statistics->second;
+}
+
+/**
+ * \brief		: Method to visit the students matching a query, ordered by matrikel number
+ * \details		: The most selective indexed predicate delivers the candidates, other indexed
+ *				  predicates are intersected with them while that is cheaper than checking
+ *				  the candidates. Only the predicates left over are checked per student.
+ * \param[IN]	: const StudentQuery &query - filter, query.project gives the selected attributes
+ * \param[IN]	: const StudentVisitor &visitor - called per matching student, returns false to stop
+ * \param[IN]	: std::size_t offset - number of matching students to skip
+ * \param[IN]	: std::size_t limit - number of matching students to visit at most
+ * \return		: std::size_t - number of students visited
+ */
+std::size_t StudentDb::queryStudents (const StudentQuery &query, const StudentVisitor &visitor,
+									  std::size_t offset, std::size_t limit) const
+{
+	QueryPlan plan = planQuery(query);
+	std::size_t skipped = 0, visited = 0;
+
+	auto visit = [&](const Student &student)
+	{
+		if (!plan.exact && !query.matches(student, plan.satisfied))
+		{
+			return true;
+		}
+		if (skipped < offset)
+		{
+			skipped++;
+			return true;
+		}
+		visited++;
+		return visitor(student) && visited < limit;
+	};
+
+	if (limit == 0)
+	{
+		return 0;
+	}
+	if (plan.scan)
+	{
+		for (const auto &eachStudent: students)
+		{
+			if (!visit(eachStudent.second))
+			{
+				break;
+			}
+		}
+	}
+	else
+	{
+		for (unsigned int matrikelNumber: plan.candidates)
+		{
+			if (!visit(students.at(matrikelNumber)))
+			{
+				break;
+			}
+		}
+	}
+
+	return visited;
+}
+
+/**
+ * \brief		: Method to describe how queryStudents answers a query
+ * \param[IN]	: const StudentQuery &query - filter
+ * \return		: std::string - one line per index lookup, intersection and filter
+ */
+std::string StudentDb::explainQuery (const StudentQuery &query) const
+{
+	QueryPlan plan = planQuery(query);
+	std::ostringstream out;
+
+	for (const std::string &step: plan.steps)
+	{
+		out << step << std::endl;
+	}
+	return out.str();
+}
+
+/**
+ * \brief		: Helper method to plan a query onto the indexes
+ * \param[IN]	: const StudentQuery &query - query to be planned
+ * \return		: QueryPlan - candidates and the checks left on them
+ */
+StudentDb::QueryPlan StudentDb::planQuery (const StudentQuery &query) const
+{
+	QueryPlan plan {};
+
+	if (estimateCandidates(query, noLimit) == noLimit)
+	{
+		plan.scan = true;
+		plan.exact = query.getType() == StudentQuery::ALL_OF && query.getChildren().empty();
+		plan.steps.push_back("scan " + std::to_string(students.size()) + " students");
+	}
+	else
+	{
+		plan.scan = false;
+		plan.exact = collectCandidates(query, true, 0, plan, plan.candidates);
+	}
+
+	if (!plan.exact)
+	{
+		plan.steps.push_back("filter " + query.toString() + (plan.satisfied.empty() ? "" : ", skipping the predicates answered by an index"));
+	}
+	return plan;
+}
+
+/**
+ * \brief		: Helper method to estimate how many students an index lookup of a node delivers
+ * \param[IN]	: const StudentQuery &query - node
+ * \param[IN]	: std::size_t limit - estimates above are cut to this value
+ * \return		: std::size_t - number of students, noLimit if the node has no index
+ */
+std::size_t StudentDb::estimateCandidates (const StudentQuery &query, std::size_t limit) const
+{
+	std::size_t estimate = noLimit;
+
+	switch (query.getType())
+	{
+		case StudentQuery::CITY:
+			return std::min(attributeIndex.countByCity(query.getText()), limit);
+
+		case StudentQuery::POSTAL_CODE:
+			return attributeIndex.countByPostalCode(query.getLowNumber(), query.getHighNumber(), std::min(limit, students.size()));
+
+		case StudentQuery::BORN_BETWEEN:
+			return attributeIndex.countByDateOfBirth(query.getFromDate(), query.getToDate(), std::min(limit, students.size()));
+
+		case StudentQuery::NAME_CONTAINS:
+			//! The hits are unknown before the scan, which reads the names of all students
+			return std::min(students.size(), limit);
+
+		case StudentQuery::SEMESTER:
+			//! An empty semester would be read as any semester by the bitmap index
+			if (query.getText().empty())
+			{
+				return noLimit;
+			}
+			return std::min(enrollmentIndex.find(StudentEnrollmentIndex::anyMajor, query.getText(),
+												 StudentEnrollmentIndex::ANY_COURSE_TYPE).cardinality(), limit);
+
+		case StudentQuery::MAJOR:
+			if (query.getLowNumber() == StudentEnrollmentIndex::anyMajor)
+			{
+				return noLimit;
+			}
+			return std::min(enrollmentIndex.find(static_cast<unsigned char>(query.getLowNumber()), "",
+												 StudentEnrollmentIndex::ANY_COURSE_TYPE).cardinality(), limit);
+
+		case StudentQuery::ALL_OF:
+			//! The smallest indexed child bounds the intersection
+			for (const StudentQuery &child: query.getChildren())
+			{
+				std::size_t childEstimate = estimateCandidates(child, std::min(estimate, limit));
+				estimate = std::min(estimate, childEstimate);
+			}
+			return estimate;
+
+		case StudentQuery::ANY_OF:
+			//! A union needs an index for every child
+			estimate = 0;
+			for (const StudentQuery &child: query.getChildren())
+			{
+				std::size_t childEstimate = estimateCandidates(child, limit);
+				if (childEstimate == noLimit)
+				{
+					return noLimit;
+				}
+				estimate = std::min(estimate + childEstimate, limit);
+			}
+			return estimate;
+
+		default:
+			return noLimit;
+	}
+}
+
+/**
+ * \brief		: Helper method to collect the students of a node from the indexes
+ * \param[IN]	: const StudentQuery &query - node with an index, see estimateCandidates
+ * \param[IN]	: bool mark - true if the nodes answered exactly may be added to the satisfied nodes
+ * \param[IN]	: unsigned int depth - indentation of the explanation
+ * \param[INOUT]: QueryPlan &plan - plan, the steps and satisfied nodes are added
+ * \param[OUT]	: std::vector<unsigned int> &candidates - students in ascending order
+ * \return		: bool - true if the candidates are exactly the students matching the node
+ */
+bool StudentDb::collectCandidates (const StudentQuery &query, bool mark, unsigned int depth, QueryPlan &plan,
+								   std::vector<unsigned int> &candidates) const
+{
+	//! An intersection pays off while the other list is not much longer than the candidates
+	const std::size_t intersectFactor = 4;
+	std::string indent(2 * depth, ' ');
+	bool exact = true;
+
+	switch (query.getType())
+	{
+		case StudentQuery::CITY:
+			candidates = attributeIndex.findByCity(query.getText());
+			break;
+
+		case StudentQuery::POSTAL_CODE:
+			candidates = attributeIndex.findByPostalCode(query.getLowNumber(), query.getHighNumber());
+			std::sort(candidates.begin(), candidates.end());
+			break;
+
+		case StudentQuery::BORN_BETWEEN:
+			candidates = attributeIndex.findByDateOfBirth(query.getFromDate(), query.getToDate());
+			std::sort(candidates.begin(), candidates.end());
+			break;
+
+		case StudentQuery::NAME_CONTAINS:
+			candidates = nameIndex.find(query.getText(), noLimit, threadPool);
+			break;
+
+		case StudentQuery::SEMESTER:
+			candidates = enrollmentIndex.find(StudentEnrollmentIndex::anyMajor, query.getText(),
+											  StudentEnrollmentIndex::ANY_COURSE_TYPE).toVector();
+			break;
+
+		case StudentQuery::MAJOR:
+			candidates = enrollmentIndex.find(static_cast<unsigned char>(query.getLowNumber()), "",
+											  StudentEnrollmentIndex::ANY_COURSE_TYPE).toVector();
+			break;
+
+		case StudentQuery::ALL_OF:
+		{
+			//! Indexed children, most selective first
+			std::vector<std::pair<std::size_t, const StudentQuery*>> indexed;
+			for (const StudentQuery &child: query.getChildren())
+			{
+				std::size_t childEstimate = estimateCandidates(child, students.size());
+				if (childEstimate == noLimit)
+				{
+					exact = false;
+				}
+				else
+				{
+					indexed.push_back(std::make_pair(childEstimate, &child));
+				}
+			}
+			std::stable_sort(indexed.begin(), indexed.end(),
+							 [](const std::pair<std::size_t, const StudentQuery*> &a, const std::pair<std::size_t, const StudentQuery*> &b)
+							 { return a.first < b.first; });
+
+			plan.steps.push_back(indent + "intersect");
+			exact = collectCandidates(*indexed.front().second, mark, depth + 1, plan, candidates) && exact;
+
+			for (std::size_t child = 1; child < indexed.size(); child++)
+			{
+				if (indexed[child].first > intersectFactor * candidates.size())
+				{
+					plan.steps.push_back(indent + "  skip " + indexed[child].second->toString()
+										 + " (~" + std::to_string(indexed[child].first) + " students), checked per candidate");
+					exact = false;
+					continue;
+				}
+
+				std::vector<unsigned int> childCandidates, intersection;
+				exact = collectCandidates(*indexed[child].second, mark, depth + 1, plan, childCandidates) && exact;
+				std::set_intersection(candidates.begin(), candidates.end(), childCandidates.begin(), childCandidates.end(),
+									  std::back_inserter(intersection));
+				candidates.swap(intersection);
+			}
+			plan.steps.push_back(indent + "-> " + std::to_string(candidates.size()) + " students");
+			break;
+		}
+
+		case StudentQuery::ANY_OF:
+		{
+			//! The children of a union hold only for a part of the candidates, none of them is marked
+			plan.steps.push_back(indent + "union");
+			for (const StudentQuery &child: query.getChildren())
+			{
+				std::vector<unsigned int> childCandidates, both;
+				exact = collectCandidates(child, false, depth + 1, plan, childCandidates) && exact;
+				std::set_union(candidates.begin(), candidates.end(), childCandidates.begin(), childCandidates.end(),
+							   std::back_inserter(both));
+				candidates.swap(both);
+			}
+			plan.steps.push_back(indent + "-> " + std::to_string(candidates.size()) + " students");
+			break;
+		}
+
+		default:
+			return false;
+	}
+
+	if (query.getType() != StudentQuery::ALL_OF && query.getType() != StudentQuery::ANY_OF)
+	{
+		plan.steps.push_back(indent + "index " + query.toString() + " -> " + std::to_string(candidates.size()) + " students");
+	}
+	if (exact && mark)
+	{
+		plan.satisfied.push_back(&query);
+	}
+	return exact;
+}
+
+/**
+ * \brief		: Getter method for all students, ordered by matrikel number
+ * \param		: NONE
+ * \return		: const std::map<int, Student>& - students in the database
+ */
+const std::map<int, Student>& StudentDb::getStudents () const
+{
+	return students;
+}
+
+/**
+ * \brief		: Getter method for all courses, ordered by course key
+ * \param		: NONE
+ * \return		: const std::map<int, std::unique_ptr<const Course>>& - courses in the database
+ */
+const std::map<int, std::unique_ptr<const Course>>& StudentDb::getCourses () const
+{
+	return courses;
+}
+
+/**
+ * \brief		: Method to update student grade in the database
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: unsigned courseKey - Course key of the course to be graded
+ * \param[IN] 	: float grade - New grade for the course
+ * \return		: bool - true if the student is enrolled in the course, false otherwise
+ */
+bool StudentDb::updateStudentGradeInDb(unsigned int matrikelNumber, unsigned int courseKey, float grade)
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::GRADE_UPDATE);
+
+	//! Look up the student by the matrikulation number and update the grade of the course
+	auto student = students.find(matrikelNumber);
+	const Enrollment *enrollment = student == students.end() ? nullptr : findEnrollment(student->second, courseKey);
+	if (enrollment == nullptr)
+	{
+		return false;
+	}
 
-/********************** Method Implementations ******************************/
+	CourseGradeStatistics &statistics = courseStatistics[courseKey];
+	statistics.removeGrade(enrollment->getGrade());
+	student->second.updateGrade(courseKey, grade);
+	statistics.addGrade(grade);
 
-/**
- * \brief		: Constructor
- */
-StudentDb::StudentDb()
-{}
+	for (StudentDbObserver *observer: observers)
+	{
+		observer->onGradeUpdated(matrikelNumber, courseKey, grade);
+	}
+	return true;
+}
 
 /**
- * \brief		: Method to add weekly course to the database
- * \param[IN]	: const WeeklyCourse &course - constant weekly course object reference
- * \return		: NONE
+ * \brief		: Method to delete the enrollment of a student
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: unsigned int courseKey - Course key of the enrollment to be deleted
+ * \return		: bool - true if the enrollment was deleted, false if it does not exist
  */
-void StudentDb::addWeeklyCourseToDb(const WeeklyCourse &course)
+bool StudentDb::deleteEnrollmentFromStudent(unsigned int matrikelNumber, unsigned int courseKey)
 {
-	std::unique_ptr<const Course> weeklyCoursePtr (new WeeklyCourse(course));
-	courses.insert(std::make_pair(course.getCourseKey(), std::move(weeklyCoursePtr)));
+	auto student = students.find(matrikelNumber);
+	const Enrollment *enrollment = student == students.end() ? nullptr : findEnrollment(student->second, courseKey);
+	if (enrollment == nullptr)
+	{
+		return false;
+	}
+
+	courseStatistics[courseKey].removeGrade(enrollment->getGrade());
+	student->second.deleteEnrollment(courseKey);
+	enrollmentIndex.updateStudent(student->second);
+
+	for (StudentDbObserver *observer: observers)
+	{
+		observer->onEnrollmentDeleted(matrikelNumber, courseKey);
+	}
+	return true;
 }
 
 /**
- * \brief		: Method to add Block course to the database
- * \param[IN]	: const BlockCourse &course - constant block course object reference
- * \return		: NONE
+ * \brief		: Method to change the first name of a student
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: const std::string &firstName - new first name
+ * \return		: bool - true if the student exists, false otherwise
  */
-void StudentDb::addBlockCourseToDb (const BlockCourse &course)
+bool StudentDb::updateFirstName(unsigned int matrikelNumber, const std::string &firstName)
 {
-	std::unique_ptr<const Course> blockCoursePtr (new BlockCourse(course));
-	courses.insert(std::make_pair(course.getCourseKey(), std::move(blockCoursePtr)));
+	auto student = students.find(matrikelNumber);
+	if (student == students.end())
+	{
+		return false;
+	}
+
+	student->second.setFirstName(firstName);
+	nameIndex.updateStudent(student->second);
+	fuzzyIndex.updateStudent(student->second);
+	prefixIndex.updateStudent(student->second);
+	phoneticIndex.updateStudent(student->second);
+	notifyStudentUpdated(student->second);
+	return true;
 }
 
 /**
- * \brief		: Method to list the courses in the database
- * \param[IN]	: NONE
- * \return		: NONE
+ * \brief		: Method to change the last name of a student
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: const std::string &lastName - new last name
+ * \return		: bool - true if the student exists, false otherwise
  */
-void StudentDb::listCoursesInDb () const
+bool StudentDb::updateLastName(unsigned int matrikelNumber, const std::string &lastName)
 {
-	for(const auto &eachCourse: courses)
+	auto student = students.find(matrikelNumber);
+	if (student == students.end())
 	{
-		eachCourse.second->print ();
+		return false;
 	}
+
+	student->second.setLastName(lastName);
+	nameIndex.updateStudent(student->second);
+	fuzzyIndex.updateStudent(student->second);
+	prefixIndex.updateStudent(student->second);
+	phoneticIndex.updateStudent(student->second);
+	notifyStudentUpdated(student->second);
+	return true;
 }
 
 /**
- * \brief		: Method to add students to the database
- * \param[IN]	: Student &student - reference to object of student class
- * \return		: NONE
+ * \brief		: Method to change the date of birth of a student
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: const Poco::Data::Date &dateOfBirth - new date of birth
+ * \return		: bool - true if the student exists, false otherwise
  */
-void StudentDb::addStudentToDb(Student &student)
+bool StudentDb::updateDateOfBirth(unsigned int matrikelNumber, const Poco::Data::Date &dateOfBirth)
 {
-	students.insert(std::make_pair(student.getMatrikelNumber(), student));
+	auto student = students.find(matrikelNumber);
+	if (student == students.end())
+	{
+		return false;
+	}
+
+	student->second.setDateOfBirth(dateOfBirth);
+	attributeIndex.updateStudent(student->second);
+	notifyStudentUpdated(student->second);
+	return true;
 }
 
 /**
- * \brief		: Method to add enrollment to the student in the database
- * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student to be enrolled
- * \param[IN]	: unsigned courseKey - Course key of the course to be added to
- * \param[IN] 	: std::string semester - Semester to which the student has to be enrolled to
- * \return		: NONE
+ * \brief		: Method to change the address of a student
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \param[IN]	: const Address &address - new address
+ * \return		: bool - true if the student exists, false otherwise
  */
-void StudentDb::addEnrollmentToStudent(unsigned int matrikelNumber, unsigned courseKey, std::string semester)
+bool StudentDb::updateAddress(unsigned int matrikelNumber, const Address &address)
 {
-	//! Get the existing enrollments of the student in a local vector
-	std::vector<Enrollment> enrollment = students.at(matrikelNumber).getEnrollments();
-
-	//! Iterate through the enrollments to check if the student is already enrolled to a particular course
-	for (auto eachEnrollment = enrollment.begin(); eachEnrollment != enrollment.end(); eachEnrollment++)
+	auto student = students.find(matrikelNumber);
+	if (student == students.end())
 	{
-		if (courseKey == eachEnrollment->getCourse().getCourseKey())
-		{
-			std::cerr << "Enrollment already exists" << std::endl;
-			return;
-		}
-		else { /* do nothing */}
+		return false;
 	}
 
-	//! Add the enrollments to the respective student in the database
-	Enrollment enrolStudent (0, semester, courses.find(courseKey)->second.get());
-	students.at(matrikelNumber).updateEnrollments(enrolStudent);
+	student->second.setAddress(address);
+	attributeIndex.updateStudent(student->second);
+	cardinalityIndex.updateStudent(student->second);
+	notifyStudentUpdated(student->second);
+	return true;
 }
 
 /**
- * \brief		: Method to search the student in the database
- * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
- * \return		: bool - true if the student already exists in the database, false otherwise
+ * \brief		: Helper method to notify the observers about a changed student
+ * \param[IN]	: const Student &student - changed student
+ * \return		: NONE
  */
-bool StudentDb::isStudentExists (unsigned int matrikelNumber) const
+void StudentDb::notifyStudentUpdated(const Student &student)
 {
-	//! Iterate through the database of students for the matrikulation number
-	for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
+	for (StudentDbObserver *observer: observers)
 	{
-		if (matrikelNumber == eachStudent->second.getMatrikelNumber())
-		{
-			//! Return true if student exists in the database
-			return true;
-		}
-		else
-		{
-
-		}
+		observer->onStudentUpdated(student);
 	}
-	std::cout << "No student exists by this matrikel number" << std::endl;
-	return false;
 }
 
 /**
- * \brief		: Method to search the course in the database
- * \param[IN]	: unsigned int courseKey - course key of the course
- * \return		: bool - true if the course already exists in the database, false otherwise
+ * \brief		: Method to remove all students and courses from the database
+ * \param		: NONE
+ * \return		: NONE
  */
-bool StudentDb::isCourseExists (unsigned int courseKey) const
+void StudentDb::clear()
 {
-	//! Iterate through the database of courses for the course key
-	for (const auto &eachCourse: courses)
+	students.clear();
+	courses.clear();
+	nameIndex.clear();
+	fuzzyIndex.clear();
+	prefixIndex.clear();
+	phoneticIndex.clear();
+	attributeIndex.clear();
+	enrollmentIndex.clear();
+	courseStatistics.clear();
+	scheduleIndex.clear();
+	cardinalityIndex.clear();
+
+	for (StudentDbObserver *observer: observers)
 	{
-		if (courseKey == eachCourse.second->getCourseKey())
-		{
-			//! Return true if the course exists
-			return true;
-		}
+		observer->onCleared();
 	}
-	return false;
 }
 
 /**
- * \brief		: Method to print the student in the database
- * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \brief		: Method to register an observer that is notified about every change
+ * \param[IN]	: StudentDbObserver *observer - observer, has to outlive its registration
  * \return		: NONE
  */
-void StudentDb::printStudent(unsigned int matrikelNumber) const
+void StudentDb::addObserver(StudentDbObserver *observer)
 {
-	students.at(matrikelNumber).printStudent();
+	observers.push_back(observer);
 }
 
 /**
- * \brief		: Method to search the student in the database with a substring of their name
- * \param[IN]	: std::string subString - string that has to be searched for in the database of students
+ * \brief		: Method to unregister an observer
+ * \param[IN]	: StudentDbObserver *observer - registered observer
  * \return		: NONE
  */
-void StudentDb::searchStudentInDb (std::string subString)
+void StudentDb::removeObserver(StudentDbObserver *observer)
 {
-	/** Input string from the user could be the first name or last name of the student
-	 *  Therefore both first and last names have to be searched in the student database
-	 */
-	std::string firstNameInDb = " ";
-	std::string lastNameInDb = " ";
+	observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+}
+
+/**
+ * \brief		: Method to write the student attributes onto the stream
+ * \param[IN]	: std::ostream& out - reference to ostream object
+ * \return		: NONE
+ */
+void StudentDb::write(std::ostream &out) const
+{
+	OperationMetrics::Timer timer(metrics, OperationMetrics::WRITE);
+
+	//! Get the size of the database
+	size_t studentSize = students.size();
+	size_t courseSize = courses.size();
+
+	//! Output the course size onto the stream
+	out << courseSize << std::endl;
 
-	//! Converts the string from the user to lower case
-	boost::algorithm::to_lower(subString);
+	//! Iterate over the course database and write the course information onto the stream
+	for(const auto &eachCourse: courses)
+	{
+		eachCourse.second->write(out);
+	}
+
+	//! Output the number of students onto the stream
+	out << studentSize << std::endl;
 
-	//! Iterate through the student database and search for the student
-	for(auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
+	if (threadPool != nullptr)
 	{
-		//! Get first and last name of each student
-		firstNameInDb = eachStudent->second.getFirstName();
-		lastNameInDb = eachStudent->second.getLastName();
+		writeParallel(out);
+		return;
+	}
 
-		//! Convert the names to lower case for a more efficient search
-		boost::algorithm::to_lower(firstNameInDb);
-		boost::algorithm::to_lower(lastNameInDb);
+	//! Iterate over the student database and write the course information onto the stream
+	for (const auto &eachStudent: students)
+	{
+		eachStudent.second.write(out);
+	}
 
-		//! Find the substring in the student database
-		size_t findInFirstName = firstNameInDb.find(subString);
-		size_t findInLastName = lastNameInDb.find(subString);
+	//! Output the number of enrollments onto the stream
+	size_t enrollmentSize = 0;
+	for (const auto &eachStudent: students)
+	{
+		enrollmentSize += eachStudent.second.getEnrollments().size();
+	}
+	out << enrollmentSize << std::endl;
 
-		//! Print the student details if the substring is found in first name or last name
-		if(findInFirstName != std::string::npos || findInLastName != std::string::npos)
+	//! Write the enrollments in the format expected by read()
+	for (const auto &eachStudent: students)
+	{
+		for (const auto &enrollment: eachStudent.second.getEnrollments())
 		{
-			std::cout << "Matrikel Number: " << eachStudent->second.getMatrikelNumber()
-					  << ", Last Name: " << eachStudent->second.getLastName()
-					  << ", First Name: " << eachStudent->second.getFirstName() << std::endl;
+			out << eachStudent.first << ";" << enrollment.getCourse().getCourseKey() << ";"
+				<< enrollment.getSemester() << ";" << enrollment.getGrade() << std::endl;
 		}
 	}
 }
 
 /**
- * \brief		: Method to update student attributes such as enrollment, first name, last name, address etc..
- * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
- * \param[IN]	: unsigned int changeAttribute - Indicates which attribute has to be changed
- * 				 0 - Terminate
- *			  	 1 - First Name
- *				 2 - Last Name
- *			  	 3 - Date Of Birth
- *			  	 4 - Enrollment
- *			  	 5 - Address
- * \return		: NONE
+ * \brief		: Method to write the next part of the database file onto the stream
+ * \param[IN]	: std::ostream& out - reference to ostream object
+ * \param[INOUT]: WriteCursor &cursor - position in the file, default constructed for a new file
+ * \param[IN]	: std::size_t maxRecords - courses or students (with their enrollments) per part
+ * \return		: bool - true if more parts follow
+ * \throw		: std::out_of_range if the database was cleared or read between the parts
  */
-void StudentDb::updateStudentInDb(unsigned int matrikelNumber, unsigned int changeAttribute)
+bool StudentDb::writePart(std::ostream &out, WriteCursor &cursor, std::size_t maxRecords) const
 {
-	//! To terminate the program
-	if (changeAttribute == 0)
-	{
-		std::cout << "Terminating..." << std::endl;
-		return;
-	}
-	else
+	std::size_t records = 0;
+	while (records < maxRecords && cursor.section != WriteCursor::DONE)
 	{
-		switch(changeAttribute)
+		switch (cursor.section)
 		{
-		//! Change first name
-		case 1:
-		{
-			std::string newFirstName = " ";
-			std::cin.ignore();
-			std::cout << "Enter the new first name: " << std::endl;
-			std::cin >> newFirstName;
-
-			//! Iterate over the student database and change the first name based on the matrikulation number input
-			for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
-			{
-				if(matrikelNumber == eachStudent->second.getMatrikelNumber())
+			case WriteCursor::START:
+				//! Only keys are kept, the lines are formatted part by part
+				for (const auto &eachCourse: courses)
 				{
-					eachStudent->second.setFirstName (newFirstName);
+					cursor.courseKeys.push_back(eachCourse.first);
 				}
-			}
-			break;
-		}
-		//! Change last name
-		case 2:
-		{
-			std::string newLastName = " ";
-			std::cin.ignore ();
-			std::cout << "Enter the new last name: " << std::endl;
-			getline (std::cin, newLastName);
-
-			//! Iterate over the student database and change the last name based on the matrikulation number input
-			for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
-			{
-				if(matrikelNumber == eachStudent->second.getMatrikelNumber())
+				for (const auto &eachStudent: students)
 				{
-					eachStudent->second.setLastName(newLastName);
+					cursor.matrikelNumbers.push_back(eachStudent.first);
+					cursor.remainingEnrollments += eachStudent.second.getEnrollments().size();
 				}
-			}
-			break;
-		}
-		//! Change date of birth
-		case 3:
-		{
-			int newDate {}, newMonth {}, newYear {};
-			std::cout << "Enter the new date of birth (dd mm yyyy): " << std::endl;
-			std::cin >> newDate >> newMonth >> newYear;
+				out << cursor.courseKeys.size() << std::endl;
+				cursor.section = WriteCursor::COURSES;
+				break;
 
-			//! Iterate over the student database and change the date of birth based on the matrikulation number input
-			for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
-			{
-				if(matrikelNumber == eachStudent->second.getMatrikelNumber())
+			case WriteCursor::COURSES:
+				if (cursor.position == cursor.courseKeys.size())
 				{
-					eachStudent->second.setDateOfBirth(Poco::Data::Date (newYear, newMonth, newDate));
+					out << cursor.matrikelNumbers.size() << std::endl;
+					cursor.section = WriteCursor::STUDENTS;
+					cursor.position = 0;
+					break;
 				}
-			}
-			break;
-		}
-		//! Change enrollment
-		case 4:
-		{
-			unsigned int courseKey {}, enrollmentAction {};
-			float newGrade {};
-
-			std::cout << "1 - Change Grade" 	 << std::endl
-					  << "2 - Delete Enrollment" << std::endl;
-			std::cin >> enrollmentAction;
-
-			std::cout << "Enter the course key" << std::endl;
-			std::cin >> courseKey;
+				courses.at(cursor.courseKeys[cursor.position++])->write(out);
+				records++;
+				break;
 
-			//! Change grade of the student
-			if (1 == enrollmentAction)
-			{
-				std::cout << "Enter the new grade: " << std::endl;
-				std::cin >> newGrade;
+			case WriteCursor::STUDENTS:
+				if (cursor.position == cursor.matrikelNumbers.size())
+				{
+					out << cursor.remainingEnrollments << std::endl;
+					cursor.section = WriteCursor::ENROLLMENTS;
+					cursor.position = 0;
+					break;
+				}
+				students.at(cursor.matrikelNumbers[cursor.position++]).write(out);
+				records++;
+				break;
 
-				//! Iterate over the student database and change the grade based on the matrikulation number input
-				for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
+			case WriteCursor::ENROLLMENTS:
+				if (cursor.position == cursor.matrikelNumbers.size() || cursor.remainingEnrollments == 0)
 				{
-					if(matrikelNumber == eachStudent->second.getMatrikelNumber())
-					{
-						eachStudent->second.updateGrade(courseKey, newGrade);
-					}
+					cursor.section = WriteCursor::DONE;
+					break;
 				}
-			}
-			//! Delete enrollment
-			else if (2 == enrollmentAction)
-			{
-				//! Iterate over the student database and delete the enrollment based on the matrikulation number input
-				for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
+				for (const auto &enrollment: students.at(cursor.matrikelNumbers[cursor.position]).getEnrollments())
 				{
-					if (matrikelNumber == eachStudent->second.getMatrikelNumber())
+					if (cursor.remainingEnrollments == 0)
 					{
-						eachStudent->second.deleteEnrollment (courseKey);
+						break;
 					}
+					out << cursor.matrikelNumbers[cursor.position] << ";" << enrollment.getCourse().getCourseKey() << ";"
+						<< enrollment.getSemester() << ";" << enrollment.getGrade() << std::endl;
+					cursor.remainingEnrollments--;
 				}
-			}
-			else
-			{
-				std::cout << "Incorrect option!" << std::endl;
-			}
-			break;
-		}
-		//! Change address
-		case 5:
-		{
-			std::string newStreetName = " ", newCityName = " ", newAdditionalInfo = " ";
-			unsigned short newPostalCode {};
-
-			std::cout << "Enter the new address" << std::endl;
-			std::cout << "---------------------" << std::endl;
-
-			std::cin.ignore();
-			std::cout << "Street Name: " << std::endl;
-			getline (std::cin, newStreetName);
-
-			std::cin.ignore();
-			std::cout << "City Name: " << std::endl;
-			getline (std::cin, newCityName);
+				cursor.position++;
+				records++;
+				break;
 
-			std::cout << "Postal Code: " << std::endl;
-			std::cin >> newPostalCode;
-
-			std::cin.ignore();
-			std::cout << "Additional Info: ";
-			getline (std::cin, newAdditionalInfo);
-
-			//! Iterate over the student database and set the address based on the matrikulation number input
-			for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
-			{
-				if (matrikelNumber == eachStudent->second.getMatrikelNumber())
-				{
-					eachStudent->second.setAddress(Address(newStreetName, newPostalCode, newCityName, newAdditionalInfo));
-				}
-			}
-			break;
-		}
+			case WriteCursor::DONE:
+				break;
 		}
 	}
+	return cursor.section != WriteCursor::DONE;
 }
 
 /**
- * \brief		: Method to update student grade in the database
- * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
- * \param[IN]	: unsigned courseKey - Course key of the course to be graded
- * \param[IN] 	: float grade - New grade for the course
+ * \brief		: Helper method to write the students and enrollments, formatted in ranges on the thread pool
+ * \details		: The ranges are formatted and written a batch at a time, the memory does not grow with the database
+ * \param[IN]	: std::ostream& out - reference to ostream object
  * \return		: NONE
  */
-void StudentDb::updateStudentGradeInDb(unsigned int matrikelNumber, unsigned int courseKey, float grade)
+void StudentDb::writeParallel(std::ostream &out) const
 {
-	//! Iterate over the student database and update the grade based on the matrikulation number and course key
-	for (auto eachStudent = students.begin(); eachStudent != students.end(); eachStudent++)
+	const std::size_t studentsPerRange = 4096;
+
+	//! Ranges formatted before they are written, bounds the formatted text held in memory
+	const std::size_t rangesPerBatch = 4 * getStudentPartCount();
+
+	std::vector<const std::pair<const int, Student>*> order;
+	order.reserve(students.size());
+	for (const auto &eachStudent: students)
 	{
-		if (eachStudent->second.getMatrikelNumber() == matrikelNumber)
-		{
-			eachStudent->second.updateGrade(courseKey, grade);
-		}
+		order.push_back(&eachStudent);
 	}
+	std::size_t rangeCount = (order.size() + studentsPerRange - 1) / studentsPerRange;
 
-}
+	//! Every range of a batch is formatted on its own, the batch is written in order before the next one starts
+	std::vector<std::string> lines(rangesPerBatch);
+	auto writeBatches = [&](const std::function<void (const std::pair<const int, Student>&, std::ostream&)> &format)
+	{
+		for (std::size_t firstRange = 0; firstRange < rangeCount; firstRange += rangesPerBatch)
+		{
+			std::size_t endRange = std::min(rangeCount, firstRange + rangesPerBatch);
+			threadPool->parallelFor("export", firstRange, endRange, 1, [&](std::size_t first, std::size_t end)
+			{
+				for (std::size_t range = first; range < end; range++)
+				{
+					std::ostringstream rangeOut;
+					std::size_t endStudent = std::min(order.size(), (range + 1) * studentsPerRange);
+					for (std::size_t index = range * studentsPerRange; index < endStudent; index++)
+					{
+						format(*order[index], rangeOut);
+					}
+					lines[range - firstRange] = rangeOut.str();
+				}
+			});
 
-/**
- * \brief		: Method to write the student attributes onto the stream
- * \param[IN]	: std::ostream& out - reference to ostream object
- * \return		: NONE
- */
-void StudentDb::write(std::ostream &out)
-{
-	//! Get the size of the database
-	size_t studentSize = students.size();
-	size_t courseSize = courses.size();
+			for (std::size_t range = firstRange; range < endRange; range++)
+			{
+				out << lines[range - firstRange];
+				lines[range - firstRange].clear();
+			}
+		}
+	};
 
-	//! Output the course size onto the stream
-	out << courseSize << std::endl;
+	writeBatches([](const std::pair<const int, Student> &eachStudent, std::ostream &rangeOut)
+	{
+		eachStudent.second.write(rangeOut);
+	});
 
-	//! Iterate over the course database and write the course information onto the stream
-	for(const auto &eachCourse: courses)
+	//! The count precedes the enrollments, it is summed without formatting them
+	size_t enrollmentSize = 0;
+	for (const auto *eachStudent: order)
 	{
-		eachCourse.second->write(out);
+		enrollmentSize += eachStudent->second.getEnrollments().size();
 	}
+	out << enrollmentSize << std::endl;
 
-	//! Output the number of students onto the stream
-	out << studentSize << std::endl;
-
-	//! Iterate over the student database and write the course information onto the stream
-	for (auto eachStudent: students)
+	writeBatches([](const std::pair<const int, Student> &eachStudent, std::ostream &rangeOut)
 	{
-		eachStudent.second.write(out);
-	}
+		for (const auto &enrollment: eachStudent.second.getEnrollments())
+		{
+			rangeOut << eachStudent.first << ";" << enrollment.getCourse().getCourseKey() << ";"
+					 << enrollment.getSemester() << ";" << enrollment.getGrade() << std::endl;
+		}
+	});
 }
 
 /**
@@ -425,9 +1426,10 @@ void StudentDb::write(std::ostream &out)
  */
 void StudentDb::read(std::istream &in)
 {
+	OperationMetrics::Timer timer(metrics, OperationMetrics::READ);
+
 	//! Clear the database before reading from the file
-	students.clear();
-	courses.clear();
+	clear();
 
 	/**
 	 *  Local variable declarations
@@ -452,6 +1454,7 @@ void StudentDb::read(std::istream &in)
 
 	//! Get the number of courses from first line
 	numberOfCourses = std::stoi(lines.at(0));
+	scheduleIndex.beginBulkLoad();
 	for (i = 1; i <= numberOfCourses; i++)
 	{
 		std::vector<std::string> courseVec;
@@ -503,6 +1506,7 @@ void StudentDb::read(std::istream &in)
 		}
 
 	}
+	scheduleIndex.endBulkLoad();
 
 	//! Get the number of students
 	numberOfStudents = stoi(lines.at(i));
@@ -540,9 +1544,10 @@ void StudentDb::read(std::istream &in)
 
 	/**
 	 *  Loop variable starts from one higher to where the previous loop ends due to the format in which the
-	 *  data is obtained from the stream object
+	 *  data is obtained from the stream object. A file written in parts may hold fewer enrollments than
+	 *  announced if some were deleted meanwhile, see writePart.
 	 */
-	for(k = j + 1; k <= j + numberOfEnrollments; k++)
+	for(k = j + 1; k <= j + numberOfEnrollments && k < static_cast<int>(lines.size()); k++)
 	{
 		std::vector<std::string> enrollmentVec;
 
@@ -557,8 +1562,8 @@ void StudentDb::read(std::istream &in)
 
 		enrollmentVec.clear();
 
-		//! Add enrollment to the database
-		addEnrollmentToStudent(matrikelNumber, courseKey, semesterStr);
+		//! Add enrollment to the database, a stored timetable is kept even if it clashes
+		addEnrollmentToStudent(matrikelNumber, courseKey, semesterStr, true);
 		updateStudentGradeInDb(matrikelNumber, courseKey, grade);
 	}
 
@@ -609,6 +1614,88 @@ Poco::Data::Time StudentDb::splitTime(const std::string& timeString, char delimi
    return Poco::Data::Time(stoi(parsedTime.at(0)), stoi(parsedTime.at(1)), stoi(parsedTime.at(2)));
 }
 
+/**
+ * \brief		: Method to get the reader/writer lock of the database
+ * \param		: NONE
+ * \return		: std::shared_mutex& - lock of the database
+ */
+std::shared_mutex& StudentDb::getLock () const
+{
+	return lock;
+}
+
+/**
+ * \brief		: Method to get the operation metrics of the database
+ * \param		: NONE
+ * \return		: OperationMetrics& - metrics
+ */
+OperationMetrics& StudentDb::getMetrics () const
+{
+	return metrics;
+}
+
+/**
+ * \brief		: Method to account for the memory of the database
+ * \param		: NONE
+ * \return		: MemoryReport - bytes and objects per category with fragmentation estimates
+ */
+MemoryReport StudentDb::getMemoryReport () const
+{
+	MemoryReport report;
+
+	report.addObjects(MemoryReport::STUDENT_NODES, students.size());
+	report.addTreeNodes(MemoryReport::STUDENT_NODES, students);
+	for (const auto &eachStudent: students)
+	{
+		eachStudent.second.reportMemory(report);
+	}
+
+	report.addTreeNodes(MemoryReport::COURSES, courses);
+	for (const auto &eachCourse: courses)
+	{
+		eachCourse.second->reportMemory(report);
+	}
+
+	report.addObjects(MemoryReport::COURSE_STATISTICS, courseStatistics.size());
+	report.addHashTable(MemoryReport::COURSE_STATISTICS, courseStatistics);
+	for (const auto &statistics: courseStatistics)
+	{
+		statistics.second.reportMemory(report);
+	}
+
+	nameIndex.reportMemory(report);
+	fuzzyIndex.reportMemory(report);
+	prefixIndex.reportMemory(report);
+	phoneticIndex.reportMemory(report);
+	attributeIndex.reportMemory(report);
+	enrollmentIndex.reportMemory(report);
+	scheduleIndex.reportMemory(report);
+	cardinalityIndex.reportMemory(report);
+
+	report.measureHeap();
+	return report;
+}
+
+/**
+ * \brief		: Method to set the thread pool used by the name search scan and the export
+ * \param[IN]	: ThreadPool *threadPool - pool, has to outlive the database, nullptr for none
+ * \return		: NONE
+ */
+void StudentDb::setThreadPool (ThreadPool *threadPool)
+{
+	this->threadPool = threadPool;
+}
+
+/**
+ * \brief		: Getter method for the thread pool, e.g. for analytics over the database
+ * \param		: NONE
+ * \return		: ThreadPool* - pool set by setThreadPool, nullptr if none is set
+ */
+ThreadPool* StudentDb::getThreadPool () const
+{
+	return threadPool;
+}
+
 /**
  * \brief		: Destructor
  */
@@ -13,14 +13,34 @@
 #define STUDENTDB_H
 
 //! System Includes
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 //! User Includes
 #include "Student.h"
 #include "Course.h"
 #include "BlockCourse.h"
 #include "WeeklyCourse.h"
+#include "StudentDbObserver.h"
+#include "StudentNameIndex.h"
+#include "StudentFuzzyIndex.h"
+#include "StudentPrefixIndex.h"
+#include "StudentPhoneticIndex.h"
+#include "StudentAttributeIndex.h"
+#include "StudentEnrollmentIndex.h"
+#include "StudentQuery.h"
+#include "CourseGradeStatistics.h"
+#include "CourseScheduleIndex.h"
+#include "WeekOccupancy.h"
+#include "ThreadPool.h"
+#include "StudentCardinalityIndex.h"
+#include "OperationMetrics.h"
+#include "MemoryReport.h"
 
 class StudentDb {
 
@@ -46,7 +66,185 @@ private:
      */
     std::map<int, std::unique_ptr<const Course>> courses;
 
+    /**
+     * \brief		: Reader/writer lock for callers that share the database between threads
+     */
+    mutable std::shared_mutex lock;
+
+    /**
+     * \brief		: Observers notified about every change of the database
+     */
+    std::vector<StudentDbObserver*> observers;
+
+    /**
+     * \brief		: Case folded names of all students, serves findStudents
+     */
+    StudentNameIndex nameIndex;
+
+    /**
+     * \brief		: Edit distance index of all names, serves findStudentsFuzzy
+     */
+    StudentFuzzyIndex fuzzyIndex;
+
+    /**
+     * \brief		: Sorted names of all students, serves completeStudentName
+     */
+    StudentPrefixIndex prefixIndex;
+
+    /**
+     * \brief		: Kölner Phonetik codes of all names, serves findStudentsBySound
+     */
+    StudentPhoneticIndex phoneticIndex;
+
+    /**
+     * \brief		: Dates of birth, postal codes and cities of all students, serve the regional queries
+     */
+    StudentAttributeIndex attributeIndex;
+
+    /**
+     * \brief		: Bitmaps of the students by major, semester and course type of their enrollments
+     */
+    StudentEnrollmentIndex enrollmentIndex;
+
+    /**
+     * \brief		: Grade statistics of every graded course, kept up to date with the enrollments
+     */
+    std::unordered_map<unsigned int, CourseGradeStatistics> courseStatistics;
+
+    /**
+     * \brief		: Meeting times of all courses, serves the timetable conflict checks
+     */
+    CourseScheduleIndex scheduleIndex;
+
+    /**
+     * \brief		: HyperLogLog sketches of the distinct cities per course and students per major and semester
+     */
+    StudentCardinalityIndex cardinalityIndex;
+
+    /**
+     * \brief		: Counts and latencies of the lookups, searches, enrollments, grade updates, reads and writes
+     */
+    mutable OperationMetrics metrics;
+
+    /**
+     * \brief		: Pool for the name search scan and the export, nullptr to run them without one
+     */
+    ThreadPool *threadPool;
+
+	/**
+	 * \brief		: Helper method to notify the observers about a changed student
+	 * \param[IN]	: const Student &student - changed student
+	 * \return		: NONE
+	 */
+    void notifyStudentUpdated (const Student &student);
+
+	/**
+	 * \brief		: Helper method to write the students and enrollments, formatted in ranges on the thread pool
+	 * \details		: The ranges are formatted and written a batch at a time, the memory does not grow with the database
+	 * \param[IN]	: std::ostream& out - reference to ostream object
+	 * \return		: NONE
+	 */
+    void writeParallel (std::ostream &out) const;
+
+    typedef std::map<int, Student>::const_iterator StudentIterator;
+
+	/**
+	 * \brief		: Helper method to get the number of parts the students are split into
+	 * \param		: NONE
+	 * \return		: std::size_t - one per worker of the thread pool and the caller, 1 without a pool
+	 */
+    std::size_t getStudentPartCount () const;
+
+	/**
+	 * \brief		: Helper method to run a function on parts of the students, on the thread pool if there is one
+	 * \param[IN]	: const std::string &taskName - name of the timing record of the pool
+	 * \param[IN]	: std::size_t partCount - number of parts, split by ranges of matrikel numbers
+	 * \param[IN]	: const std::function<void (std::size_t, StudentIterator, StudentIterator)> &function -
+	 *				  called with the part and its students [first, last), concurrently
+	 * \return		: NONE
+	 */
+    void forEachStudentPart (const std::string &taskName, std::size_t partCount,
+    						 const std::function<void (std::size_t, StudentIterator, StudentIterator)> &function) const;
+
+    /**
+     * \brief		: Way a query is answered, built by planQuery
+     */
+    struct QueryPlan
+    {
+        bool scan;										//!< true if every student is checked
+        std::vector<unsigned int> candidates;			//!< students delivered by the indexes, ascending
+        std::vector<const StudentQuery*> satisfied;		//!< nodes that hold for every candidate
+        bool exact;										//!< true if no node is left to check
+        std::vector<std::string> steps;					//!< explanation, one line per step
+    };
+
+	/**
+	 * \brief		: Helper method to plan a query onto the indexes
+	 * \param[IN]	: const StudentQuery &query - query to be planned
+	 * \return		: QueryPlan - candidates and the checks left on them
+	 */
+    QueryPlan planQuery (const StudentQuery &query) const;
+
+	/**
+	 * \brief		: Helper method to estimate how many students an index lookup of a node delivers
+	 * \param[IN]	: const StudentQuery &query - node
+	 * \param[IN]	: std::size_t limit - estimates above are cut to this value
+	 * \return		: std::size_t - number of students, noLimit if the node has no index
+	 */
+    std::size_t estimateCandidates (const StudentQuery &query, std::size_t limit) const;
+
+	/**
+	 * \brief		: Helper method to collect the students of a node from the indexes
+	 * \param[IN]	: const StudentQuery &query - node with an index, see estimateCandidates
+	 * \param[IN]	: bool mark - true if the nodes answered exactly may be added to the satisfied nodes
+	 * \param[IN]	: unsigned int depth - indentation of the explanation
+	 * \param[INOUT]: QueryPlan &plan - plan, the steps and satisfied nodes are added
+	 * \param[OUT]	: std::vector<unsigned int> &candidates - students in ascending order
+	 * \return		: bool - true if the candidates are exactly the students matching the node
+	 */
+    bool collectCandidates (const StudentQuery &query, bool mark, unsigned int depth, QueryPlan &plan,
+    						std::vector<unsigned int> &candidates) const;
+
 public:
+    /**
+     * \brief		: Visitors of the query methods, return false to stop the query early
+     */
+    typedef std::function<bool (const Student &student)> StudentVisitor;
+    typedef std::function<bool (const Course &course)> CourseVisitor;
+
+    /**
+     * \brief		: Limit of the query methods that visits all results
+     */
+    static constexpr std::size_t noLimit = static_cast<std::size_t>(-1);
+
+    /**
+     * \brief		: Outcome of addEnrollmentToStudent
+     */
+    enum EnrollmentResult
+    {
+        ENROLLED,				//!< the enrollment was added
+        UNKNOWN_COURSE,			//!< no course has the key
+        ALREADY_ENROLLED,		//!< the student is already enrolled in the course
+        SCHEDULE_CONFLICT		//!< the course clashes with another one of the semester, see findScheduleConflicts
+    };
+
+    /**
+     * \brief		: Position of a database file written in parts, see writePart
+     * \details		: The keys of the courses and students and the number of enrollments are taken
+     *				  by the first part, so the counts in the file match its lines even if the
+     *				  database changes between the parts.
+     */
+    struct WriteCursor
+    {
+        enum Section {START, COURSES, STUDENTS, ENROLLMENTS, DONE};
+
+        Section section = START;
+        std::vector<int> courseKeys;				//!< courses of the file in key order
+        std::vector<int> matrikelNumbers;			//!< students of the file in matrikel order
+        std::size_t position = 0;					//!< next course or student of the section
+        std::size_t remainingEnrollments = 0;		//!< enrollment lines still to write
+    };
+
     /**
      * \brief		: Constructor
      */
@@ -67,11 +265,13 @@ public:
     void addBlockCourseToDb (const BlockCourse &course);
 
 	/**
-	 * \brief		: Method to list the courses in the database
-	 * \param[IN]	: NONE
-	 * \return		: NONE
+	 * \brief		: Method to visit the courses in the database, ordered by course key
+	 * \param[IN]	: const CourseVisitor &visitor - called per course, returns false to stop
+	 * \param[IN]	: std::size_t offset - number of courses to skip
+	 * \param[IN]	: std::size_t limit - number of courses to visit at most
+	 * \return		: std::size_t - number of courses visited
 	 */
-    void listCoursesInDb () const;
+    std::size_t listCourses (const CourseVisitor &visitor, std::size_t offset = 0, std::size_t limit = noLimit) const;
 
 	/**
 	 * \brief		: Method to add students to the database
@@ -85,9 +285,38 @@ public:
 	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student to be enrolled
 	 * \param[IN]	: unsigned courseKey - Course key of the course to be added to
 	 * \param[IN] 	: std::string semester - Semester to which the student has to be enrolled to
-	 * \return		: NONE
+	 * \param[IN]	: bool allowConflicts - true to accept a course clashing with another one of the semester
+	 * \return		: EnrollmentResult - ENROLLED or the reason the enrollment was rejected
+	 */
+    EnrollmentResult addEnrollmentToStudent(unsigned int matrikelNumber, unsigned courseKey, std::string semester,
+    							bool allowConflicts = false);
+
+	/**
+	 * \brief		: Method to find the courses of a student in a semester that clash with a course
+	 * \param[IN]	: unsigned int matrikelNumber - matrikel number of an existing student
+	 * \param[IN]	: unsigned int courseKey - key of an existing course
+	 * \param[IN]	: const std::string &semester - semester
+	 * \return		: std::vector<unsigned int> - keys of the enrolled courses meeting at the same time
+	 */
+    std::vector<unsigned int> findScheduleConflicts (unsigned int matrikelNumber, unsigned int courseKey,
+    												 const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to report all clashing enrollments of a semester
+	 * \details		: One pass collects the students of every course in the semester as a
+	 *				  bitmap, then the bitmaps of every clashing pair of courses are intersected.
+	 * \param[IN]	: const std::string &semester - semester
+	 * \return		: std::vector<ScheduleConflict> - ordered by matrikel number and course keys
 	 */
-    void addEnrollmentToStudent(unsigned int matrikelNumber, unsigned courseKey, std::string semester);
+    std::vector<ScheduleConflict> reportScheduleConflicts (const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to get the quarter hours of the week a student spends in courses
+	 * \param[IN]	: unsigned int matrikelNumber - matrikel number of an existing student
+	 * \param[IN]	: const std::string &semester - semester of the enrollments
+	 * \return		: WeekOccupancy - busy quarter hours of the weekly and block courses of the semester
+	 */
+    WeekOccupancy getWeekOccupancy (unsigned int matrikelNumber, const std::string &semester) const;
 
 	/**
 	 * \brief		: Method to search the student in the database
@@ -104,48 +333,291 @@ public:
     bool isCourseExists (unsigned int courseKey) const;
 
 	/**
-	 * \brief		: Method to print the student in the database
+	 * \brief		: Method to get the student with the given matrikel number
 	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
-	 * \return		: NONE
+	 * \return		: const Student& - student in the database
+	 * \throw		: std::out_of_range if no student exists with the matrikel number
 	 */
-    void printStudent (unsigned int matrikelNumber) const;
+    const Student& getStudent (unsigned int matrikelNumber) const;
 
 	/**
-	 * \brief		: Method to search the student in the database with a substring of their name
+	 * \brief		: Method to find the students whose first or last name contains a substring (case insensitive)
 	 * \param[IN]	: std::string subString - string that has to be searched for in the database of students
-	 * \return		: NONE
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most, the first ones by matrikel number
+	 * \return		: std::vector<unsigned int> - matrikel numbers of the matching students in ascending order
 	 */
-    void searchStudentInDb (std::string subString);
+    std::vector<unsigned int> findStudents (std::string subString, std::size_t maxResults = noLimit) const;
 
 	/**
-	 * \brief		: Method to update student attributes such as enrollment, first name, last name, address etc..
-	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
-	 * \param[IN]	: unsigned int changeAttribute - Indicates which attribute has to be changed
-	 * 				 0 - Terminate
-	 *			  	 1 - First Name
-     *				 2 - Last Name
-	 *			  	 3 - Date Of Birth
-	 *			  	 4 - Enrollment
-	 *			  	 5 - Address
-	 * \return		: NONE
+	 * \brief		: Method to find the students whose first or last name is closest to a misspelled name
+	 * \param[IN]	: const std::string &name - name as typed, case insensitive
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most
+	 * \param[IN]	: unsigned int maxDistance - largest edit distance considered
+	 * \return		: std::vector<std::pair<unsigned int, unsigned int>> - matrikel number and edit distance
+	 *				  of the closest students, by ascending distance and matrikel number
+	 */
+    std::vector<std::pair<unsigned int, unsigned int>> findStudentsFuzzy (const std::string &name, std::size_t maxResults,
+    																		unsigned int maxDistance = 2) const;
+
+	/**
+	 * \brief		: Method to autocomplete a typed prefix of a first or last name
+	 * \param[IN]	: const std::string &prefix - typed prefix, case insensitive
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by the matching name, then matrikel number
 	 */
-    void updateStudentInDb (unsigned int matrikelNumber, unsigned int changeAttribute);
+    std::vector<unsigned int> completeStudentName (const std::string &prefix, std::size_t maxResults) const;
+
+	/**
+	 * \brief		: Method to find the students whose first or last name sounds like the given name (Kölner Phonetik)
+	 * \param[IN]	: const std::string &name - name as heard, e.g. "Meier" also finds "Meyer" and "Maier"
+	 * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+	 */
+    std::vector<unsigned int> findStudentsBySound (const std::string &name) const;
+
+	/**
+	 * \brief		: Method to find the students born in a period
+	 * \param[IN]	: const Poco::Data::Date &from - first day of the period
+	 * \param[IN]	: const Poco::Data::Date &to - last day of the period
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by date of birth, then matrikel number
+	 */
+    std::vector<unsigned int> findStudentsByDateOfBirth (const Poco::Data::Date &from, const Poco::Data::Date &to) const;
+
+	/**
+	 * \brief		: Method to find the students living in a range of postal codes
+	 * \param[IN]	: unsigned short from - lowest postal code
+	 * \param[IN]	: unsigned short to - highest postal code, equal to from for a single postal code
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by postal code, then matrikel number
+	 */
+    std::vector<unsigned int> findStudentsByPostalCode (unsigned short from, unsigned short to) const;
+
+	/**
+	 * \brief		: Method to find the students living in a city
+	 * \param[IN]	: const std::string &city - city name, case insensitive
+	 * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+	 */
+    std::vector<unsigned int> findStudentsByCity (const std::string &city) const;
+
+	/**
+	 * \brief		: Method to find the students with an enrollment matching major, semester and course type
+	 * \details		: The result is a bitmap, filters on several enrollments are combined with
+	 *				  StudentBitmap::intersect and unite and counted with cardinality, e.g. the
+	 *				  students of a course of major E in WS2019:
+	 *				  findStudentsByEnrollment('E', "WS2019", StudentEnrollmentIndex::ANY_COURSE_TYPE)
+	 * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \param[IN]	: StudentEnrollmentIndex::CourseType type - type of the course, ANY_COURSE_TYPE for both
+	 * \return		: StudentBitmap - matrikel numbers of the students
+	 */
+    StudentBitmap findStudentsByEnrollment (unsigned char major, const std::string &semester,
+    										StudentEnrollmentIndex::CourseType type) const;
+
+	/**
+	 * \brief		: Method to get the live grade statistics of a course
+	 * \param[IN]	: unsigned int courseKey - course key
+	 * \return		: const CourseGradeStatistics& - count, mean, variance, minimum, maximum and
+	 *				  histogram of the grades given, empty if the course has none
+	 */
+    const CourseGradeStatistics& getCourseStatistics (unsigned int courseKey) const;
+
+	/**
+	 * \brief		: Method to get the students with the best grade point average
+	 * \details		: Every part of the students (one per worker of the thread pool) keeps
+	 *				  its best ones in a BoundedHeap, the heaps are merged at the end. Only
+	 *				  count students are held and sorted at any time.
+	 * \param[IN]	: std::size_t count - number of students to return at most
+	 * \param[IN]	: unsigned char major - only students enrolled in a course of this major,
+	 *				  StudentEnrollmentIndex::anyMajor for all
+	 * \return		: std::vector<std::pair<unsigned int, float>> - matrikel number and grade point average,
+	 *				  best (lowest) average first, students without a graded course are left out
+	 */
+    std::vector<std::pair<unsigned int, float>> rankStudentsByGrade (std::size_t count,
+    																 unsigned char major = StudentEnrollmentIndex::anyMajor) const;
+
+	/**
+	 * \brief		: Method to get the courses with the most enrollments
+	 * \details		: Counted per part of the students like rankStudentsByGrade, the counts
+	 *				  of the courses are ranked with a BoundedHeap.
+	 * \param[IN]	: std::size_t count - number of courses to return at most
+	 * \param[IN]	: const std::string &semester - only enrollments of this semester, empty for all
+	 * \return		: std::vector<std::pair<unsigned int, std::size_t>> - course key and number of enrollments,
+	 *				  most enrollments first, courses without an enrollment are left out
+	 */
+    std::vector<std::pair<unsigned int, std::size_t>> rankCoursesByEnrollments (std::size_t count,
+    																			const std::string &semester = "") const;
+
+	/**
+	 * \brief		: Method to estimate the number of distinct cities the students of a course live in
+	 * \details		: Read from a HyperLogLog sketch in microseconds, within 3.3 % of the exact
+	 *				  count in 95 % of the cases. Cities of deleted enrollments and moved students
+	 *				  stay counted until the database is read again.
+	 * \param[IN]	: unsigned int courseKey - key of the course
+	 * \return		: double - approximate count, 0 for a course without enrollments
+	 */
+    double estimateDistinctCities (unsigned int courseKey) const;
+
+	/**
+	 * \brief		: Method to estimate the number of distinct students enrolled in a major and semester
+	 * \details		: The sketches per major and semester are merged for an open major or semester,
+	 *				  error bounds as for estimateDistinctCities
+	 * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \return		: double - approximate count
+	 */
+    double estimateDistinctStudents (unsigned char major, const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to get the sketch behind estimateDistinctStudents
+	 * \param[IN]	: unsigned char major - first character of the major, StudentEnrollmentIndex::anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \return		: HyperLogLog - sketch to merge with the one of another database, e.g. a replica of another shard
+	 */
+    HyperLogLog getDistinctStudentSketch (unsigned char major, const std::string &semester) const;
+
+	/**
+	 * \brief		: Method to visit the students matching a query, ordered by matrikel number
+	 * \details		: The most selective indexed predicate delivers the candidates, other indexed
+	 *				  predicates are intersected with them while that is cheaper than checking
+	 *				  the candidates. Only the predicates left over are checked per student.
+	 * \param[IN]	: const StudentQuery &query - filter, query.project gives the selected attributes
+	 * \param[IN]	: const StudentVisitor &visitor - called per matching student, returns false to stop
+	 * \param[IN]	: std::size_t offset - number of matching students to skip
+	 * \param[IN]	: std::size_t limit - number of matching students to visit at most
+	 * \return		: std::size_t - number of students visited
+	 */
+    std::size_t queryStudents (const StudentQuery &query, const StudentVisitor &visitor,
+    						   std::size_t offset = 0, std::size_t limit = noLimit) const;
+
+	/**
+	 * \brief		: Method to describe how queryStudents answers a query
+	 * \param[IN]	: const StudentQuery &query - filter
+	 * \return		: std::string - one line per index lookup, intersection and filter
+	 */
+    std::string explainQuery (const StudentQuery &query) const;
+
+	/**
+	 * \brief		: Getter method for all students, ordered by matrikel number
+	 * \param		: NONE
+	 * \return		: const std::map<int, Student>& - students in the database
+	 */
+    const std::map<int, Student>& getStudents () const;
+
+	/**
+	 * \brief		: Getter method for all courses, ordered by course key
+	 * \param		: NONE
+	 * \return		: const std::map<int, std::unique_ptr<const Course>>& - courses in the database
+	 */
+    const std::map<int, std::unique_ptr<const Course>>& getCourses () const;
+
+	/**
+	 * \brief		: Method to visit the students in the database, ordered by matrikel number
+	 * \param[IN]	: const StudentVisitor &visitor - called per student, returns false to stop
+	 * \param[IN]	: std::size_t offset - number of students to skip
+	 * \param[IN]	: std::size_t limit - number of students to visit at most
+	 * \return		: std::size_t - number of students visited
+	 */
+    std::size_t listStudents (const StudentVisitor &visitor, std::size_t offset = 0, std::size_t limit = noLimit) const;
+
+	/**
+	 * \brief		: Method to visit the students whose first or last name contains a substring (case insensitive)
+	 * \param[IN]	: const std::string &subString - string that has to be searched for in the database of students
+	 * \param[IN]	: const StudentVisitor &visitor - called per matching student in matrikel order, returns false to stop
+	 * \param[IN]	: std::size_t offset - number of matching students to skip
+	 * \param[IN]	: std::size_t limit - number of matching students to visit at most
+	 * \return		: std::size_t - number of students visited
+	 */
+    std::size_t searchStudents (const std::string &subString, const StudentVisitor &visitor,
+    							std::size_t offset = 0, std::size_t limit = noLimit) const;
 
 	/**
 	 * \brief		: Method to update student grade in the database
 	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
 	 * \param[IN]	: unsigned courseKey - Course key of the course to be graded
 	 * \param[IN] 	: float grade - New grade for the course
+	 * \return		: bool - true if the student is enrolled in the course, false otherwise
+	 */
+    bool updateStudentGradeInDb(unsigned int matrikelNumber, unsigned int courseKey, float grade);
+
+	/**
+	 * \brief		: Method to delete the enrollment of a student
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: unsigned int courseKey - Course key of the enrollment to be deleted
+	 * \return		: bool - true if the enrollment was deleted, false if it does not exist
+	 */
+    bool deleteEnrollmentFromStudent(unsigned int matrikelNumber, unsigned int courseKey);
+
+	/**
+	 * \brief		: Method to change the first name of a student
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: const std::string &firstName - new first name
+	 * \return		: bool - true if the student exists, false otherwise
+	 */
+    bool updateFirstName(unsigned int matrikelNumber, const std::string &firstName);
+
+	/**
+	 * \brief		: Method to change the last name of a student
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: const std::string &lastName - new last name
+	 * \return		: bool - true if the student exists, false otherwise
+	 */
+    bool updateLastName(unsigned int matrikelNumber, const std::string &lastName);
+
+	/**
+	 * \brief		: Method to change the date of birth of a student
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: const Poco::Data::Date &dateOfBirth - new date of birth
+	 * \return		: bool - true if the student exists, false otherwise
+	 */
+    bool updateDateOfBirth(unsigned int matrikelNumber, const Poco::Data::Date &dateOfBirth);
+
+	/**
+	 * \brief		: Method to change the address of a student
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: const Address &address - new address
+	 * \return		: bool - true if the student exists, false otherwise
+	 */
+    bool updateAddress(unsigned int matrikelNumber, const Address &address);
+
+	/**
+	 * \brief		: Method to remove all students and courses from the database
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+    void clear();
+
+	/**
+	 * \brief		: Method to register an observer that is notified about every change
+	 * \param[IN]	: StudentDbObserver *observer - observer, has to outlive its registration
 	 * \return		: NONE
 	 */
-    void updateStudentGradeInDb(unsigned int matrikelNumber, unsigned int courseKey, float grade);
+    void addObserver(StudentDbObserver *observer);
+
+	/**
+	 * \brief		: Method to unregister an observer
+	 * \param[IN]	: StudentDbObserver *observer - registered observer
+	 * \return		: NONE
+	 */
+    void removeObserver(StudentDbObserver *observer);
 
 	/**
 	 * \brief		: Method to write the student attributes onto the stream
 	 * \param[IN]	: std::ostream& out - reference to ostream object
 	 * \return		: NONE
 	 */
-    void write(std::ostream& out);
+    void write(std::ostream& out) const;
+
+	/**
+	 * \brief		: Method to write the next part of the database file onto the stream
+	 * \details		: Takes no lock, the caller holds the shared lock during a part and may release
+	 *				  it between the parts. Courses and students added after the first part are left
+	 *				  out, so are enrollments beyond the number the file announces. Enrollments deleted
+	 *				  in between leave the file short of that number, read stops at its end.
+	 * \param[IN]	: std::ostream& out - reference to ostream object
+	 * \param[INOUT]: WriteCursor &cursor - position in the file, default constructed for a new file
+	 * \param[IN]	: std::size_t maxRecords - courses or students (with their enrollments) per part
+	 * \return		: bool - true if more parts follow
+	 * \throw		: std::out_of_range if the database was cleared or read between the parts
+	 */
+    bool writePart(std::ostream &out, WriteCursor &cursor, std::size_t maxRecords) const;
 
 	/**
 	 * \brief		: Method to read the student attributes from the stream
@@ -170,6 +642,48 @@ public:
 	 */
     Poco::Data::Time splitTime(const std::string& timeString, char delimiter);
 
+	/**
+	 * \brief		: Method to get the reader/writer lock of the database
+	 * \details		: The database itself does not lock. Front ends serving several threads
+	 *				  take a shared lock for queries and an exclusive lock for updates.
+	 * \param		: NONE
+	 * \return		: std::shared_mutex& - lock of the database
+	 */
+    std::shared_mutex& getLock () const;
+
+	/**
+	 * \brief		: Method to get the operation metrics of the database
+	 * \details		: Recording needs no lock, the metrics may be read and written out
+	 *				  while other threads use the database
+	 * \param		: NONE
+	 * \return		: OperationMetrics& - metrics
+	 */
+    OperationMetrics& getMetrics () const;
+
+	/**
+	 * \brief		: Method to account for the memory of the database
+	 * \details		: Walks the students, the courses and all indexes and adds up their
+	 *				  heap blocks per category, then reads the malloc statistics of the
+	 *				  process. Takes O(students + enrollments), callers hold a shared lock.
+	 * \param		: NONE
+	 * \return		: MemoryReport - bytes and objects per category with fragmentation estimates
+	 */
+    MemoryReport getMemoryReport () const;
+
+	/**
+	 * \brief		: Method to set the thread pool used by the name search scan and the export
+	 * \param[IN]	: ThreadPool *threadPool - pool, has to outlive the database, nullptr for none
+	 * \return		: NONE
+	 */
+    void setThreadPool (ThreadPool *threadPool);
+
+	/**
+	 * \brief		: Getter method for the thread pool, e.g. for analytics over the database
+	 * \param		: NONE
+	 * \return		: ThreadPool* - pool set by setThreadPool, nullptr if none is set
+	 */
+    ThreadPool* getThreadPool () const;
+
     /**
      * \brief		: Destructor
      */
@@ -0,0 +1,1042 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbHttpServer.cpp
+ *	\brief Source file for StudentDbHttpServer class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Poco/DateTime.h>
+#include <Poco/URI.h>
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/Net/ServerSocket.h>
+
+//! User Includes
+#include "StudentDbHttpServer.h"
+#include "CourseSlotFinder.h"
+
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+
+namespace
+{
+	//! Most students in one answer of GET /students, more are fetched with offset
+	const unsigned long maxListLimit = 1000;
+
+	//! Students or courses formatted per shared lock while a response is streamed
+	const std::size_t streamChunkRecords = 1024;
+
+	/**
+	 * \brief		: Writes a string as JSON string literal
+	 */
+	void writeJsonString(std::ostream &out, const std::string &value)
+	{
+		out << '"';
+		for (char c: value)
+		{
+			switch (c)
+			{
+				case '"':	out << "\\\""; break;
+				case '\\':	out << "\\\\"; break;
+				case '\n':	out << "\\n"; break;
+				case '\r':	out << "\\r"; break;
+				case '\t':	out << "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+					{
+						char escaped[8];
+						std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+						out << escaped;
+					}
+					else
+					{
+						out << c;
+					}
+					break;
+			}
+		}
+		out << '"';
+	}
+
+	/**
+	 * \brief		: Writes a time as "hh:mm"
+	 */
+	void writeTime(std::ostream &out, const Poco::Data::Time &time)
+	{
+		char formatted[8];
+		std::snprintf(formatted, sizeof(formatted), "%02d:%02d", time.hour(), time.minute());
+		out << '"' << formatted << '"';
+	}
+
+	/**
+	 * \brief		: Writes a date in the layout used by the generator server
+	 */
+	void writeDate(std::ostream &out, const Poco::Data::Date &date)
+	{
+		out << "{\"year\":" << date.year() << ",\"month\":" << date.month() << ",\"date\":" << date.day() << "}";
+	}
+
+	void writeStudentSummary(std::ostream &out, const Student &student)
+	{
+		out << "{\"matrikelNumber\":" << student.getMatrikelNumber() << ",\"firstName\":";
+		writeJsonString(out, student.getFirstName());
+		out << ",\"lastName\":";
+		writeJsonString(out, student.getLastName());
+		out << "}";
+	}
+
+	void writeEnrollment(std::ostream &out, unsigned int matrikelNumber, const Enrollment &enrollment)
+	{
+		out << "{\"matrikelNumber\":" << matrikelNumber
+			<< ",\"courseKey\":" << enrollment.getCourse().getCourseKey() << ",\"semester\":";
+		writeJsonString(out, enrollment.getSemester());
+		out << ",\"grade\":" << enrollment.getGrade() << "}";
+	}
+
+	void writeStudent(std::ostream &out, const Student &student)
+	{
+		const Address &address = student.getAddress();
+
+		out << "{\"matrikelNumber\":" << student.getMatrikelNumber() << ",\"firstName\":";
+		writeJsonString(out, student.getFirstName());
+		out << ",\"lastName\":";
+		writeJsonString(out, student.getLastName());
+		out << ",\"dateOfBirth\":";
+		writeDate(out, student.getDateOfBirth());
+		out << ",\"location\":{\"street\":";
+		writeJsonString(out, address.getStreet());
+		out << ",\"postCode\":" << address.getPostalCode() << ",\"city\":";
+		writeJsonString(out, address.getCityName());
+		out << ",\"additionalInfo\":";
+		writeJsonString(out, address.getAdditionalInfo());
+		out << "},\"enrollments\":[";
+
+		bool first = true;
+		for (const auto &enrollment: student.getEnrollments())
+		{
+			out << (first ? "" : ",");
+			writeEnrollment(out, student.getMatrikelNumber(), enrollment);
+			first = false;
+		}
+		out << "],\"gradePointAverage\":" << student.getGradePointAverage()
+			<< ",\"earnedCredits\":" << student.getEarnedCredits()
+			<< ",\"enrolledCredits\":" << student.getEnrolledCredits() << "}";
+	}
+
+	void writeCourseStatistics(std::ostream &out, unsigned int courseKey, const CourseGradeStatistics &statistics)
+	{
+		out << "{\"courseKey\":" << courseKey << ",\"count\":" << statistics.getCount()
+			<< ",\"mean\":" << statistics.getMean() << ",\"variance\":" << statistics.getVariance()
+			<< ",\"minimum\":" << statistics.getMinimum() << ",\"maximum\":" << statistics.getMaximum()
+			<< ",\"histogram\":[";
+		for (std::size_t bucket = 0; bucket < CourseGradeStatistics::bucketCount; bucket++)
+		{
+			out << (bucket > 0 ? "," : "") << "{\"grade\":" << CourseGradeStatistics::bucketGrades[bucket]
+				<< ",\"count\":" << statistics.getHistogram()[bucket] << "}";
+		}
+		out << "]}";
+	}
+
+	void writeCourse(std::ostream &out, const Course &course)
+	{
+		out << "{\"courseKey\":" << course.getCourseKey() << ",\"title\":";
+		writeJsonString(out, course.getTitle());
+		out << ",\"major\":";
+		writeJsonString(out, course.getMajorName());
+		out << ",\"creditPoints\":" << course.getCreditPoints();
+
+		if (const WeeklyCourse *weeklyCourse = dynamic_cast<const WeeklyCourse*>(&course))
+		{
+			out << ",\"type\":\"weekly\",\"dayOfWeek\":" << weeklyCourse->getDayOfWeek() << ",\"startTime\":";
+			writeTime(out, weeklyCourse->getStartTime());
+			out << ",\"endTime\":";
+			writeTime(out, weeklyCourse->getEndTime());
+		}
+		else if (const BlockCourse *blockCourse = dynamic_cast<const BlockCourse*>(&course))
+		{
+			out << ",\"type\":\"block\",\"startDate\":";
+			writeDate(out, blockCourse->getStartDate());
+			out << ",\"endDate\":";
+			writeDate(out, blockCourse->getEndDate());
+			out << ",\"startTime\":";
+			writeTime(out, blockCourse->getStartTime());
+			out << ",\"endTime\":";
+			writeTime(out, blockCourse->getEndTime());
+		}
+		out << "}";
+	}
+
+	/**
+	 * \brief		: Sends a small, fully built response with a content length (keeps the connection usable)
+	 */
+	void sendBody(HTTPServerResponse &response, HTTPResponse::HTTPStatus status, const std::string &body,
+				  const std::string &contentType = "application/json")
+	{
+		response.setStatusAndReason(status);
+		response.setContentType(contentType);
+		response.setContentLength(static_cast<std::streamsize>(body.size()));
+		response.send() << body;
+	}
+
+	void sendError(HTTPServerResponse &response, HTTPResponse::HTTPStatus status, const std::string &message)
+	{
+		std::ostringstream body;
+		body << "{\"error\":";
+		writeJsonString(body, message);
+		body << "}";
+		sendBody(response, status, body.str());
+	}
+
+	void sendNoContent(HTTPServerResponse &response, HTTPResponse::HTTPStatus status)
+	{
+		response.setStatusAndReason(status);
+		response.setContentLength(0);
+		response.send();
+	}
+
+	/**
+	 * \brief		: Starts a streamed response, the body is sent in chunks while it is written
+	 */
+	std::ostream& beginStream(HTTPServerResponse &response, const std::string &contentType = "application/json")
+	{
+		response.setStatusAndReason(HTTPResponse::HTTP_OK);
+		response.setContentType(contentType);
+		response.setChunkedTransferEncoding(true);
+		return response.send();
+	}
+
+	bool parseNumber(const std::string &text, unsigned long &value)
+	{
+		if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != std::string::npos)
+		{
+			return false;
+		}
+		value = std::stoul(text);
+		return true;
+	}
+
+	/**
+	 * \brief		: Parses a date in the layout yyyy-mm-dd
+	 */
+	bool parseDate(const std::string &text, Poco::Data::Date &date)
+	{
+		int year {}, month {}, day {};
+		char rest {};
+		if (std::sscanf(text.c_str(), "%4d-%2d-%2d%c", &year, &month, &day, &rest) != 3
+			|| !Poco::DateTime::isValid(year, month, day))
+		{
+			return false;
+		}
+		date = Poco::Data::Date(year, month, day);
+		return true;
+	}
+
+	bool getParameter(const Poco::URI::QueryParameters &parameters, const std::string &name, std::string &value)
+	{
+		for (const auto &parameter: parameters)
+		{
+			if (parameter.first == name)
+			{
+				value = parameter.second;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * \brief		: Handles one REST request
+	 */
+	class StudentDbRequestHandler : public Poco::Net::HTTPRequestHandler
+	{
+	private:
+		StudentDb &studentDb;
+		bool readOnly;
+
+		//! GET /students, one page of the students matching the filter
+		void listStudents(const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			std::string search, similar, prefix, soundsLike, city, postalCodeText, bornFromText, bornToText, limitText, offsetText;
+			bool hasSearch = getParameter(parameters, "search", search);
+			bool hasSimilar = getParameter(parameters, "similar", similar);
+			bool hasPrefix = getParameter(parameters, "prefix", prefix);
+			bool hasSoundsLike = getParameter(parameters, "soundsLike", soundsLike);
+			bool hasCity = getParameter(parameters, "city", city);
+			bool hasPostalCode = getParameter(parameters, "postalCode", postalCodeText);
+			bool hasBornFrom = getParameter(parameters, "bornFrom", bornFromText);
+			bool hasBornTo = getParameter(parameters, "bornTo", bornToText);
+			unsigned long offset = 0, limit = (hasSimilar || hasPrefix) ? 10 : maxListLimit;
+			if ((getParameter(parameters, "offset", offsetText) && !parseNumber(offsetText, offset))
+				|| (getParameter(parameters, "limit", limitText) && !parseNumber(limitText, limit)))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid offset or limit");
+				return;
+			}
+			limit = std::min(limit, maxListLimit);
+			std::size_t end = offset + limit;
+			unsigned long postalCode {};
+			if (hasPostalCode && (!parseNumber(postalCodeText, postalCode) || postalCode > std::numeric_limits<unsigned short>::max()))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid postal code");
+				return;
+			}
+			//! An open end of the period reaches to the first or last representable date
+			Poco::Data::Date bornFrom(0, 1, 1), bornTo(9999, 12, 31);
+			if ((hasBornFrom && !parseDate(bornFromText, bornFrom)) || (hasBornTo && !parseDate(bornToText, bornTo)))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid date, expected yyyy-mm-dd");
+				return;
+			}
+
+			std::vector<unsigned int> matches, page;
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+
+				if (hasCity || hasPostalCode || hasBornFrom || hasBornTo)
+				{
+					std::vector<unsigned int> candidates;
+					if (hasCity)
+					{
+						candidates = studentDb.findStudentsByCity(city);
+					}
+					else if (hasPostalCode)
+					{
+						candidates = studentDb.findStudentsByPostalCode(postalCode, postalCode);
+					}
+					else
+					{
+						candidates = studentDb.findStudentsByDateOfBirth(bornFrom, bornTo);
+					}
+
+					//! The index answers one filter, the others are checked on its results. Rows are
+					//! read from the map, getStudent would count a LOOKUP per row in the metrics.
+					for (unsigned int matrikelNumber: candidates)
+					{
+						const Student &student = studentDb.getStudents().at(matrikelNumber);
+						if ((hasPostalCode && student.getAddress().getPostalCode() != postalCode)
+							|| student.getDateOfBirth() < bornFrom || bornTo < student.getDateOfBirth())
+						{
+							continue;
+						}
+						matches.push_back(matrikelNumber);
+						if (matches.size() == end)
+						{
+							break;
+						}
+					}
+				}
+				else if (hasSoundsLike)
+				{
+					matches = studentDb.findStudentsBySound(soundsLike);
+				}
+				else if (hasPrefix)
+				{
+					matches = studentDb.completeStudentName(prefix, end);
+				}
+				else if (hasSimilar)
+				{
+					for (const auto &match: studentDb.findStudentsFuzzy(similar, end))
+					{
+						matches.push_back(match.first);
+					}
+				}
+				else if (hasSearch)
+				{
+					matches = studentDb.findStudents(search, end);
+				}
+				else
+				{
+					//! The students before the offset are only counted
+					std::size_t position = 0;
+					for (auto eachStudent = studentDb.getStudents().begin();
+						 eachStudent != studentDb.getStudents().end() && position < end; eachStudent++, position++)
+					{
+						if (position >= offset)
+						{
+							page.push_back(eachStudent->first);
+						}
+					}
+				}
+			}
+
+			if (matches.size() > offset)
+			{
+				page.assign(matches.begin() + offset, matches.begin() + std::min<std::size_t>(matches.size(), end));
+			}
+			streamStudentSummaries(page, response);
+		}
+
+		//! Streams the summaries of the students, formatted in chunks under the lock and sent without it
+		void streamStudentSummaries(const std::vector<unsigned int> &matrikelNumbers, HTTPServerResponse &response)
+		{
+			std::ostream &out = beginStream(response);
+			out << "[";
+
+			bool first = true;
+			std::ostringstream chunk;
+			for (std::size_t chunkBegin = 0; chunkBegin < matrikelNumbers.size(); chunkBegin += streamChunkRecords)
+			{
+				{
+					std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+					const std::map<int, Student> &students = studentDb.getStudents();
+					std::size_t chunkEnd = std::min(matrikelNumbers.size(), chunkBegin + streamChunkRecords);
+					for (std::size_t position = chunkBegin; position < chunkEnd; position++)
+					{
+						//! Gone if the database was read again since the students were found
+						auto student = students.find(matrikelNumbers[position]);
+						if (student != students.end())
+						{
+							chunk << (first ? "" : ",");
+							writeStudentSummary(chunk, student->second);
+							first = false;
+						}
+					}
+				}
+				out << chunk.str();
+				chunk.str("");
+			}
+			out << "]";
+		}
+
+		void handleStudent(const std::vector<std::string> &segments, const std::string &method,
+						   const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			unsigned long matrikelNumber {};
+			if (!parseNumber(segments[1], matrikelNumber))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid matrikel number");
+				return;
+			}
+
+			//! GET /students/{matrikel}
+			if (segments.size() == 2 && method == HTTPRequest::HTTP_GET)
+			{
+				std::ostringstream body;
+				bool found {};
+				{
+					std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+					auto student = studentDb.getStudents().find(matrikelNumber);
+					found = student != studentDb.getStudents().end();
+					if (found)
+					{
+						writeStudent(body, student->second);
+					}
+				}
+
+				if (!found)
+				{
+					sendError(response, HTTPResponse::HTTP_NOT_FOUND, "No student exists by this matrikel number");
+					return;
+				}
+				sendBody(response, HTTPResponse::HTTP_OK, body.str());
+			}
+			//! GET /students/{matrikel}/enrollments
+			else if (segments.size() == 3 && segments[2] == "enrollments" && method == HTTPRequest::HTTP_GET)
+			{
+				std::ostringstream body;
+				bool found {};
+				{
+					std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+					auto student = studentDb.getStudents().find(matrikelNumber);
+					found = student != studentDb.getStudents().end();
+					if (found)
+					{
+						body << "[";
+						bool first = true;
+						for (const auto &enrollment: student->second.getEnrollments())
+						{
+							body << (first ? "" : ",");
+							writeEnrollment(body, matrikelNumber, enrollment);
+							first = false;
+						}
+						body << "]";
+					}
+				}
+
+				if (!found)
+				{
+					sendError(response, HTTPResponse::HTTP_NOT_FOUND, "No student exists by this matrikel number");
+					return;
+				}
+				sendBody(response, HTTPResponse::HTTP_OK, body.str());
+			}
+			//! POST /students/{matrikel}/enrollments?courseKey=K&semester=S
+			else if (segments.size() == 3 && segments[2] == "enrollments" && method == HTTPRequest::HTTP_POST)
+			{
+				std::string courseKeyText, semester;
+				unsigned long courseKey {};
+				if (!getParameter(parameters, "courseKey", courseKeyText) || !parseNumber(courseKeyText, courseKey)
+						|| !getParameter(parameters, "semester", semester) || semester.empty())
+				{
+					sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "courseKey and semester are required");
+					return;
+				}
+
+				std::vector<unsigned int> conflicts;
+				std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+				if (studentDb.getStudents().count(matrikelNumber) == 0 || !studentDb.isCourseExists(courseKey))
+				{
+					writeLock.unlock();
+					sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Student or course does not exist");
+				}
+				else if (!(conflicts = studentDb.findScheduleConflicts(matrikelNumber, courseKey, semester)).empty())
+				{
+					writeLock.unlock();
+					sendError(response, HTTPResponse::HTTP_CONFLICT, "Enrollment clashes with course " + std::to_string(conflicts.front()));
+				}
+				//! The timetable was checked above, it is not checked a second time
+				else if (studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, semester, true) != StudentDb::ENROLLED)
+				{
+					writeLock.unlock();
+					sendError(response, HTTPResponse::HTTP_CONFLICT, "Enrollment already exists");
+				}
+				else
+				{
+					writeLock.unlock();
+					sendNoContent(response, HTTPResponse::HTTP_CREATED);
+				}
+			}
+			//! PUT /students/{matrikel}/enrollments/{courseKey}?grade=G
+			else if (segments.size() == 4 && segments[2] == "enrollments" && method == HTTPRequest::HTTP_PUT)
+			{
+				std::string gradeText;
+				unsigned long courseKey {};
+				float grade {};
+
+				if (!parseNumber(segments[3], courseKey) || !getParameter(parameters, "grade", gradeText))
+				{
+					sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "courseKey and grade are required");
+					return;
+				}
+				try
+				{
+					grade = std::stof(gradeText);
+				}
+				catch (std::exception &e)
+				{
+					grade = 0;
+				}
+				if (!(grade > 0 && grade < 6))
+				{
+					sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Enter a valid grade");
+					return;
+				}
+
+				bool updated {};
+				{
+					std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+					updated = studentDb.updateStudentGradeInDb(matrikelNumber, courseKey, grade);
+				}
+
+				if (updated)
+				{
+					sendNoContent(response, HTTPResponse::HTTP_NO_CONTENT);
+				}
+				else
+				{
+					sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Enrollment does not exist");
+				}
+			}
+			else
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+			}
+		}
+
+		void handleCourses(const std::vector<std::string> &segments, HTTPServerResponse &response)
+		{
+			//! GET /courses, formatted in chunks under the lock and sent without it
+			if (segments.size() == 1)
+			{
+				std::ostream &out = beginStream(response);
+				out << "[";
+
+				bool first = true, more = true;
+				int lastCourseKey = std::numeric_limits<int>::min();
+				std::ostringstream chunk;
+				while (more)
+				{
+					{
+						std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+						const std::map<int, std::unique_ptr<const Course>> &courses = studentDb.getCourses();
+						auto eachCourse = courses.upper_bound(lastCourseKey);
+						for (std::size_t count = 0; eachCourse != courses.end() && count < streamChunkRecords; eachCourse++, count++)
+						{
+							chunk << (first ? "" : ",");
+							writeCourse(chunk, *eachCourse->second);
+							first = false;
+							lastCourseKey = eachCourse->first;
+						}
+						more = eachCourse != courses.end();
+					}
+					out << chunk.str();
+					chunk.str("");
+				}
+				out << "]";
+				return;
+			}
+
+			//! GET /courses/{courseKey} and GET /courses/{courseKey}/statistics
+			unsigned long courseKey {};
+			bool statistics = segments.size() == 3 && segments[2] == "statistics";
+			if ((segments.size() != 2 && !statistics) || !parseNumber(segments[1], courseKey))
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+				return;
+			}
+
+			std::ostringstream body;
+			bool found {};
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				auto course = studentDb.getCourses().find(courseKey);
+				found = course != studentDb.getCourses().end();
+				if (found && statistics)
+				{
+					writeCourseStatistics(body, courseKey, studentDb.getCourseStatistics(courseKey));
+				}
+				else if (found)
+				{
+					writeCourse(body, *course->second);
+				}
+			}
+
+			if (!found)
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Course does not exist");
+				return;
+			}
+			sendBody(response, HTTPResponse::HTTP_OK, body.str());
+		}
+
+		//! GET /enrollments
+		void listEnrollments(HTTPServerResponse &response)
+		{
+			std::ostream &out = beginStream(response);
+			out << "[";
+
+			//! Formatted in chunks under the lock and sent without it, continuing after the last student sent
+			bool first = true, more = true;
+			int lastMatrikelNumber = std::numeric_limits<int>::min();
+			std::ostringstream chunk;
+			while (more)
+			{
+				{
+					std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+					const std::map<int, Student> &students = studentDb.getStudents();
+					auto eachStudent = students.upper_bound(lastMatrikelNumber);
+					for (std::size_t count = 0; eachStudent != students.end() && count < streamChunkRecords; eachStudent++, count++)
+					{
+						for (const auto &enrollment: eachStudent->second.getEnrollments())
+						{
+							chunk << (first ? "" : ",");
+							writeEnrollment(chunk, eachStudent->first, enrollment);
+							first = false;
+						}
+						lastMatrikelNumber = eachStudent->first;
+					}
+					more = eachStudent != students.end();
+				}
+				out << chunk.str();
+				chunk.str("");
+			}
+			out << "]";
+		}
+
+		//! GET /conflicts?semester=S
+		void listScheduleConflicts(const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			std::string semester;
+			if (!getParameter(parameters, "semester", semester) || semester.empty())
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "semester is required");
+				return;
+			}
+
+			std::vector<ScheduleConflict> conflicts;
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				conflicts = studentDb.reportScheduleConflicts(semester);
+			}
+
+			std::ostream &out = beginStream(response);
+			out << "[";
+
+			bool first = true;
+			for (const ScheduleConflict &conflict: conflicts)
+			{
+				out << (first ? "" : ",") << "{\"matrikelNumber\":" << conflict.matrikelNumber
+					<< ",\"courseKeys\":[" << conflict.firstCourseKey << "," << conflict.secondCourseKey << "]}";
+				first = false;
+			}
+			out << "]";
+		}
+
+		//! GET /slots?semester=S&duration=minutes[&major=M][&limit=10]
+		void rankSlots(const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			std::string semester, durationText, major, limitText;
+			unsigned long duration {}, limit = 10;
+			if (!getParameter(parameters, "semester", semester) || semester.empty()
+				|| !getParameter(parameters, "duration", durationText) || !parseNumber(durationText, duration)
+				|| duration == 0 || (getParameter(parameters, "limit", limitText) && !parseNumber(limitText, limit)))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "semester and duration are required");
+				return;
+			}
+			getParameter(parameters, "major", major);
+
+			//! The cohort are the students of the semester, of one major if given
+			std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+			StudentBitmap cohort = studentDb.findStudentsByEnrollment(major.empty() ? StudentEnrollmentIndex::anyMajor : major[0],
+																	  semester, StudentEnrollmentIndex::ANY_COURSE_TYPE);
+			CourseSlotFinder slotFinder(studentDb, cohort.toVector(), semester);
+			readLock.unlock();
+
+			std::ostringstream body;
+			body << "{\"students\":" << slotFinder.getStudentCount() << ",\"slots\":[";
+			bool first = true;
+			for (const SlotScore &slot: slotFinder.rankSlots(duration, limit))
+			{
+				body << (first ? "" : ",") << "{\"dayOfWeek\":" << slot.dayOfWeek << ",\"startTime\":";
+				writeTime(body, slot.startTime);
+				body << ",\"endTime\":";
+				writeTime(body, slot.endTime);
+				body << ",\"clashingStudents\":" << slot.clashingStudents << ",\"clashingSlots\":" << slot.clashingSlots << "}";
+				first = false;
+			}
+			body << "]}";
+			sendBody(response, HTTPResponse::HTTP_OK, body.str());
+		}
+
+		//! GET /rankings/students?limit=50[&major=M] and GET /rankings/courses?limit=10[&semester=S]
+		void listRanking(const std::string &kind, const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			std::string limitText, major, semester;
+			unsigned long limit = 10;
+			if (getParameter(parameters, "limit", limitText) && !parseNumber(limitText, limit))
+			{
+				sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "Invalid limit");
+				return;
+			}
+			getParameter(parameters, "major", major);
+			getParameter(parameters, "semester", semester);
+
+			std::ostringstream body;
+			body << "[";
+			bool first = true;
+			if (kind == "students")
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				for (const auto &ranked: studentDb.rankStudentsByGrade(limit, major.empty() ? StudentEnrollmentIndex::anyMajor : major[0]))
+				{
+					body << (first ? "" : ",") << "{\"matrikelNumber\":" << ranked.first << ",\"gradePointAverage\":" << ranked.second << "}";
+					first = false;
+				}
+			}
+			else if (kind == "courses")
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				for (const auto &ranked: studentDb.rankCoursesByEnrollments(limit, semester))
+				{
+					body << (first ? "" : ",") << "{\"courseKey\":" << ranked.first << ",\"enrollments\":" << ranked.second << "}";
+					first = false;
+				}
+			}
+			else
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+				return;
+			}
+			body << "]";
+			sendBody(response, HTTPResponse::HTTP_OK, body.str());
+		}
+
+		//! GET /cardinalities/students[?major=M][&semester=S] and GET /cardinalities/cities?courseKey=K
+		void estimateCardinality(const std::string &kind, const Poco::URI::QueryParameters &parameters,
+								 HTTPServerResponse &response)
+		{
+			std::string major, semester, courseKeyText;
+			unsigned long courseKey {};
+			getParameter(parameters, "major", major);
+			getParameter(parameters, "semester", semester);
+
+			std::ostringstream body;
+			if (kind == "students")
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				body << "{\"distinctStudents\":"
+					 << std::llround(studentDb.estimateDistinctStudents(major.empty() ? StudentEnrollmentIndex::anyMajor : major[0],
+																		 semester));
+			}
+			else if (kind == "cities")
+			{
+				if (!getParameter(parameters, "courseKey", courseKeyText) || !parseNumber(courseKeyText, courseKey))
+				{
+					sendError(response, HTTPResponse::HTTP_BAD_REQUEST, "courseKey is required");
+					return;
+				}
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				body << "{\"courseKey\":" << courseKey << ",\"distinctCities\":"
+					 << std::llround(studentDb.estimateDistinctCities(courseKey));
+			}
+			else
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+				return;
+			}
+			body << ",\"standardError\":" << HyperLogLog().getStandardError() << "}";
+			sendBody(response, HTTPResponse::HTTP_OK, body.str());
+		}
+
+		//! GET /metrics[?format=json]
+		void writeMetrics(const Poco::URI::QueryParameters &parameters, HTTPServerResponse &response)
+		{
+			std::string format;
+			getParameter(parameters, "format", format);
+
+			//! The metrics are recorded without the database lock and read without it as well
+			std::ostringstream body;
+			if (format == "json")
+			{
+				studentDb.getMetrics().writeJson(body);
+				sendBody(response, HTTPResponse::HTTP_OK, body.str());
+			}
+			else
+			{
+				studentDb.getMetrics().writePrometheus(body);
+				sendBody(response, HTTPResponse::HTTP_OK, body.str(), "text/plain; version=0.0.4");
+			}
+		}
+
+		//! GET /memory
+		void writeMemoryReport(HTTPServerResponse &response)
+		{
+			std::ostringstream body;
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				studentDb.getMemoryReport().writeJson(body);
+			}
+			sendBody(response, HTTPResponse::HTTP_OK, body.str());
+		}
+
+	public:
+		StudentDbRequestHandler(StudentDb &studentDb, bool readOnly)
+			: studentDb{studentDb}, readOnly{readOnly}
+		{}
+
+		void handleRequest(HTTPServerRequest &request, HTTPServerResponse &response) override
+		{
+			//! Consume a request body that is not used, otherwise the kept alive connection gets out of step
+			request.stream().ignore(std::numeric_limits<std::streamsize>::max());
+
+			Poco::URI uri(request.getURI());
+			Poco::URI::QueryParameters parameters = uri.getQueryParameters();
+			const std::string &method = request.getMethod();
+
+			//! Split the path into its segments
+			std::vector<std::string> segments;
+			std::istringstream path(uri.getPath());
+			std::string segment;
+			while (getline(path, segment, '/'))
+			{
+				if (!segment.empty())
+				{
+					segments.push_back(segment);
+				}
+			}
+
+			if (segments.empty())
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+			}
+			else if (readOnly && method != HTTPRequest::HTTP_GET)
+			{
+				sendError(response, HTTPResponse::HTTP_FORBIDDEN, "Read only replica");
+			}
+			else if (segments[0] == "students" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				listStudents(parameters, response);
+			}
+			else if (segments[0] == "students" && segments.size() > 1)
+			{
+				handleStudent(segments, method, parameters, response);
+			}
+			else if (segments[0] == "courses" && method == HTTPRequest::HTTP_GET)
+			{
+				handleCourses(segments, response);
+			}
+			else if (segments[0] == "enrollments" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				listEnrollments(response);
+			}
+			else if (segments[0] == "conflicts" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				listScheduleConflicts(parameters, response);
+			}
+			else if (segments[0] == "slots" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				rankSlots(parameters, response);
+			}
+			else if (segments[0] == "rankings" && segments.size() == 2 && method == HTTPRequest::HTTP_GET)
+			{
+				listRanking(segments[1], parameters, response);
+			}
+			else if (segments[0] == "cardinalities" && segments.size() == 2 && method == HTTPRequest::HTTP_GET)
+			{
+				estimateCardinality(segments[1], parameters, response);
+			}
+			else if (segments[0] == "metrics" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				writeMetrics(parameters, response);
+			}
+			else if (segments[0] == "memory" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				writeMemoryReport(response);
+			}
+			else if (segments[0] == "export" && segments.size() == 1 && method == HTTPRequest::HTTP_GET)
+			{
+				std::ostream &out = beginStream(response, "text/csv");
+
+				//! Written in parts under the lock and sent without it, the counts are those of the first part
+				StudentDb::WriteCursor cursor;
+				bool more = true;
+				std::ostringstream part;
+				while (more)
+				{
+					{
+						std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+						more = studentDb.writePart(part, cursor, streamChunkRecords);
+					}
+					out << part.str();
+					part.str("");
+				}
+			}
+			else
+			{
+				sendError(response, HTTPResponse::HTTP_NOT_FOUND, "Unknown resource");
+			}
+		}
+	};
+
+	/**
+	 * \brief		: Creates the request handlers of the front end
+	 */
+	class StudentDbRequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+	{
+	private:
+		StudentDb &studentDb;
+		bool readOnly;
+
+	public:
+		StudentDbRequestHandlerFactory(StudentDb &studentDb, bool readOnly)
+			: studentDb{studentDb}, readOnly{readOnly}
+		{}
+
+		Poco::Net::HTTPRequestHandler* createRequestHandler(const HTTPServerRequest & /*request*/) override
+		{
+			return new StudentDbRequestHandler(studentDb, readOnly);
+		}
+	};
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: StudentDb &studentDb - database to serve
+ * \param[IN]	: unsigned short port - port to listen on, 0 picks a free port
+ * \param[IN]	: unsigned int workerThreads - number of threads serving connections
+ */
+StudentDbHttpServer::StudentDbHttpServer(StudentDb &studentDb, unsigned short port, unsigned int workerThreads)
+	: studentDb{studentDb}, port{port}, workerThreads{workerThreads}, readOnly{false}
+{}
+
+/**
+ * \brief		: Method to start accepting connections
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentDbHttpServer::start()
+{
+	Poco::Net::ServerSocket serverSocket(port);
+	port = serverSocket.address().port();
+
+	Poco::Net::HTTPServerParams::Ptr params = new Poco::Net::HTTPServerParams;
+	params->setMaxThreads(static_cast<int>(workerThreads));
+	params->setMaxQueued(1024);
+	params->setKeepAlive(true);
+	params->setMaxKeepAliveRequests(0);
+	params->setKeepAliveTimeout(Poco::Timespan(30, 0));
+
+	threadPool.reset(new Poco::ThreadPool(1, static_cast<int>(workerThreads)));
+	server.reset(new Poco::Net::HTTPServer(new StudentDbRequestHandlerFactory(studentDb, readOnly), *threadPool,
+										   serverSocket, params));
+	server->start();
+}
+
+/**
+ * \brief		: Method to stop the server
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentDbHttpServer::stop()
+{
+	if (server)
+	{
+		//! Idle keep-alive connections would hold their threads for the keep-alive timeout
+		server->stopAll(true);
+		threadPool->joinAll();
+		server.reset();
+		threadPool.reset();
+	}
+}
+
+/**
+ * \brief		: Getter method for the port the server is listening on
+ * \param		: NONE
+ * \return		: unsigned short - port
+ */
+unsigned short StudentDbHttpServer::getPort() const
+{
+	return port;
+}
+
+/**
+ * \brief		: Setter method for the read only mode, updates are answered with 403 Forbidden
+ * \param[IN]	: bool readOnly - true to reject updates, takes effect with the next start()
+ * \return		: NONE
+ */
+void StudentDbHttpServer::setReadOnly(bool readOnly)
+{
+	this->readOnly = readOnly;
+}
+
+/**
+ * \brief		: Destructor, stops the server
+ */
+StudentDbHttpServer::~StudentDbHttpServer()
+{
+	stop();
+}
@@ -0,0 +1,144 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbHttpServer.h
+ *	\brief Header file for StudentDbHttpServer class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTDBHTTPSERVER_H_
+#define STUDENTDBHTTPSERVER_H_
+
+//! System Includes
+#include <memory>
+#include <Poco/ThreadPool.h>
+#include <Poco/Net/HTTPServer.h>
+
+//! User Includes
+#include "StudentDb.h"
+
+/**
+ * \brief		: REST front end of the database on an embedded Poco HTTPServer
+ * \details		: Resources (all responses are JSON unless stated otherwise)
+ *				  GET  /students[?search=text]                   list of students
+ *				  GET  /students?similar=name                    closest names by edit distance
+ *				  GET  /students?prefix=text                     autocomplete of first or last names
+ *				  GET  /students?soundsLike=name                 same Kölner Phonetik code
+ *				  GET  /students?city=C|postalCode=P|bornFrom=yyyy-mm-dd&bornTo=yyyy-mm-dd
+ *				                                                 students by address or birth period, combinable
+ *				                                                 all with [&offset=0][&limit=N], N defaults to 10
+ *				                                                 for similar and prefix and 1000 otherwise,
+ *				                                                 larger limits are cut to 1000
+ *				  GET  /students/{matrikel}                      one student with enrollments
+ *				  GET  /students/{matrikel}/enrollments          enrollments of a student
+ *				  POST /students/{matrikel}/enrollments?courseKey=K&semester=S
+ *				                                                 409 Conflict if it clashes with the timetable
+ *				  PUT  /students/{matrikel}/enrollments/{courseKey}?grade=G
+ *				  GET  /courses                                  list of courses, streamed
+ *				  GET  /courses/{courseKey}                      one course
+ *				  GET  /courses/{courseKey}/statistics           live grade statistics and histogram
+ *				  GET  /enrollments                              all enrollments, streamed
+ *				  GET  /conflicts?semester=S                     clashing enrollments of a semester
+ *				  GET  /slots?semester=S&duration=90[&major=M][&limit=10]
+ *				                                                 times for a new weekly course, fewest clashes first
+ *				  GET  /rankings/students?limit=50[&major=M]     best grade point averages
+ *				  GET  /rankings/courses?limit=10[&semester=S]   courses with the most enrollments
+ *				  GET  /cardinalities/students[?major=M][&semester=S]
+ *				                                                 approximate distinct students (HyperLogLog)
+ *				  GET  /cardinalities/cities?courseKey=K         approximate distinct cities of a course
+ *				  GET  /metrics[?format=json]                    operation counts and latencies (Prometheus text)
+ *				  GET  /memory                                   bytes and objects per structure, fragmentation
+ *				  GET  /export                                   database file (text/csv), streamed
+ *
+ *				  Responses are built under a shared lock of the database and sent after it
+ *				  is released, updates take an exclusive one. Student lists, courses,
+ *				  enrollments, conflicts and the export are sent with chunked transfer
+ *				  encoding. All but the conflicts are formatted in chunks of students or
+ *				  courses, each under its own shared lock, so they may show updates made
+ *				  while they are sent; the counts in the export are those of its first chunk.
+ *				  Connections are kept alive between requests. A read only server answers
+ *				  updates with 403 Forbidden.
+ */
+class StudentDbHttpServer
+{
+private:
+
+	/**
+	 * \brief		: Database served by the front end
+	 */
+	StudentDb &studentDb;
+
+	/**
+	 * \brief		: Port to listen on, 0 picks a free port
+	 */
+	unsigned short port;
+
+	/**
+	 * \brief		: Number of threads serving connections
+	 */
+	unsigned int workerThreads;
+
+	/**
+	 * \brief		: Rejects POST and PUT, set on replication followers
+	 */
+	bool readOnly;
+
+	/**
+	 * \brief		: Threads of the connections, one per worker, not shared with other servers
+	 */
+	std::unique_ptr<Poco::ThreadPool> threadPool;
+
+	/**
+	 * \brief		: Poco HTTP server
+	 */
+	std::unique_ptr<Poco::Net::HTTPServer> server;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: StudentDb &studentDb - database to serve
+	 * \param[IN]	: unsigned short port - port to listen on, 0 picks a free port
+	 * \param[IN]	: unsigned int workerThreads - number of threads serving connections
+	 */
+	StudentDbHttpServer(StudentDb &studentDb, unsigned short port, unsigned int workerThreads);
+
+	/**
+	 * \brief		: Method to start accepting connections
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void start();
+
+	/**
+	 * \brief		: Method to stop the server
+	 * \details		: Aborts the open connections and returns when their threads have finished
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void stop();
+
+	/**
+	 * \brief		: Getter method for the port the server is listening on
+	 * \param		: NONE
+	 * \return		: unsigned short - port
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * \brief		: Setter method for the read only mode, updates are answered with 403 Forbidden
+	 * \param[IN]	: bool readOnly - true to reject updates, takes effect with the next start()
+	 * \return		: NONE
+	 */
+	void setReadOnly(bool readOnly);
+
+	/**
+	 * \brief		: Destructor, stops the server
+	 */
+	~StudentDbHttpServer();
+};
+
+#endif /* STUDENTDBHTTPSERVER_H_ */
@@ -0,0 +1,89 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbObserver.h
+ *	\brief Header file for StudentDbObserver interface
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTDBOBSERVER_H_
+#define STUDENTDBOBSERVER_H_
+
+//! User Includes
+#include "Student.h"
+#include "Course.h"
+#include "Enrollment.h"
+
+/**
+ * \brief		: Interface to get notified about every change of a StudentDb
+ * \details		: The callbacks are made by the thread changing the database after the change
+ *				  was applied, i.e. while that thread holds the exclusive database lock.
+ *				  Implementations have to return quickly. All methods default to doing nothing.
+ */
+class StudentDbObserver
+{
+public:
+
+	/**
+	 * \brief		: Called after a course was added
+	 * \param[IN]	: const Course &course - course in the database
+	 * \return		: NONE
+	 */
+	virtual void onCourseAdded (const Course & /*course*/) {}
+
+	/**
+	 * \brief		: Called after a student was added
+	 * \param[IN]	: const Student &student - student in the database
+	 * \return		: NONE
+	 */
+	virtual void onStudentAdded (const Student & /*student*/) {}
+
+	/**
+	 * \brief		: Called after the name, date of birth or address of a student changed
+	 * \param[IN]	: const Student &student - student in the database
+	 * \return		: NONE
+	 */
+	virtual void onStudentUpdated (const Student & /*student*/) {}
+
+	/**
+	 * \brief		: Called after a student was enrolled in a course
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: const Enrollment &enrollment - new enrollment
+	 * \return		: NONE
+	 */
+	virtual void onEnrollmentAdded (unsigned int /*matrikelNumber*/, const Enrollment & /*enrollment*/) {}
+
+	/**
+	 * \brief		: Called after the grade of an enrollment changed
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: unsigned int courseKey - course of the enrollment
+	 * \param[IN]	: float grade - new grade
+	 * \return		: NONE
+	 */
+	virtual void onGradeUpdated (unsigned int /*matrikelNumber*/, unsigned int /*courseKey*/, float /*grade*/) {}
+
+	/**
+	 * \brief		: Called after an enrollment was deleted
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \param[IN]	: unsigned int courseKey - course of the deleted enrollment
+	 * \return		: NONE
+	 */
+	virtual void onEnrollmentDeleted (unsigned int /*matrikelNumber*/, unsigned int /*courseKey*/) {}
+
+	/**
+	 * \brief		: Called after all students and courses were removed (before reading a file)
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	virtual void onCleared () {}
+
+	/**
+	 * \brief		: Virtual destructor
+	 */
+	virtual ~StudentDbObserver () {}
+};
+
+#endif /* STUDENTDBOBSERVER_H_ */
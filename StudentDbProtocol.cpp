@@ -0,0 +1,276 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbProtocol.cpp
+ *	\brief Source file for the binary StudentDb network protocol
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <cstring>
+#include <stdexcept>
+
+//! User Includes
+#include "StudentDbProtocol.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+ProtocolWriter::ProtocolWriter()
+	: frameStart{0}
+{}
+
+/**
+ * \brief		: Method to start a new frame, reserves the length field
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ProtocolWriter::beginFrame()
+{
+	frameStart = buffer.size();
+	putUInt32(0);
+}
+
+/**
+ * \brief		: Method to close the open frame, fills in the length field
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ProtocolWriter::endFrame()
+{
+	std::uint32_t length = static_cast<std::uint32_t>(buffer.size() - frameStart - 4);
+
+	buffer[frameStart]		= static_cast<char>(length >> 24);
+	buffer[frameStart + 1]	= static_cast<char>(length >> 16);
+	buffer[frameStart + 2]	= static_cast<char>(length >> 8);
+	buffer[frameStart + 3]	= static_cast<char>(length);
+}
+
+/**
+ * \brief		: Method to append an unsigned 8 bit value
+ * \param[IN]	: std::uint8_t value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putUInt8(std::uint8_t value)
+{
+	buffer.push_back(static_cast<char>(value));
+}
+
+/**
+ * \brief		: Method to append an unsigned 16 bit value
+ * \param[IN]	: std::uint16_t value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putUInt16(std::uint16_t value)
+{
+	buffer.push_back(static_cast<char>(value >> 8));
+	buffer.push_back(static_cast<char>(value));
+}
+
+/**
+ * \brief		: Method to append an unsigned 32 bit value
+ * \param[IN]	: std::uint32_t value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putUInt32(std::uint32_t value)
+{
+	buffer.push_back(static_cast<char>(value >> 24));
+	buffer.push_back(static_cast<char>(value >> 16));
+	buffer.push_back(static_cast<char>(value >> 8));
+	buffer.push_back(static_cast<char>(value));
+}
+
+/**
+ * \brief		: Method to append an unsigned 64 bit value
+ * \param[IN]	: std::uint64_t value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putUInt64(std::uint64_t value)
+{
+	putUInt32(static_cast<std::uint32_t>(value >> 32));
+	putUInt32(static_cast<std::uint32_t>(value));
+}
+
+/**
+ * \brief		: Method to append a float as its IEEE 754 bit pattern
+ * \param[IN]	: float value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putFloat(float value)
+{
+	std::uint32_t bits {};
+	std::memcpy(&bits, &value, sizeof(bits));
+	putUInt32(bits);
+}
+
+/**
+ * \brief		: Method to append a string with a 16 bit length
+ * \param[IN]	: const std::string &value - value to append, truncated to 65535 bytes
+ * \return		: NONE
+ */
+void ProtocolWriter::putString(const std::string &value)
+{
+	std::size_t length = value.size() < 0xFFFF ? value.size() : 0xFFFF;
+	putUInt16(static_cast<std::uint16_t>(length));
+	buffer.append(value, 0, length);
+}
+
+/**
+ * \brief		: Method to append a string with a 32 bit length
+ * \param[IN]	: const std::string &value - value to append
+ * \return		: NONE
+ */
+void ProtocolWriter::putLongString(const std::string &value)
+{
+	putUInt32(static_cast<std::uint32_t>(value.size()));
+	buffer.append(value);
+}
+
+/**
+ * \brief		: Getter method for the encoded bytes
+ * \param		: NONE
+ * \return		: const std::string& - encoded bytes
+ */
+const std::string& ProtocolWriter::getBuffer() const
+{
+	return buffer;
+}
+
+/**
+ * \brief		: Method to clear the buffer
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ProtocolWriter::clear()
+{
+	buffer.clear();
+	frameStart = 0;
+}
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: const char *data - first byte
+ * \param[IN]	: std::size_t size - number of bytes
+ */
+ProtocolReader::ProtocolReader(const char *data, std::size_t size)
+	: position{data}, end{data + size}
+{}
+
+/**
+ * \brief		: Method to check that enough bytes are left
+ * \param[IN]	: std::size_t size - number of bytes needed
+ * \return		: NONE
+ */
+void ProtocolReader::require(std::size_t size) const
+{
+	if (static_cast<std::size_t>(end - position) < size)
+	{
+		throw std::out_of_range("Truncated message");
+	}
+}
+
+/**
+ * \brief		: Method to read an unsigned 8 bit value
+ * \param		: NONE
+ * \return		: std::uint8_t - value read
+ */
+std::uint8_t ProtocolReader::getUInt8()
+{
+	require(1);
+	return static_cast<std::uint8_t>(*position++);
+}
+
+/**
+ * \brief		: Method to read an unsigned 16 bit value
+ * \param		: NONE
+ * \return		: std::uint16_t - value read
+ */
+std::uint16_t ProtocolReader::getUInt16()
+{
+	require(2);
+	const unsigned char *bytes = reinterpret_cast<const unsigned char*>(position);
+	position += 2;
+	return static_cast<std::uint16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+/**
+ * \brief		: Method to read an unsigned 32 bit value
+ * \param		: NONE
+ * \return		: std::uint32_t - value read
+ */
+std::uint32_t ProtocolReader::getUInt32()
+{
+	require(4);
+	const unsigned char *bytes = reinterpret_cast<const unsigned char*>(position);
+	position += 4;
+	return (static_cast<std::uint32_t>(bytes[0]) << 24) | (static_cast<std::uint32_t>(bytes[1]) << 16)
+			| (static_cast<std::uint32_t>(bytes[2]) << 8) | bytes[3];
+}
+
+/**
+ * \brief		: Method to read an unsigned 64 bit value
+ * \param		: NONE
+ * \return		: std::uint64_t - value read
+ */
+std::uint64_t ProtocolReader::getUInt64()
+{
+	std::uint64_t high = getUInt32();
+	return (high << 32) | getUInt32();
+}
+
+/**
+ * \brief		: Method to read a float sent as its IEEE 754 bit pattern
+ * \param		: NONE
+ * \return		: float - value read
+ */
+float ProtocolReader::getFloat()
+{
+	std::uint32_t bits = getUInt32();
+	float value {};
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/**
+ * \brief		: Method to read a string with a 16 bit length
+ * \param		: NONE
+ * \return		: std::string - value read
+ */
+std::string ProtocolReader::getString()
+{
+	std::uint16_t length = getUInt16();
+	require(length);
+	std::string value(position, length);
+	position += length;
+	return value;
+}
+
+/**
+ * \brief		: Method to read a string with a 32 bit length
+ * \param		: NONE
+ * \return		: std::string - value read
+ */
+std::string ProtocolReader::getLongString()
+{
+	std::uint32_t length = getUInt32();
+	require(length);
+	std::string value(position, length);
+	position += length;
+	return value;
+}
+
+/**
+ * \brief		: Method to check if all bytes were read
+ * \param		: NONE
+ * \return		: bool - true if nothing is left
+ */
+bool ProtocolReader::atEnd() const
+{
+	return position == end;
+}
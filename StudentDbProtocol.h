@@ -0,0 +1,187 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbProtocol.h
+ *	\brief Header file for the binary StudentDb network protocol
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ *
+ *  Every message is a frame of a 4 byte length followed by that many payload bytes.
+ *  All integers are big endian, floats are sent as their IEEE 754 bit pattern,
+ *  strings as a 2 byte length followed by the UTF-8 bytes.
+ *
+ *  Request payload : requestId(u32) opcode(u8) arguments
+ *  Response payload: requestId(u32) status(u8) result
+ *
+ *  Opcode         Arguments                                Result
+ *  LOOKUP         matrikel(u32)                            student record, see StudentDbService
+ *  SEARCH         subString(str)                           count(u32) matrikel(u32)...
+ *  ENROLL         matrikel(u32) courseKey(u32) sem(str)    -
+ *  UPDATE_GRADE   matrikel(u32) courseKey(u32) grade(f32)  -
+ *  EXPORT         -                                        length(u32) database in the file format
+ *
+ *  Requests may be pipelined, the responses of one connection are sent in request order.
+ *  A read only service (replication follower) answers ENROLL and UPDATE_GRADE with READ_ONLY.
+ */
+/****************************************************************************/
+
+#ifndef STUDENTDBPROTOCOL_H_
+#define STUDENTDBPROTOCOL_H_
+
+//! System Includes
+#include <string>
+#include <cstdint>
+
+/**
+ * \brief		: Operations of the binary protocol
+ */
+enum class StudentDbOpcode : std::uint8_t
+{
+	LOOKUP			= 1,
+	SEARCH			= 2,
+	ENROLL			= 3,
+	UPDATE_GRADE	= 4,
+	EXPORT			= 5
+};
+
+/**
+ * \brief		: Status codes of the binary protocol
+ */
+enum class StudentDbStatus : std::uint8_t
+{
+	OK				= 0,
+	NOT_FOUND		= 1,
+	CONFLICT		= 2,
+	BAD_REQUEST		= 3,
+	UNKNOWN_OPCODE	= 4,
+	READ_ONLY		= 5
+};
+
+/**
+ * \brief		: Largest accepted request frame in bytes
+ */
+const std::uint32_t maxRequestFrameSize = 64 * 1024;
+
+/**
+ * \brief		: Appends protocol values to a byte buffer
+ */
+class ProtocolWriter
+{
+private:
+
+	/**
+	 * \brief		: Encoded bytes
+	 */
+	std::string buffer;
+
+	/**
+	 * \brief		: Offset of the length field of the open frame
+	 */
+	std::size_t frameStart;
+
+public:
+
+	/**
+	 * \brief		: Constructor
+	 */
+	ProtocolWriter();
+
+	/**
+	 * \brief		: Method to start a new frame, reserves the length field
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void beginFrame();
+
+	/**
+	 * \brief		: Method to close the open frame, fills in the length field
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void endFrame();
+
+	/**
+	 * \brief		: Methods to append values
+	 * \param[IN]	: value - value to append
+	 * \return		: NONE
+	 */
+	void putUInt8(std::uint8_t value);
+	void putUInt16(std::uint16_t value);
+	void putUInt32(std::uint32_t value);
+	void putUInt64(std::uint64_t value);
+	void putFloat(float value);
+	void putString(const std::string &value);
+	void putLongString(const std::string &value);
+
+	/**
+	 * \brief		: Getter method for the encoded bytes
+	 * \param		: NONE
+	 * \return		: const std::string& - encoded bytes
+	 */
+	const std::string& getBuffer() const;
+
+	/**
+	 * \brief		: Method to clear the buffer
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+};
+
+/**
+ * \brief		: Reads protocol values from a byte range
+ * \details		: Reading past the end throws std::out_of_range
+ */
+class ProtocolReader
+{
+private:
+
+	/**
+	 * \brief		: Current read position
+	 */
+	const char *position;
+
+	/**
+	 * \brief		: One past the last byte
+	 */
+	const char *end;
+
+	/**
+	 * \brief		: Method to check that enough bytes are left
+	 * \param[IN]	: std::size_t size - number of bytes needed
+	 * \return		: NONE
+	 */
+	void require(std::size_t size) const;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: const char *data - first byte
+	 * \param[IN]	: std::size_t size - number of bytes
+	 */
+	ProtocolReader(const char *data, std::size_t size);
+
+	/**
+	 * \brief		: Methods to read values
+	 * \param		: NONE
+	 * \return		: value read
+	 */
+	std::uint8_t getUInt8();
+	std::uint16_t getUInt16();
+	std::uint32_t getUInt32();
+	std::uint64_t getUInt64();
+	float getFloat();
+	std::string getString();
+	std::string getLongString();
+
+	/**
+	 * \brief		: Method to check if all bytes were read
+	 * \param		: NONE
+	 * \return		: bool - true if nothing is left
+	 */
+	bool atEnd() const;
+};
+
+#endif /* STUDENTDBPROTOCOL_H_ */
@@ -0,0 +1,469 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbService.cpp
+ *	\brief Source file for StudentDbService class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <stdexcept>
+#include <Poco/Exception.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+#include <Poco/Net/TCPServerParams.h>
+
+//! User Includes
+#include "StudentDbService.h"
+
+namespace
+{
+	/**
+	 * \brief		: Registers a connection with the service for its lifetime
+	 */
+	class ConnectionRegistration
+	{
+	private:
+		StudentDbService &service;
+		Poco::Net::StreamSocket socket;
+
+	public:
+		ConnectionRegistration(StudentDbService &service, const Poco::Net::StreamSocket &socket)
+			: service{service}, socket{socket}
+		{
+			service.addConnection(socket);
+		}
+
+		~ConnectionRegistration()
+		{
+			service.removeConnection(socket);
+		}
+	};
+
+	/**
+	 * \brief		: Serves the binary protocol on one connection
+	 */
+	class StudentDbConnection : public Poco::Net::TCPServerConnection
+	{
+	private:
+		StudentDbService &service;
+
+		//! Sends the whole buffer, sendBytes may write less than requested
+		void sendAll(const std::string &data)
+		{
+			std::size_t sent = 0;
+			while (sent < data.size())
+			{
+				int bytes = socket().sendBytes(data.data() + sent, static_cast<int>(data.size() - sent));
+				if (bytes <= 0)
+				{
+					throw std::runtime_error("Connection closed while sending");
+				}
+				sent += bytes;
+			}
+		}
+
+	public:
+		StudentDbConnection(const Poco::Net::StreamSocket &socket, StudentDbService &service)
+			: Poco::Net::TCPServerConnection(socket), service{service}
+		{}
+
+		void run() override
+		{
+			std::string inbound;
+			ProtocolWriter outbound;
+			char chunk[16 * 1024];
+
+			ConnectionRegistration registration(service, socket());
+			socket().setNoDelay(true);
+
+			while (true)
+			{
+				int received = socket().receiveBytes(chunk, sizeof(chunk));
+				if (received <= 0)
+				{
+					break;
+				}
+				inbound.append(chunk, received);
+
+				//! Answer every complete frame that has arrived so far
+				std::size_t offset = 0;
+				while (inbound.size() - offset >= 4)
+				{
+					ProtocolReader header(inbound.data() + offset, 4);
+					std::uint32_t length = header.getUInt32();
+
+					if (length > maxRequestFrameSize)
+					{
+						//! Framing cannot be recovered, drop the connection
+						return;
+					}
+					if (inbound.size() - offset - 4 < length)
+					{
+						break;
+					}
+
+					service.processRequest(inbound.data() + offset + 4, length, outbound);
+					offset += 4 + length;
+				}
+				inbound.erase(0, offset);
+
+				if (!outbound.getBuffer().empty())
+				{
+					sendAll(outbound.getBuffer());
+					outbound.clear();
+				}
+			}
+		}
+	};
+
+	/**
+	 * \brief		: Creates the connection handlers of the service
+	 */
+	class StudentDbConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+	{
+	private:
+		StudentDbService &service;
+
+	public:
+		StudentDbConnectionFactory(StudentDbService &service)
+			: service{service}
+		{}
+
+		Poco::Net::TCPServerConnection* createConnection(const Poco::Net::StreamSocket &socket) override
+		{
+			return new StudentDbConnection(socket, service);
+		}
+	};
+
+	/**
+	 * \brief		: Encodes a student record, see StudentDbService.h
+	 */
+	void putStudent(ProtocolWriter &response, const Student &student)
+	{
+		const Address &address = student.getAddress();
+
+		response.putUInt32(student.getMatrikelNumber());
+		response.putString(student.getFirstName());
+		response.putString(student.getLastName());
+		response.putUInt16(static_cast<std::uint16_t>(student.getDateOfBirth().year()));
+		response.putUInt8(static_cast<std::uint8_t>(student.getDateOfBirth().month()));
+		response.putUInt8(static_cast<std::uint8_t>(student.getDateOfBirth().day()));
+		response.putString(address.getStreet());
+		response.putUInt16(address.getPostalCode());
+		response.putString(address.getCityName());
+		response.putString(address.getAdditionalInfo());
+
+		const std::vector<Enrollment> &enrollments = student.getEnrollments();
+		response.putUInt16(static_cast<std::uint16_t>(enrollments.size()));
+		for (const auto &enrollment: enrollments)
+		{
+			response.putUInt32(enrollment.getCourse().getCourseKey());
+			response.putString(enrollment.getCourse().getTitle());
+			response.putString(enrollment.getSemester());
+			response.putFloat(enrollment.getGrade());
+		}
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: StudentDb &studentDb - database to serve
+ * \param[IN]	: unsigned short port - port to listen on, 0 picks a free port
+ * \param[IN]	: unsigned int workerThreads - number of worker threads
+ */
+StudentDbService::StudentDbService(StudentDb &studentDb, unsigned short port, unsigned int workerThreads)
+	: studentDb{studentDb}, port{port}, workerThreads{workerThreads}, readOnly{false}, stopping{false}
+{}
+
+/**
+ * \brief		: Method to start accepting connections
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentDbService::start()
+{
+	Poco::Net::ServerSocket serverSocket(port);
+	port = serverSocket.address().port();
+
+	Poco::Net::TCPServerParams::Ptr params = new Poco::Net::TCPServerParams;
+	params->setMaxThreads(static_cast<int>(workerThreads));
+	params->setMaxQueued(1024);
+
+	{
+		std::lock_guard<std::mutex> guard(connectionsLock);
+		stopping = false;
+	}
+	threadPool.reset(new Poco::ThreadPool(1, static_cast<int>(workerThreads)));
+	server.reset(new Poco::Net::TCPServer(new StudentDbConnectionFactory(*this), *threadPool, serverSocket, params));
+	server->start();
+}
+
+/**
+ * \brief		: Method to stop the service
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentDbService::stop()
+{
+	if (server)
+	{
+		//! No new connections, then wake the open ones blocked in receiveBytes
+		server->stop();
+		{
+			std::lock_guard<std::mutex> guard(connectionsLock);
+			stopping = true;
+			for (Poco::Net::StreamSocket &socket: connections)
+			{
+				try
+				{
+					socket.shutdown();
+				}
+				catch (const Poco::Exception&)
+				{
+				}
+			}
+		}
+		threadPool->joinAll();
+		server.reset();
+		threadPool.reset();
+	}
+}
+
+/**
+ * \brief		: Method to register a connection, called by its thread when it starts
+ * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+ * \return		: NONE
+ */
+void StudentDbService::addConnection(const Poco::Net::StreamSocket &socket)
+{
+	std::lock_guard<std::mutex> guard(connectionsLock);
+	connections.push_back(socket);
+	if (stopping)
+	{
+		try
+		{
+			connections.back().shutdown();
+		}
+		catch (const Poco::Exception&)
+		{
+		}
+	}
+}
+
+/**
+ * \brief		: Method to unregister a connection, called by its thread when it ends
+ * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+ * \return		: NONE
+ */
+void StudentDbService::removeConnection(const Poco::Net::StreamSocket &socket)
+{
+	std::lock_guard<std::mutex> guard(connectionsLock);
+	connections.erase(std::remove(connections.begin(), connections.end(), socket), connections.end());
+}
+
+/**
+ * \brief		: Getter method for the port the service is listening on
+ * \param		: NONE
+ * \return		: unsigned short - port
+ */
+unsigned short StudentDbService::getPort() const
+{
+	return port;
+}
+
+/**
+ * \brief		: Setter method for the read only mode, updates are answered with READ_ONLY
+ * \param[IN]	: bool readOnly - true to reject updates
+ * \return		: NONE
+ */
+void StudentDbService::setReadOnly(bool readOnly)
+{
+	this->readOnly = readOnly;
+}
+
+/**
+ * \brief		: Method to execute one request and append the response frame
+ * \param[IN]	: const char *payload - request payload (without the length field)
+ * \param[IN]	: std::size_t size - size of the payload
+ * \param[OUT]	: ProtocolWriter &response - buffer the response frame is appended to
+ * \return		: NONE
+ */
+void StudentDbService::processRequest(const char *payload, std::size_t size, ProtocolWriter &response)
+{
+	ProtocolReader request(payload, size);
+	std::uint32_t requestId {};
+	StudentDbOpcode opcode {};
+
+	//! Arguments of the request
+	std::uint32_t matrikelNumber {}, courseKey {};
+	std::string text;
+	float grade {};
+
+	response.beginFrame();
+
+	//! Decode the complete request before touching the database
+	try
+	{
+		requestId = request.getUInt32();
+		opcode = static_cast<StudentDbOpcode>(request.getUInt8());
+
+		switch (opcode)
+		{
+			case StudentDbOpcode::LOOKUP:
+				matrikelNumber = request.getUInt32();
+				break;
+			case StudentDbOpcode::SEARCH:
+				text = request.getString();
+				break;
+			case StudentDbOpcode::ENROLL:
+				matrikelNumber = request.getUInt32();
+				courseKey = request.getUInt32();
+				text = request.getString();
+				break;
+			case StudentDbOpcode::UPDATE_GRADE:
+				matrikelNumber = request.getUInt32();
+				courseKey = request.getUInt32();
+				grade = request.getFloat();
+				break;
+			case StudentDbOpcode::EXPORT:
+				break;
+			default:
+				response.putUInt32(requestId);
+				response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::UNKNOWN_OPCODE));
+				response.endFrame();
+				return;
+		}
+	}
+	catch (std::out_of_range &e)
+	{
+		response.putUInt32(requestId);
+		response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::BAD_REQUEST));
+		response.endFrame();
+		return;
+	}
+
+	response.putUInt32(requestId);
+
+	if (readOnly && (opcode == StudentDbOpcode::ENROLL || opcode == StudentDbOpcode::UPDATE_GRADE))
+	{
+		response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::READ_ONLY));
+		response.endFrame();
+		return;
+	}
+
+	switch (opcode)
+	{
+		case StudentDbOpcode::LOOKUP:
+		{
+			std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+			try
+			{
+				const Student &student = studentDb.getStudent(matrikelNumber);
+				response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::OK));
+				putStudent(response, student);
+			}
+			catch (std::out_of_range &e)
+			{
+				response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::NOT_FOUND));
+			}
+			break;
+		}
+
+		case StudentDbOpcode::SEARCH:
+		{
+			std::vector<unsigned int> matches;
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				matches = studentDb.findStudents(text);
+			}
+
+			response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::OK));
+			response.putUInt32(static_cast<std::uint32_t>(matches.size()));
+			for (unsigned int match: matches)
+			{
+				response.putUInt32(match);
+			}
+			break;
+		}
+
+		case StudentDbOpcode::ENROLL:
+		{
+			StudentDbStatus status = StudentDbStatus::OK;
+			{
+				std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+				try
+				{
+					studentDb.getStudents().at(matrikelNumber);
+					StudentDb::EnrollmentResult result = studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, text);
+					if (result == StudentDb::UNKNOWN_COURSE)
+					{
+						status = StudentDbStatus::NOT_FOUND;
+					}
+					else if (result != StudentDb::ENROLLED)
+					{
+						status = StudentDbStatus::CONFLICT;
+					}
+				}
+				catch (std::out_of_range &e)
+				{
+					status = StudentDbStatus::NOT_FOUND;
+				}
+			}
+			response.putUInt8(static_cast<std::uint8_t>(status));
+			break;
+		}
+
+		case StudentDbOpcode::UPDATE_GRADE:
+		{
+			StudentDbStatus status = StudentDbStatus::OK;
+			if (!(grade > 0 && grade < 6))
+			{
+				status = StudentDbStatus::BAD_REQUEST;
+			}
+			else
+			{
+				std::unique_lock<std::shared_mutex> writeLock(studentDb.getLock());
+				if (!studentDb.updateStudentGradeInDb(matrikelNumber, courseKey, grade))
+				{
+					status = StudentDbStatus::NOT_FOUND;
+				}
+			}
+			response.putUInt8(static_cast<std::uint8_t>(status));
+			break;
+		}
+
+		case StudentDbOpcode::EXPORT:
+		{
+			std::ostringstream out;
+			{
+				std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+				studentDb.write(out);
+			}
+			response.putUInt8(static_cast<std::uint8_t>(StudentDbStatus::OK));
+			response.putLongString(out.str());
+			break;
+		}
+	}
+
+	response.endFrame();
+}
+
+/**
+ * \brief		: Destructor, stops the service
+ */
+StudentDbService::~StudentDbService()
+{
+	stop();
+}
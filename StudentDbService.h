@@ -0,0 +1,156 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbService.h
+ *	\brief Header file for StudentDbService class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTDBSERVICE_H_
+#define STUDENTDBSERVICE_H_
+
+//! System Includes
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <Poco/ThreadPool.h>
+#include <Poco/Net/StreamSocket.h>
+#include <Poco/Net/TCPServer.h>
+
+//! User Includes
+#include "StudentDb.h"
+#include "StudentDbProtocol.h"
+
+/**
+ * \brief		: Network service exposing StudentDb over the binary protocol (StudentDbProtocol.h)
+ * \details		: Connections are served by a Poco TCPServer with its own pool of worker threads.
+ *				  Each connection reads all pipelined requests that have arrived, answers
+ *				  them in order and sends the responses in one write. Queries take a shared
+ *				  lock of the database, updates an exclusive one.
+ *
+ *				  Student record of a LOOKUP response:
+ *				  matrikel(u32) firstName(str) lastName(str) year(u16) month(u8) day(u8)
+ *				  street(str) postalCode(u16) city(str) additionalInfo(str)
+ *				  enrollmentCount(u16) { courseKey(u32) title(str) semester(str) grade(f32) }
+ */
+class StudentDbService
+{
+private:
+
+	/**
+	 * \brief		: Database served by the service
+	 */
+	StudentDb &studentDb;
+
+	/**
+	 * \brief		: Port to listen on, 0 picks a free port
+	 */
+	unsigned short port;
+
+	/**
+	 * \brief		: Number of worker threads serving connections
+	 */
+	unsigned int workerThreads;
+
+	/**
+	 * \brief		: Rejects ENROLL and UPDATE_GRADE, set on replication followers
+	 */
+	bool readOnly;
+
+	/**
+	 * \brief		: Threads of the connections, one per worker, not shared with other servers
+	 */
+	std::unique_ptr<Poco::ThreadPool> threadPool;
+
+	/**
+	 * \brief		: Poco TCP server
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> server;
+
+	/**
+	 * \brief		: Guards connections and stopping
+	 */
+	std::mutex connectionsLock;
+
+	/**
+	 * \brief		: Sockets of the connections being served
+	 */
+	std::vector<Poco::Net::StreamSocket> connections;
+
+	/**
+	 * \brief		: Set by stop, connections registered afterwards are shut down at once
+	 */
+	bool stopping;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: StudentDb &studentDb - database to serve
+	 * \param[IN]	: unsigned short port - port to listen on, 0 picks a free port
+	 * \param[IN]	: unsigned int workerThreads - number of worker threads
+	 */
+	StudentDbService(StudentDb &studentDb, unsigned short port, unsigned int workerThreads);
+
+	/**
+	 * \brief		: Method to start accepting connections
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void start();
+
+	/**
+	 * \brief		: Method to stop the service
+	 * \details		: Shuts down the open connections and returns when their threads have finished
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void stop();
+
+	/**
+	 * \brief		: Method to register a connection, called by its thread when it starts
+	 * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+	 * \return		: NONE
+	 */
+	void addConnection(const Poco::Net::StreamSocket &socket);
+
+	/**
+	 * \brief		: Method to unregister a connection, called by its thread when it ends
+	 * \param[IN]	: const Poco::Net::StreamSocket &socket - socket of the connection
+	 * \return		: NONE
+	 */
+	void removeConnection(const Poco::Net::StreamSocket &socket);
+
+	/**
+	 * \brief		: Getter method for the port the service is listening on
+	 * \param		: NONE
+	 * \return		: unsigned short - port
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * \brief		: Setter method for the read only mode, updates are answered with READ_ONLY
+	 * \param[IN]	: bool readOnly - true to reject updates
+	 * \return		: NONE
+	 */
+	void setReadOnly(bool readOnly);
+
+	/**
+	 * \brief		: Method to execute one request and append the response frame
+	 * \param[IN]	: const char *payload - request payload (without the length field)
+	 * \param[IN]	: std::size_t size - size of the payload
+	 * \param[OUT]	: ProtocolWriter &response - buffer the response frame is appended to
+	 * \return		: NONE
+	 */
+	void processRequest(const char *payload, std::size_t size, ProtocolWriter &response);
+
+	/**
+	 * \brief		: Destructor, stops the service
+	 */
+	~StudentDbService();
+};
+
+#endif /* STUDENTDBSERVICE_H_ */
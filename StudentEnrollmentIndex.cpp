@@ -0,0 +1,128 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentEnrollmentIndex.cpp
+ *	\brief Source file for StudentEnrollmentIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+
+//! User Includes
+#include "StudentEnrollmentIndex.h"
+#include "Enrollment.h"
+#include "WeeklyCourse.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to add a student or move it to the combinations of its current enrollments
+ * \param[IN]	: const Student &student - student with the current enrollments
+ * \return		: NONE
+ */
+void StudentEnrollmentIndex::updateStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	std::vector<Key> keys;
+
+	for (const Enrollment &enrollment: student.getEnrollments())
+	{
+		const Course &course = enrollment.getCourse();
+		CourseType type = dynamic_cast<const WeeklyCourse*>(&course) != nullptr ? WEEKLY : BLOCK;
+		keys.push_back(Key(course.getMajor(), enrollment.getSemester(), type));
+	}
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+	std::vector<Key> &previousKeys = studentKeys[matrikelNumber];
+	for (const Key &key: previousKeys)
+	{
+		if (!std::binary_search(keys.begin(), keys.end(), key))
+		{
+			auto bitmap = bitmaps.find(key);
+			bitmap->second.remove(matrikelNumber);
+			if (bitmap->second.cardinality() == 0)
+			{
+				bitmaps.erase(bitmap);
+			}
+		}
+	}
+	for (const Key &key: keys)
+	{
+		bitmaps[key].add(matrikelNumber);
+	}
+
+	if (keys.empty())
+	{
+		studentKeys.erase(matrikelNumber);
+	}
+	else
+	{
+		previousKeys = std::move(keys);
+	}
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentEnrollmentIndex::clear()
+{
+	bitmaps.clear();
+	studentKeys.clear();
+}
+
+/**
+ * \brief		: Method to find the students with an enrollment matching all given attributes
+ * \param[IN]	: unsigned char major - first character of the major, anyMajor for all
+ * \param[IN]	: const std::string &semester - semester, empty for all
+ * \param[IN]	: CourseType type - type of the course, ANY_COURSE_TYPE for both
+ * \return		: StudentBitmap - matrikel numbers of the students
+ */
+StudentBitmap StudentEnrollmentIndex::find(unsigned char major, const std::string &semester, CourseType type) const
+{
+	StudentBitmap students;
+
+	for (const auto &bitmap: bitmaps)
+	{
+		if ((major == anyMajor || std::get<0>(bitmap.first) == major)
+			&& (semester.empty() || std::get<1>(bitmap.first) == semester)
+			&& (type == ANY_COURSE_TYPE || std::get<2>(bitmap.first) == type))
+		{
+			students = students.unite(bitmap.second);
+		}
+	}
+
+	return students;
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the bitmaps and keys as ENROLLMENT_INDEX
+ * \return		: NONE
+ */
+void StudentEnrollmentIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::ENROLLMENT_INDEX, studentKeys.size());
+	report.addTreeNodes(MemoryReport::ENROLLMENT_INDEX, bitmaps);
+	for (const auto &bitmap: bitmaps)
+	{
+		report.addString(MemoryReport::ENROLLMENT_INDEX, std::get<1>(bitmap.first));
+		bitmap.second.reportMemory(report, MemoryReport::ENROLLMENT_INDEX);
+	}
+	report.addHashTable(MemoryReport::ENROLLMENT_INDEX, studentKeys);
+	for (const auto &keys: studentKeys)
+	{
+		report.addVector(MemoryReport::ENROLLMENT_INDEX, keys.second);
+		for (const Key &key: keys.second)
+		{
+			report.addString(MemoryReport::ENROLLMENT_INDEX, std::get<1>(key));
+		}
+	}
+}
@@ -0,0 +1,105 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentEnrollmentIndex.h
+ *	\brief Header file for StudentEnrollmentIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTENROLLMENTINDEX_H_
+#define STUDENTENROLLMENTINDEX_H_
+
+//! System Includes
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "StudentBitmap.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Bitmap index of the students by the major, semester and type of their enrollments
+ * \details		: The three attributes have few values (four majors, a handful of semesters,
+ *				  weekly or block), so there is one bitmap of students per combination that
+ *				  occurs in an enrollment. A filter leaving attributes open unites the bitmaps
+ *				  of the matching combinations; because every combination comes from one
+ *				  enrollment, "a course of major E in WS2019" means the same enrollment.
+ *				  Filters on different enrollments combine with StudentBitmap::intersect.
+ */
+class StudentEnrollmentIndex
+{
+public:
+
+	/**
+	 * \brief		: Type of the enrolled course
+	 */
+	enum CourseType
+	{
+		ANY_COURSE_TYPE,
+		WEEKLY,
+		BLOCK
+	};
+
+	/**
+	 * \brief		: Major of find that accepts every major
+	 */
+	static constexpr unsigned char anyMajor = 0;
+
+private:
+
+	/**
+	 * \brief		: Major, semester and type of one enrollment
+	 */
+	typedef std::tuple<unsigned char, std::string, CourseType> Key;
+
+	/**
+	 * \brief		: Students per occurring combination
+	 */
+	std::map<Key, StudentBitmap> bitmaps;
+
+	/**
+	 * \brief		: Combinations of every student, to remove the student from them on a change
+	 */
+	std::unordered_map<unsigned int, std::vector<Key>> studentKeys;
+
+public:
+
+	/**
+	 * \brief		: Method to add a student or move it to the combinations of its current enrollments
+	 * \param[IN]	: const Student &student - student with the current enrollments
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students with an enrollment matching all given attributes
+	 * \param[IN]	: unsigned char major - first character of the major, anyMajor for all
+	 * \param[IN]	: const std::string &semester - semester, empty for all
+	 * \param[IN]	: CourseType type - type of the course, ANY_COURSE_TYPE for both
+	 * \return		: StudentBitmap - matrikel numbers of the students
+	 */
+	StudentBitmap find(unsigned char major, const std::string &semester, CourseType type) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the bitmaps and keys as ENROLLMENT_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTENROLLMENTINDEX_H_ */
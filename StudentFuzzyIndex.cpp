@@ -0,0 +1,293 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentFuzzyIndex.cpp
+ *	\brief Source file for StudentFuzzyIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <unordered_map>
+
+//! User Includes
+#include "StudentFuzzyIndex.h"
+#include "StudentNameIndex.h"
+
+namespace
+{
+	/**
+	 * \brief		: Case folds a name and splits it into code points, invalid bytes are kept as they are
+	 */
+	std::u32string foldToCodePoints(const std::string &name)
+	{
+		std::string folded = StudentNameIndex::fold(name);
+		std::u32string codePoints;
+		codePoints.reserve(folded.size());
+
+		for (std::size_t i = 0; i < folded.size(); )
+		{
+			unsigned char byte = folded[i];
+			std::size_t length = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : byte >= 0xC0 ? 2 : 1;
+
+			if (length == 1 || i + length > folded.size())
+			{
+				codePoints.push_back(byte);
+				i++;
+				continue;
+			}
+
+			char32_t codePoint = byte & (0x7F >> length);
+			for (std::size_t j = 1; j < length; j++)
+			{
+				codePoint = (codePoint << 6) | (static_cast<unsigned char>(folded[i + j]) & 0x3F);
+			}
+			codePoints.push_back(codePoint);
+			i += length;
+		}
+
+		return codePoints;
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+StudentFuzzyIndex::StudentFuzzyIndex()
+	: nodes(1)
+{}
+
+/**
+ * \brief		: Method to add a student or move it to its new names
+ * \param[IN]	: const Student &student - student with the current names
+ * \return		: NONE
+ */
+void StudentFuzzyIndex::updateStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	std::size_t firstNode = insertName(foldToCodePoints(student.getFirstName()));
+	std::size_t lastNode = insertName(foldToCodePoints(student.getLastName()));
+
+	auto existing = studentNodes.find(matrikelNumber);
+	if (existing != studentNodes.end())
+	{
+		if (existing->second == std::make_pair(firstNode, lastNode))
+		{
+			return;
+		}
+		for (std::size_t node: {existing->second.first, existing->second.second})
+		{
+			std::vector<unsigned int> &postings = nodes[node].matrikelNumbers;
+			auto posting = std::find(postings.begin(), postings.end(), matrikelNumber);
+			if (posting != postings.end())
+			{
+				postings.erase(posting);
+			}
+		}
+	}
+
+	nodes[firstNode].matrikelNumbers.push_back(matrikelNumber);
+	if (lastNode != firstNode)
+	{
+		nodes[lastNode].matrikelNumbers.push_back(matrikelNumber);
+	}
+	studentNodes[matrikelNumber] = std::make_pair(firstNode, lastNode);
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentFuzzyIndex::clear()
+{
+	nodes.assign(1, Node());
+	studentNodes.clear();
+}
+
+/**
+ * \brief		: Method to find the students with a first or last name close to the given name
+ * \param[IN]	: const std::string &name - name as typed, case insensitive
+ * \param[IN]	: std::size_t maxResults - number of students to return at most
+ * \param[IN]	: unsigned int maxDistance - largest edit distance considered
+ * \return		: std::vector<std::pair<unsigned int, unsigned int>> - matrikel number and distance
+ *				  of the closest students, by ascending distance and matrikel number
+ */
+std::vector<std::pair<unsigned int, unsigned int>> StudentFuzzyIndex::find(const std::string &name,
+		std::size_t maxResults, unsigned int maxDistance) const
+{
+	std::vector<std::pair<unsigned int, unsigned int>> results;
+	std::unordered_map<unsigned int, unsigned int> closest;
+
+	if (maxResults == 0)
+	{
+		return results;
+	}
+
+	/** Small radii prune most of the tree, so widen the radius step by step until enough
+	 *  students are found. Every student within the radius is found by the search
+	 */
+	std::u32string query = foldToCodePoints(name);
+	for (unsigned int radius = 0; radius <= maxDistance && closest.size() < maxResults; radius++)
+	{
+		closest.clear();
+		search(query, radius, closest);
+	}
+
+	results.assign(closest.begin(), closest.end());
+
+	auto byDistance = [](const std::pair<unsigned int, unsigned int> &left, const std::pair<unsigned int, unsigned int> &right)
+	{
+		return left.second != right.second ? left.second < right.second : left.first < right.first;
+	};
+
+	if (results.size() > maxResults)
+	{
+		std::partial_sort(results.begin(), results.begin() + maxResults, results.end(), byDistance);
+		results.resize(maxResults);
+	}
+	else
+	{
+		std::sort(results.begin(), results.end(), byDistance);
+	}
+
+	return results;
+}
+
+/**
+ * \brief		: Helper method to find or insert the node of a name
+ * \param[IN]	: const std::u32string &name - folded name
+ * \return		: std::size_t - node
+ */
+std::size_t StudentFuzzyIndex::insertName(const std::u32string &name)
+{
+	std::size_t node = 0;
+
+	for (char32_t character: name)
+	{
+		auto child = std::find_if(nodes[node].children.begin(), nodes[node].children.end(),
+								  [character](const std::pair<char32_t, std::size_t> &c) { return c.first == character; });
+		if (child != nodes[node].children.end())
+		{
+			node = child->second;
+			continue;
+		}
+
+		std::size_t newNode = nodes.size();
+		nodes[node].children.push_back(std::make_pair(character, newNode));
+		nodes.emplace_back();
+		node = newNode;
+	}
+
+	return node;
+}
+
+/**
+ * \brief		: Helper method to collect the students within a distance of the query
+ * \param[IN]	: const std::u32string &query - folded query
+ * \param[IN]	: unsigned int radius - largest distance
+ * \param[OUT]	: std::unordered_map<unsigned int, unsigned int> &closest - smallest distance of each student found
+ * \return		: NONE
+ */
+void StudentFuzzyIndex::search(const std::u32string &query, unsigned int radius,
+							   std::unordered_map<unsigned int, unsigned int> &closest) const
+{
+	std::size_t columns = query.size() + 1;
+
+	//! rows[d] is the Levenshtein row of the node at depth d on the current path
+	std::vector<std::vector<unsigned int>> rows(1, std::vector<unsigned int>(columns));
+	for (std::size_t j = 0; j < columns; j++)
+	{
+		rows[0][j] = j;
+	}
+
+	auto collect = [&](const Node &node, unsigned int nodeDistance)
+	{
+		for (unsigned int matrikelNumber: node.matrikelNumbers)
+		{
+			auto inserted = closest.insert(std::make_pair(matrikelNumber, nodeDistance));
+			if (!inserted.second && nodeDistance < inserted.first->second)
+			{
+				inserted.first->second = nodeDistance;
+			}
+		}
+	};
+
+	if (rows[0][query.size()] <= radius)
+	{
+		collect(nodes[0], rows[0][query.size()]);
+	}
+
+	//! Depth first, an entry is a node, its depth and the character leading to it
+	struct Step
+	{
+		std::size_t node;
+		std::size_t depth;
+		char32_t character;
+	};
+	std::vector<Step> pending;
+	for (const auto &child: nodes[0].children)
+	{
+		pending.push_back(Step{child.second, 1, child.first});
+	}
+
+	while (!pending.empty())
+	{
+		Step step = pending.back();
+		pending.pop_back();
+
+		if (rows.size() <= step.depth)
+		{
+			rows.emplace_back(columns);
+		}
+		const std::vector<unsigned int> &parentRow = rows[step.depth - 1];
+		std::vector<unsigned int> &row = rows[step.depth];
+
+		row[0] = parentRow[0] + 1;
+		unsigned int rowMinimum = row[0];
+		for (std::size_t j = 1; j < columns; j++)
+		{
+			unsigned int substitution = parentRow[j - 1] + (query[j - 1] == step.character ? 0 : 1);
+			row[j] = std::min({parentRow[j] + 1, row[j - 1] + 1, substitution});
+			rowMinimum = std::min(rowMinimum, row[j]);
+		}
+
+		const Node &node = nodes[step.node];
+		if (row[query.size()] <= radius)
+		{
+			collect(node, row[query.size()]);
+		}
+
+		//! Longer names only add to the smallest entry of the row
+		if (rowMinimum <= radius)
+		{
+			for (const auto &child: node.children)
+			{
+				pending.push_back(Step{child.second, step.depth + 1, child.first});
+			}
+		}
+	}
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the nodes as FUZZY_INDEX
+ * \return		: NONE
+ */
+void StudentFuzzyIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::FUZZY_INDEX, studentNodes.size());
+	report.addVector(MemoryReport::FUZZY_INDEX, nodes);
+	for (const Node &node: nodes)
+	{
+		report.addVector(MemoryReport::FUZZY_INDEX, node.children);
+		report.addVector(MemoryReport::FUZZY_INDEX, node.matrikelNumbers);
+	}
+	report.addHashTable(MemoryReport::FUZZY_INDEX, studentNodes);
+}
@@ -0,0 +1,119 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentFuzzyIndex.h
+ *	\brief Header file for StudentFuzzyIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTFUZZYINDEX_H_
+#define STUDENTFUZZYINDEX_H_
+
+//! System Includes
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Character trie over the case folded first and last names for edit distance search
+ * \details		: Every name ends in a trie node that holds the students carrying it. A search
+ *				  walks the trie depth first and carries one row of the Levenshtein matrix
+ *				  per node, computed from the row of the parent. A branch is left as soon as
+ *				  every entry of its row exceeds the radius, so a search only touches the
+ *				  names sharing a nearly matching prefix with the query instead of every
+ *				  name. Distances are counted in Unicode code points, "Josefine" and
+ *				  "Josephine" are 2 apart.
+ *
+ *				  A renamed student is removed from the node of its old name, the node stays
+ *				  in the trie.
+ */
+class StudentFuzzyIndex
+{
+private:
+
+	/**
+	 * \brief		: One trie node, the name spelled by the path from the root
+	 */
+	struct Node
+	{
+		std::vector<std::pair<char32_t, std::size_t>> children;	//!< next character, node
+		std::vector<unsigned int> matrikelNumbers;					//!< students with this name
+	};
+
+	/**
+	 * \brief		: All nodes, node 0 is the root (empty name)
+	 */
+	std::vector<Node> nodes;
+
+	/**
+	 * \brief		: Nodes of the first and last name of every student
+	 */
+	std::unordered_map<unsigned int, std::pair<std::size_t, std::size_t>> studentNodes;
+
+	/**
+	 * \brief		: Helper method to find or insert the node of a name
+	 * \param[IN]	: const std::u32string &name - folded name
+	 * \return		: std::size_t - node
+	 */
+	std::size_t insertName(const std::u32string &name);
+
+	/**
+	 * \brief		: Helper method to collect the students within a distance of the query
+	 * \param[IN]	: const std::u32string &query - folded query
+	 * \param[IN]	: unsigned int radius - largest distance
+	 * \param[OUT]	: std::unordered_map<unsigned int, unsigned int> &closest - smallest distance of each student found
+	 * \return		: NONE
+	 */
+	void search(const std::u32string &query, unsigned int radius,
+				std::unordered_map<unsigned int, unsigned int> &closest) const;
+
+public:
+
+	/**
+	 * \brief		: Constructor
+	 */
+	StudentFuzzyIndex();
+
+	/**
+	 * \brief		: Method to add a student or move it to its new names
+	 * \param[IN]	: const Student &student - student with the current names
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students with a first or last name close to the given name
+	 * \param[IN]	: const std::string &name - name as typed, case insensitive
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most
+	 * \param[IN]	: unsigned int maxDistance - largest edit distance considered
+	 * \return		: std::vector<std::pair<unsigned int, unsigned int>> - matrikel number and distance
+	 *				  of the closest students, by ascending distance and matrikel number
+	 */
+	std::vector<std::pair<unsigned int, unsigned int>> find(const std::string &name, std::size_t maxResults,
+															 unsigned int maxDistance) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the nodes as FUZZY_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTFUZZYINDEX_H_ */
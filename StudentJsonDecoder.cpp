@@ -0,0 +1,518 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentJsonDecoder.cpp
+ *	\brief Source file for StudentJsonDecoder class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <stdexcept>
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+
+//! User Includes
+#include "StudentJsonDecoder.h"
+#include "Address.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+StudentJsonDecoder::StudentJsonDecoder()
+	: cursor{nullptr}, end{nullptr}
+{}
+
+/**
+ * \brief		: Method to skip white space characters
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentJsonDecoder::skipWhitespace ()
+{
+	while (cursor != end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r'))
+	{
+		++cursor;
+	}
+}
+
+/**
+ * \brief		: Method to consume the expected character
+ * \param[IN]	: char expected - character that has to follow
+ * \return		: NONE
+ */
+void StudentJsonDecoder::expect (char expected)
+{
+	if (!consume(expected))
+	{
+		throw std::invalid_argument(std::string("Malformed record, expected '") + expected + "'");
+	}
+}
+
+/**
+ * \brief		: Method to check for and consume an optional character
+ * \param[IN]	: char expected - character that may follow
+ * \return		: bool - true if the character was consumed, false otherwise
+ */
+bool StudentJsonDecoder::consume (char expected)
+{
+	skipWhitespace();
+	if (cursor != end && *cursor == expected)
+	{
+		++cursor;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * \brief		: Method to parse a JSON string into the given buffer
+ * \param[OUT]	: std::string &value - buffer receiving the unescaped (UTF-8) string
+ * \return		: NONE
+ */
+void StudentJsonDecoder::parseString (std::string &value)
+{
+	expect('"');
+	value.clear();
+
+	while (cursor != end)
+	{
+		//! Copy the run of plain characters in one go
+		const char *runStart = cursor;
+		while (cursor != end && *cursor != '"' && *cursor != '\\')
+		{
+			++cursor;
+		}
+		value.append(runStart, cursor);
+
+		if (cursor == end)
+		{
+			break;
+		}
+		if (*cursor == '"')
+		{
+			++cursor;
+			return;
+		}
+
+		//! Escape sequence
+		++cursor;
+		if (cursor == end)
+		{
+			break;
+		}
+		switch (*cursor++)
+		{
+			case '"':  value.push_back('"');  break;
+			case '\\': value.push_back('\\'); break;
+			case '/':  value.push_back('/');  break;
+			case 'b':  value.push_back('\b'); break;
+			case 'f':  value.push_back('\f'); break;
+			case 'n':  value.push_back('\n'); break;
+			case 'r':  value.push_back('\r'); break;
+			case 't':  value.push_back('\t'); break;
+			case 'u':
+			{
+				auto readHex = [this]() -> unsigned long
+				{
+					if (end - cursor < 4)
+					{
+						throw std::invalid_argument("Malformed record, truncated unicode escape");
+					}
+					unsigned long codePoint = 0;
+					for (int digit = 0; digit < 4; digit++, cursor++)
+					{
+						char c = *cursor;
+						codePoint <<= 4;
+						if (c >= '0' && c <= '9')		codePoint |= c - '0';
+						else if (c >= 'a' && c <= 'f')	codePoint |= c - 'a' + 10;
+						else if (c >= 'A' && c <= 'F')	codePoint |= c - 'A' + 10;
+						else throw std::invalid_argument("Malformed record, invalid unicode escape");
+					}
+					return codePoint;
+				};
+
+				unsigned long codePoint = readHex();
+
+				//! Combine UTF-16 surrogate pairs, a high surrogate has to be followed by a low one
+				if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+				{
+					throw std::invalid_argument("Malformed record, unpaired low surrogate");
+				}
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					if (end - cursor < 2 || cursor[0] != '\\' || cursor[1] != 'u')
+					{
+						throw std::invalid_argument("Malformed record, unpaired high surrogate");
+					}
+					cursor += 2;
+					unsigned long lowSurrogate = readHex();
+					if (lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+					{
+						throw std::invalid_argument("Malformed record, invalid low surrogate");
+					}
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				}
+
+				//! Encode the code point as UTF-8
+				if (codePoint < 0x80)
+				{
+					value.push_back(static_cast<char>(codePoint));
+				}
+				else if (codePoint < 0x800)
+				{
+					value.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else if (codePoint < 0x10000)
+				{
+					value.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else
+				{
+					value.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				break;
+			}
+			default:
+				throw std::invalid_argument("Malformed record, invalid escape sequence");
+		}
+	}
+
+	throw std::invalid_argument("Malformed record, unterminated string");
+}
+
+/**
+ * \brief		: Method to parse an integer given as JSON number or as quoted number
+ * \param		: NONE
+ * \return		: long - parsed value
+ */
+long StudentJsonDecoder::parseInteger ()
+{
+	bool quoted = consume('"');
+	bool negative = false;
+	long value = 0;
+
+	if (cursor != end && *cursor == '-')
+	{
+		negative = true;
+		++cursor;
+	}
+
+	const char *digitsStart = cursor;
+	while (cursor != end && *cursor >= '0' && *cursor <= '9')
+	{
+		if (value > 100000000L)
+		{
+			throw std::invalid_argument("Malformed record, integer out of range");
+		}
+		value = value * 10 + (*cursor - '0');
+		++cursor;
+	}
+
+	if (cursor == digitsStart)
+	{
+		throw std::invalid_argument("Malformed record, expected integer");
+	}
+	if (quoted)
+	{
+		expect('"');
+	}
+
+	return negative ? -value : value;
+}
+
+/**
+ * \brief		: Method to parse the postal code given as JSON number or string
+ * \param		: NONE
+ * \return		: unsigned short - postal code
+ */
+unsigned short StudentJsonDecoder::parsePostalCode ()
+{
+	skipWhitespace();
+
+	if (cursor != end && *cursor == '"')
+	{
+		parseString(rawPostalCode);
+	}
+	else
+	{
+		//! Unquoted value, take everything up to the next delimiter so that the message shows the raw input
+		const char *valueStart = cursor;
+		while (cursor != end && *cursor != ',' && *cursor != '}' && *cursor != ']'
+				&& *cursor != ' ' && *cursor != '\t' && *cursor != '\n' && *cursor != '\r')
+		{
+			++cursor;
+		}
+		rawPostalCode.assign(valueStart, cursor);
+	}
+
+	//! Only plain digits that fit into the Address postal code are accepted
+	unsigned long postalCode = 0;
+	bool valid = !rawPostalCode.empty() && rawPostalCode.size() <= 5;
+
+	for (char digit: rawPostalCode)
+	{
+		if (digit < '0' || digit > '9')
+		{
+			valid = false;
+			break;
+		}
+		postalCode = postalCode * 10 + (digit - '0');
+	}
+
+	if (!valid || postalCode > 0xFFFF)
+	{
+		throw std::invalid_argument("Invalid postal code received: " + rawPostalCode);
+	}
+
+	return static_cast<unsigned short>(postalCode);
+}
+
+/**
+ * \brief		: Method to skip a JSON literal: true, false, null or a number
+ * \param		: NONE
+ * \return		: NONE
+ * \throw		: std::invalid_argument - for anything else, e.g. nul or foo
+ */
+void StudentJsonDecoder::skipLiteral ()
+{
+	auto skipDigits = [this]() -> bool
+	{
+		const char *digitsStart = cursor;
+		while (cursor != end && *cursor >= '0' && *cursor <= '9')
+		{
+			++cursor;
+		}
+		return cursor != digitsStart;
+	};
+
+	bool valid = false;
+	for (const char *literal: {"true", "false", "null"})
+	{
+		std::size_t length = std::strlen(literal);
+		if (static_cast<std::size_t>(end - cursor) >= length && std::equal(literal, literal + length, cursor))
+		{
+			cursor += length;
+			valid = true;
+			break;
+		}
+	}
+
+	//! Number: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+	if (!valid)
+	{
+		consume('-');
+		if (cursor != end && *cursor == '0')
+		{
+			++cursor;
+			valid = true;
+		}
+		else
+		{
+			valid = skipDigits();
+		}
+		if (valid && cursor != end && *cursor == '.')
+		{
+			++cursor;
+			valid = skipDigits();
+		}
+		if (valid && cursor != end && (*cursor == 'e' || *cursor == 'E'))
+		{
+			++cursor;
+			if (cursor != end && (*cursor == '+' || *cursor == '-'))
+			{
+				++cursor;
+			}
+			valid = skipDigits();
+		}
+	}
+
+	//! The literal has to end here, truex or 12a are rejected as well
+	if (!valid || (cursor != end && (std::isalnum(static_cast<unsigned char>(*cursor)) || *cursor == '.')))
+	{
+		throw std::invalid_argument("Malformed record, unexpected character");
+	}
+}
+
+/**
+ * \brief		: Method to skip any JSON value (used for unknown members)
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentJsonDecoder::skipValue ()
+{
+	skipWhitespace();
+	if (cursor == end)
+	{
+		throw std::invalid_argument("Malformed record, unexpected end");
+	}
+
+	switch (*cursor)
+	{
+		case '"':
+			parseString(key);
+			break;
+
+		case '{':
+		{
+			++cursor;
+			bool first = true;
+			while (nextMember(first))
+			{
+				skipValue();
+			}
+			break;
+		}
+
+		case '[':
+		{
+			++cursor;
+			if (consume(']'))
+			{
+				break;
+			}
+			do
+			{
+				skipValue();
+			}
+			while (consume(','));
+			expect(']');
+			break;
+		}
+
+		default:
+			skipLiteral();
+			break;
+	}
+}
+
+/**
+ * \brief		: Method to start reading the next member of the current object
+ * \param[IN]	: bool &first - true for the first member, reset by the method
+ * \return		: bool - true if a member name was read into key, false at the end of the object
+ */
+bool StudentJsonDecoder::nextMember (bool &first)
+{
+	if (consume('}'))
+	{
+		return false;
+	}
+	if (!first)
+	{
+		expect(',');
+	}
+	first = false;
+
+	parseString(key);
+	expect(':');
+	return true;
+}
+
+/**
+ * \brief		: Method to decode one generator record into a student
+ * \param[IN]	: const std::string &jsonRecord - one JSON object as sent by the server
+ * \return		: Student - new student with the next free matrikel number
+ * \throw		: std::invalid_argument if the record is malformed or incomplete
+ */
+Student StudentJsonDecoder::decode (const std::string &jsonRecord)
+{
+	cursor = jsonRecord.data();
+	end = cursor + jsonRecord.size();
+
+	std::string firstName, lastName, street, cityName, additionalInfo;
+	long date {-1}, month {-1}, year {-1};
+	unsigned short postalCode {};
+	bool hasPostalCode = false;
+
+	expect('{');
+
+	bool first = true;
+	while (nextMember(first))
+	{
+		if (key == "name")
+		{
+			expect('{');
+			bool firstInName = true;
+			while (nextMember(firstInName))
+			{
+				if (key == "firstName")		parseString(firstName);
+				else if (key == "lastName")	parseString(lastName);
+				else						skipValue();
+			}
+		}
+		else if (key == "dateOfBirth")
+		{
+			expect('{');
+			bool firstInDate = true;
+			while (nextMember(firstInDate))
+			{
+				if (key == "date")			date = parseInteger();
+				else if (key == "month")	month = parseInteger();
+				else if (key == "year")		year = parseInteger();
+				else						skipValue();
+			}
+		}
+		else if (key == "location")
+		{
+			expect('{');
+			bool firstInLocation = true;
+			while (nextMember(firstInLocation))
+			{
+				if (key == "street")		parseString(street);
+				else if (key == "city")		parseString(cityName);
+				else if (key == "state")	parseString(additionalInfo);
+				else if (key == "postCode")
+				{
+					postalCode = parsePostalCode();
+					hasPostalCode = true;
+				}
+				else						skipValue();
+			}
+		}
+		else
+		{
+			skipValue();
+		}
+	}
+
+	//! Nothing but white space may follow the record
+	skipWhitespace();
+	if (cursor != end)
+	{
+		throw std::invalid_argument("Malformed record, trailing characters");
+	}
+
+	if (firstName.empty() || lastName.empty())
+	{
+		throw std::invalid_argument("Incomplete record, name missing");
+	}
+	if (date < 1 || date > 31 || month < 1 || month > 12 || year < 0 || year > 9999)
+	{
+		throw std::invalid_argument("Incomplete record, invalid date of birth");
+	}
+	if (!hasPostalCode)
+	{
+		throw std::invalid_argument("Incomplete record, postal code missing");
+	}
+
+	return Student(firstName, lastName, Poco::Data::Date(year, month, date),
+					Address(street, postalCode, cityName, additionalInfo));
+}
+
+/**
+ * \brief		: Destructor
+ */
+StudentJsonDecoder::~StudentJsonDecoder()
+{}
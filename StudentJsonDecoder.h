@@ -0,0 +1,138 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentJsonDecoder.h
+ *	\brief Header file for StudentJsonDecoder class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTJSONDECODER_H_
+#define STUDENTJSONDECODER_H_
+
+//! System Includes
+#include <string>
+
+//! User Includes
+#include "Student.h"
+
+/**
+ * \brief		: Streaming decoder for the student records sent by the generator server
+ * \details		: The record is scanned once from left to right and the known fields
+ *				  (name, dateOfBirth, location) are copied straight into local values, no
+ *				  intermediate DOM is built. Unknown members are skipped. Malformed input
+ *				  raises std::invalid_argument, the Student is only constructed after the
+ *				  whole record was decoded successfully.
+ */
+class StudentJsonDecoder
+{
+private:
+
+	/**
+	 * \brief		: Current read position in the record
+	 */
+	const char *cursor;
+
+	/**
+	 * \brief		: One past the last character of the record
+	 */
+	const char *end;
+
+	/**
+	 * \brief		: Scratch buffer for member names, reused between records
+	 */
+	std::string key;
+
+	/**
+	 * \brief		: Scratch buffer for the raw postal code, reused between records
+	 */
+	std::string rawPostalCode;
+
+	/**
+	 * \brief		: Method to skip white space characters
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void skipWhitespace ();
+
+	/**
+	 * \brief		: Method to consume the expected character
+	 * \param[IN]	: char expected - character that has to follow
+	 * \return		: NONE
+	 */
+	void expect (char expected);
+
+	/**
+	 * \brief		: Method to check for and consume an optional character
+	 * \param[IN]	: char expected - character that may follow
+	 * \return		: bool - true if the character was consumed, false otherwise
+	 */
+	bool consume (char expected);
+
+	/**
+	 * \brief		: Method to parse a JSON string into the given buffer
+	 * \param[OUT]	: std::string &value - buffer receiving the unescaped (UTF-8) string
+	 * \return		: NONE
+	 */
+	void parseString (std::string &value);
+
+	/**
+	 * \brief		: Method to parse an integer given as JSON number or as quoted number
+	 * \param		: NONE
+	 * \return		: long - parsed value
+	 */
+	long parseInteger ();
+
+	/**
+	 * \brief		: Method to parse the postal code given as JSON number or string
+	 * \param		: NONE
+	 * \return		: unsigned short - postal code
+	 */
+	unsigned short parsePostalCode ();
+
+	/**
+	 * \brief		: Method to skip any JSON value (used for unknown members)
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void skipValue ();
+
+	/**
+	 * \brief		: Method to skip a JSON literal: true, false, null or a number
+	 * \param		: NONE
+	 * \return		: NONE
+	 * \throw		: std::invalid_argument - for anything else, e.g. nul or foo
+	 */
+	void skipLiteral ();
+
+	/**
+	 * \brief		: Method to start reading the next member of the current object
+	 * \param[IN]	: bool &first - true for the first member, reset by the method
+	 * \return		: bool - true if a member name was read into key, false at the end of the object
+	 */
+	bool nextMember (bool &first);
+
+public:
+
+	/**
+	 * \brief		: Constructor
+	 */
+	StudentJsonDecoder ();
+
+	/**
+	 * \brief		: Method to decode one generator record into a student
+	 * \param[IN]	: const std::string &jsonRecord - one JSON object as sent by the server
+	 * \return		: Student - new student with the next free matrikel number
+	 * \throw		: std::invalid_argument if the record is malformed or incomplete
+	 */
+	Student decode (const std::string &jsonRecord);
+
+	/**
+	 * \brief		: Destructor
+	 */
+	~StudentJsonDecoder ();
+};
+
+#endif /* STUDENTJSONDECODER_H_ */
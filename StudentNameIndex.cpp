@@ -0,0 +1,443 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentNameIndex.cpp
+ *	\brief Source file for StudentNameIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STUDENTNAMEINDEX_X86
+#endif
+
+//! User Includes
+#include "StudentNameIndex.h"
+
+namespace
+{
+	//! Smallest part of the buffer worth a thread of its own
+	const std::size_t minBytesPerThread = 512 * 1024;
+
+	const std::size_t notFound = static_cast<std::size_t>(-1);
+
+	/**
+	 * \brief		: Finds the first occurrence of pattern starting in [from, end - size]
+	 */
+	std::size_t findScalar(const char *text, std::size_t from, std::size_t end, const std::string &pattern)
+	{
+		std::size_t size = pattern.size();
+		if (end < size || from > end - size)
+		{
+			return notFound;
+		}
+
+		std::size_t lastStart = end - size;
+		while (from <= lastStart)
+		{
+			const void *hit = std::memchr(text + from, pattern[0], lastStart - from + 1);
+			if (!hit)
+			{
+				return notFound;
+			}
+			from = static_cast<const char*>(hit) - text;
+			if (std::memcmp(text + from, pattern.data(), size) == 0)
+			{
+				return from;
+			}
+			from++;
+		}
+		return notFound;
+	}
+
+#ifdef STUDENTNAMEINDEX_X86
+	/**
+	 * \brief		: SSE2 version of findScalar, filters 16 positions at a time on the first and last byte
+	 */
+	__attribute__((target("sse2")))
+	std::size_t findSse2(const char *text, std::size_t from, std::size_t end, const std::string &pattern)
+	{
+		std::size_t size = pattern.size();
+		const __m128i first = _mm_set1_epi8(pattern[0]);
+		const __m128i last = _mm_set1_epi8(pattern[size - 1]);
+
+		while (from + size - 1 + 16 <= end)
+		{
+			__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + from));
+			__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + from + size - 1));
+			unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+																_mm_cmpeq_epi8(last, blockLast)));
+			while (mask != 0)
+			{
+				unsigned int bit = __builtin_ctz(mask);
+				if (size <= 2 || std::memcmp(text + from + bit + 1, pattern.data() + 1, size - 2) == 0)
+				{
+					return from + bit;
+				}
+				mask &= mask - 1;
+			}
+			from += 16;
+		}
+		return findScalar(text, from, end, pattern);
+	}
+
+	/**
+	 * \brief		: AVX2 version of findScalar, filters 32 positions at a time on the first and last byte
+	 */
+	__attribute__((target("avx2")))
+	std::size_t findAvx2(const char *text, std::size_t from, std::size_t end, const std::string &pattern)
+	{
+		std::size_t size = pattern.size();
+		const __m256i first = _mm256_set1_epi8(pattern[0]);
+		const __m256i last = _mm256_set1_epi8(pattern[size - 1]);
+
+		while (from + size - 1 + 32 <= end)
+		{
+			__m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + from));
+			__m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + from + size - 1));
+			unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+																	  _mm256_cmpeq_epi8(last, blockLast)));
+			while (mask != 0)
+			{
+				unsigned int bit = __builtin_ctz(mask);
+				if (size <= 2 || std::memcmp(text + from + bit + 1, pattern.data() + 1, size - 2) == 0)
+				{
+					return from + bit;
+				}
+				mask &= mask - 1;
+			}
+			from += 32;
+		}
+		return findSse2(text, from, end, pattern);
+	}
+#endif
+
+	typedef std::size_t (*FindFunction)(const char*, std::size_t, std::size_t, const std::string&);
+
+	/**
+	 * \brief		: Picks the widest search the processor supports
+	 */
+	FindFunction selectFind()
+	{
+#ifdef STUDENTNAMEINDEX_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return findAvx2;
+		}
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return findSse2;
+		}
+#endif
+		return findScalar;
+	}
+
+	const FindFunction findPattern = selectFind();
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor
+ */
+StudentNameIndex::StudentNameIndex()
+	: offsets{0}, unusedBytes{0}, ordered{true}
+{}
+
+/**
+ * \brief		: Method to case fold a name, ASCII and the Latin-1 letters (umlauts) of UTF-8 text
+ * \param[IN]	: const std::string &name - UTF-8 text
+ * \return		: std::string - folded text
+ */
+std::string StudentNameIndex::fold(const std::string &name)
+{
+	std::string folded;
+	folded.reserve(name.size());
+
+	for (std::size_t i = 0; i < name.size(); i++)
+	{
+		unsigned char byte = name[i];
+
+		if (byte >= 'A' && byte <= 'Z')
+		{
+			folded.push_back(static_cast<char>(byte + ('a' - 'A')));
+		}
+		//! U+00C0 - U+00DE (Ä, Ö, Ü, ...) without U+00D7 (multiplication sign)
+		else if (byte == 0xC3 && i + 1 < name.size()
+				 && static_cast<unsigned char>(name[i + 1]) >= 0x80 && static_cast<unsigned char>(name[i + 1]) <= 0x9E
+				 && static_cast<unsigned char>(name[i + 1]) != 0x97)
+		{
+			folded.push_back(name[i]);
+			folded.push_back(static_cast<char>(name[i + 1] + 0x20));
+			i++;
+		}
+		//! U+1E9E (capital sharp s) to U+00DF
+		else if (byte == 0xE1 && i + 2 < name.size()
+				 && static_cast<unsigned char>(name[i + 1]) == 0xBA && static_cast<unsigned char>(name[i + 2]) == 0x9E)
+		{
+			folded.append("\xC3\x9F");
+			i += 2;
+		}
+		else
+		{
+			folded.push_back(name[i]);
+		}
+	}
+
+	return folded;
+}
+
+/**
+ * \brief		: Method to add a student or replace its names
+ * \param[IN]	: const Student &student - student with the current names
+ * \return		: NONE
+ */
+void StudentNameIndex::updateStudent(const Student &student)
+{
+	auto existing = records.find(student.getMatrikelNumber());
+	if (existing != records.end())
+	{
+		std::size_t record = existing->second;
+		std::fill(text.begin() + offsets[record], text.begin() + offsets[record + 1], '\0');
+		unusedBytes += offsets[record + 1] - offsets[record];
+		records.erase(existing);
+	}
+
+	appendRecord(student);
+
+	if (unusedBytes > text.size() / 2)
+	{
+		compact();
+	}
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentNameIndex::clear()
+{
+	text.clear();
+	offsets.assign(1, 0);
+	matrikelNumbers.clear();
+	records.clear();
+	unusedBytes = 0;
+	ordered = true;
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name contains a substring (case insensitive)
+ * \param[IN]	: const std::string &subString - search string
+ * \param[IN]	: std::size_t maxResults - number of students to return at most, the first ones by matrikel number
+ * \param[IN]	: ThreadPool *threadPool - pool running the parts of a large scan, nullptr to scan on the calling thread
+ * \return		: std::vector<unsigned int> - matrikel numbers of the matching students in ascending order
+ */
+std::vector<unsigned int> StudentNameIndex::find(const std::string &subString, std::size_t maxResults,
+												 ThreadPool *threadPool) const
+{
+	std::vector<unsigned int> matches;
+	std::string pattern = fold(subString);
+
+	//! Every name contains the empty string, no name contains the separator
+	if (pattern.empty())
+	{
+		matches.reserve(records.size());
+		for (const auto &record: records)
+		{
+			matches.push_back(record.first);
+		}
+		std::sort(matches.begin(), matches.end());
+		if (matches.size() > maxResults)
+		{
+			matches.resize(maxResults);
+		}
+		return matches;
+	}
+	if (pattern.find('\0') != std::string::npos || maxResults == 0)
+	{
+		return matches;
+	}
+
+	std::size_t recordCount = matrikelNumbers.size();
+	//! Without a pool the scan stays on the calling thread, a query never starts threads of its own
+	std::size_t threadCount = threadPool != nullptr
+							  ? std::min<std::size_t>(threadPool->getWorkerCount() + 1,
+													  std::max<std::size_t>(1, text.size() / minBytesPerThread))
+							  : 1;
+
+	//! In matrikel order the first hits are the wanted ones, a short page stops the scan early
+	if (ordered && maxResults < recordCount)
+	{
+		scan(pattern, 0, recordCount, maxResults, matches);
+		return matches;
+	}
+
+	if (threadCount == 1)
+	{
+		scan(pattern, 0, recordCount, recordCount, matches);
+	}
+	else
+	{
+		//! Split the records into parts of about the same number of bytes
+		std::vector<std::size_t> bounds {0};
+		for (std::size_t part = 1; part < threadCount; part++)
+		{
+			std::size_t byte = text.size() / threadCount * part;
+			std::size_t record = std::lower_bound(offsets.begin(), offsets.end(), byte) - offsets.begin();
+			bounds.push_back(std::min(std::max(record, bounds.back()), recordCount));
+		}
+		bounds.push_back(recordCount);
+
+		std::vector<std::vector<unsigned int>> partMatches(threadCount);
+		threadPool->parallelFor("name search", 0, threadCount, 1, [&](std::size_t firstPart, std::size_t endPart)
+		{
+			for (std::size_t part = firstPart; part < endPart; part++)
+			{
+				scan(pattern, bounds[part], bounds[part + 1], recordCount, partMatches[part]);
+			}
+		});
+		for (const auto &part: partMatches)
+		{
+			matches.insert(matches.end(), part.begin(), part.end());
+		}
+	}
+
+	if (!ordered)
+	{
+		std::sort(matches.begin(), matches.end());
+	}
+	if (matches.size() > maxResults)
+	{
+		matches.resize(maxResults);
+	}
+	return matches;
+}
+
+/**
+ * \brief		: Getter method for the size of the packed buffer
+ * \param		: NONE
+ * \return		: std::size_t - size in bytes
+ */
+std::size_t StudentNameIndex::getTextSize() const
+{
+	return text.size();
+}
+
+/**
+ * \brief		: Helper method to append a record
+ * \param[IN]	: const Student &student - student to add
+ * \return		: NONE
+ */
+void StudentNameIndex::appendRecord(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+
+	if (!matrikelNumbers.empty() && matrikelNumber <= matrikelNumbers.back())
+	{
+		ordered = false;
+	}
+
+	text.append(fold(student.getFirstName()));
+	text.push_back('\0');
+	text.append(fold(student.getLastName()));
+	text.push_back('\0');
+
+	records[matrikelNumber] = matrikelNumbers.size();
+	matrikelNumbers.push_back(matrikelNumber);
+	offsets.push_back(text.size());
+}
+
+/**
+ * \brief		: Helper method to rebuild the buffer from the live records in matrikel order
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentNameIndex::compact()
+{
+	std::vector<std::pair<unsigned int, std::size_t>> live(records.begin(), records.end());
+	std::sort(live.begin(), live.end());
+
+	std::string packedText;
+	std::vector<std::size_t> packedOffsets {0};
+	std::vector<unsigned int> packedMatrikelNumbers;
+	packedText.reserve(text.size() - unusedBytes);
+	packedOffsets.reserve(live.size() + 1);
+	packedMatrikelNumbers.reserve(live.size());
+
+	for (const auto &record: live)
+	{
+		packedText.append(text, offsets[record.second], offsets[record.second + 1] - offsets[record.second]);
+		records[record.first] = packedMatrikelNumbers.size();
+		packedMatrikelNumbers.push_back(record.first);
+		packedOffsets.push_back(packedText.size());
+	}
+
+	text.swap(packedText);
+	offsets.swap(packedOffsets);
+	matrikelNumbers.swap(packedMatrikelNumbers);
+	unusedBytes = 0;
+	ordered = true;
+}
+
+/**
+ * \brief		: Helper method to search a range of records
+ * \param[IN]	: const std::string &pattern - folded search string
+ * \param[IN]	: std::size_t firstRecord - first record of the range
+ * \param[IN]	: std::size_t endRecord - record after the range
+ * \param[IN]	: std::size_t maxMatches - number of matches after which the scan stops
+ * \param[OUT]	: std::vector<unsigned int> &matches - matrikel numbers of the matching records
+ * \return		: NONE
+ */
+void StudentNameIndex::scan(const std::string &pattern, std::size_t firstRecord, std::size_t endRecord,
+							std::size_t maxMatches, std::vector<unsigned int> &matches) const
+{
+	const char *data = text.data();
+	std::size_t end = offsets[endRecord];
+	std::size_t position = offsets[firstRecord];
+	std::size_t record = firstRecord;
+
+	while (position < end && matches.size() < maxMatches)
+	{
+		std::size_t hit = findPattern(data, position, end, pattern);
+		if (hit == notFound)
+		{
+			break;
+		}
+
+		//! The pattern holds no separator, so the hit lies inside one record
+		while (offsets[record + 1] <= hit)
+		{
+			record++;
+		}
+		matches.push_back(matrikelNumbers[record]);
+
+		//! One hit per student, continue with the next record
+		position = offsets[record + 1];
+		record++;
+	}
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the buffer, offsets and records as NAME_INDEX
+ * \return		: NONE
+ */
+void StudentNameIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::NAME_INDEX, records.size());
+	report.addString(MemoryReport::NAME_INDEX, text);
+	report.addVector(MemoryReport::NAME_INDEX, offsets);
+	report.addVector(MemoryReport::NAME_INDEX, matrikelNumbers);
+	report.addHashTable(MemoryReport::NAME_INDEX, records);
+}
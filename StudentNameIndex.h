@@ -0,0 +1,150 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentNameIndex.h
+ *	\brief Header file for StudentNameIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTNAMEINDEX_H_
+#define STUDENTNAMEINDEX_H_
+
+//! System Includes
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "ThreadPool.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Case folded copy of all student names for substring search
+ * \details		: The folded first and last name of every student are packed into one
+ *				  buffer as "first\0last\0". A search scans the buffer for the first and last
+ *				  byte of the folded query with SSE2 or AVX2 (chosen at run time), compares
+ *				  the candidates and maps the hits back to matrikel numbers. Large buffers
+ *				  are split between the workers of a ThreadPool if one is given.
+ *
+ *				  A changed student gets a new record at the end, the old one is zeroed so it
+ *				  can not match anymore. The buffer is compacted when half of it is unused.
+ */
+class StudentNameIndex
+{
+private:
+
+	/**
+	 * \brief		: Packed folded names, record i is text[offsets[i], offsets[i + 1])
+	 */
+	std::string text;
+
+	/**
+	 * \brief		: Start of every record and the end of the last one
+	 */
+	std::vector<std::size_t> offsets;
+
+	/**
+	 * \brief		: Matrikel number of every record
+	 */
+	std::vector<unsigned int> matrikelNumbers;
+
+	/**
+	 * \brief		: Live record of every student, by matrikel number
+	 */
+	std::unordered_map<unsigned int, std::size_t> records;
+
+	/**
+	 * \brief		: Bytes of zeroed records
+	 */
+	std::size_t unusedBytes;
+
+	/**
+	 * \brief		: True while the records are in ascending matrikel order
+	 */
+	bool ordered;
+
+	/**
+	 * \brief		: Helper method to append a record
+	 * \param[IN]	: const Student &student - student to add
+	 * \return		: NONE
+	 */
+	void appendRecord(const Student &student);
+
+	/**
+	 * \brief		: Helper method to rebuild the buffer from the live records in matrikel order
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void compact();
+
+	/**
+	 * \brief		: Helper method to search a range of records
+	 * \param[IN]	: const std::string &pattern - folded search string
+	 * \param[IN]	: std::size_t firstRecord - first record of the range
+	 * \param[IN]	: std::size_t endRecord - record after the range
+	 * \param[IN]	: std::size_t maxMatches - number of matches after which the scan stops
+	 * \param[OUT]	: std::vector<unsigned int> &matches - matrikel numbers of the matching records
+	 * \return		: NONE
+	 */
+	void scan(const std::string &pattern, std::size_t firstRecord, std::size_t endRecord,
+			  std::size_t maxMatches, std::vector<unsigned int> &matches) const;
+
+public:
+
+	/**
+	 * \brief		: Constructor
+	 */
+	StudentNameIndex();
+
+	/**
+	 * \brief		: Method to case fold a name, ASCII and the Latin-1 letters (umlauts) of UTF-8 text
+	 * \param[IN]	: const std::string &name - UTF-8 text
+	 * \return		: std::string - folded text
+	 */
+	static std::string fold(const std::string &name);
+
+	/**
+	 * \brief		: Method to add a student or replace its names
+	 * \param[IN]	: const Student &student - student with the current names
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students whose first or last name contains a substring (case insensitive)
+	 * \param[IN]	: const std::string &subString - search string
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most, the first ones by matrikel number
+	 * \param[IN]	: ThreadPool *threadPool - pool running the parts of a large scan, nullptr to scan on the calling thread
+	 * \return		: std::vector<unsigned int> - matrikel numbers of the matching students in ascending order
+	 */
+	std::vector<unsigned int> find(const std::string &subString, std::size_t maxResults = static_cast<std::size_t>(-1),
+								   ThreadPool *threadPool = nullptr) const;
+
+	/**
+	 * \brief		: Getter method for the size of the packed buffer
+	 * \param		: NONE
+	 * \return		: std::size_t - size in bytes
+	 */
+	std::size_t getTextSize() const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the buffer, offsets and records as NAME_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTNAMEINDEX_H_ */
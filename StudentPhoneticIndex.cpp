@@ -0,0 +1,276 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentPhoneticIndex.cpp
+ *	\brief Source file for StudentPhoneticIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <cstring>
+
+//! User Includes
+#include "StudentPhoneticIndex.h"
+
+namespace
+{
+	/**
+	 * \brief		: Reduces a UTF-8 name to the upper case letters A-Z, other characters are dropped
+	 */
+	std::string toBaseLetters(const std::string &name)
+	{
+		//! Base letters of U+00C0 - U+00FF, '\0' for characters that are no letters
+		static const char latin1[] =
+			"AAAAAAACEEEEIIII" "DNOOOOO\0OUUUUYTS"		//! U+00C0 - U+00DF
+			"AAAAAAACEEEEIIII" "DNOOOOO\0OUUUUYTY";		//! U+00E0 - U+00FF
+
+		std::string letters;
+		letters.reserve(name.size());
+
+		for (std::size_t i = 0; i < name.size(); i++)
+		{
+			unsigned char byte = name[i];
+
+			if (byte >= 'a' && byte <= 'z')
+			{
+				letters.push_back(static_cast<char>(byte - ('a' - 'A')));
+			}
+			else if (byte >= 'A' && byte <= 'Z')
+			{
+				letters.push_back(static_cast<char>(byte));
+			}
+			else if (byte == 0xC3 && i + 1 < name.size()
+					 && static_cast<unsigned char>(name[i + 1]) >= 0x80 && static_cast<unsigned char>(name[i + 1]) <= 0xBF)
+			{
+				char letter = latin1[static_cast<unsigned char>(name[i + 1]) - 0x80];
+				if (letter != '\0')
+				{
+					letters.push_back(letter);
+				}
+				i++;
+			}
+		}
+
+		return letters;
+	}
+
+	bool isOneOf(char letter, const char *set)
+	{
+		return letter != '\0' && std::strchr(set, letter) != nullptr;
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to compute the Kölner Phonetik code of a name
+ * \param[IN]	: const std::string &name - UTF-8 name, umlauts and accented letters are reduced to their base letter
+ * \return		: std::string - code of digits 0-8, empty if the name has no letters
+ */
+std::string StudentPhoneticIndex::encode(const std::string &name)
+{
+	std::string letters = toBaseLetters(name);
+	std::string digits;
+
+	for (std::size_t i = 0; i < letters.size(); i++)
+	{
+		char letter = letters[i];
+		char previous = i > 0 ? letters[i - 1] : '\0';
+		char next = i + 1 < letters.size() ? letters[i + 1] : '\0';
+
+		switch (letter)
+		{
+			case 'A': case 'E': case 'I': case 'J': case 'O': case 'U': case 'Y':
+				digits.push_back('0');
+				break;
+			case 'H':
+				break;
+			case 'B':
+				digits.push_back('1');
+				break;
+			case 'P':
+				digits.push_back(next == 'H' ? '3' : '1');
+				break;
+			case 'D': case 'T':
+				digits.push_back(isOneOf(next, "CSZ") ? '8' : '2');
+				break;
+			case 'F': case 'V': case 'W':
+				digits.push_back('3');
+				break;
+			case 'G': case 'K': case 'Q':
+				digits.push_back('4');
+				break;
+			case 'C':
+				if (i == 0)
+				{
+					digits.push_back(isOneOf(next, "AHKLOQRUX") ? '4' : '8');
+				}
+				else
+				{
+					digits.push_back(isOneOf(next, "AHKOQUX") && !isOneOf(previous, "SZ") ? '4' : '8');
+				}
+				break;
+			case 'X':
+				digits.append(isOneOf(previous, "CKQ") ? "8" : "48");
+				break;
+			case 'L':
+				digits.push_back('5');
+				break;
+			case 'M': case 'N':
+				digits.push_back('6');
+				break;
+			case 'R':
+				digits.push_back('7');
+				break;
+			case 'S': case 'Z':
+				digits.push_back('8');
+				break;
+			default:
+				break;
+		}
+	}
+
+	//! Collapse runs of the same digit, then drop the zeros except a leading one
+	std::string code;
+	for (std::size_t i = 0; i < digits.size(); i++)
+	{
+		if (i > 0 && digits[i] == digits[i - 1])
+		{
+			continue;
+		}
+		if (digits[i] == '0' && i > 0)
+		{
+			continue;
+		}
+		code.push_back(digits[i]);
+	}
+
+	return code;
+}
+
+/**
+ * \brief		: Method to add a student or replace its names
+ * \param[IN]	: const Student &student - student with the current names
+ * \return		: NONE
+ */
+void StudentPhoneticIndex::updateStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	std::pair<std::string, std::string> codes(encode(student.getFirstName()), encode(student.getLastName()));
+
+	auto existing = studentCodes.find(matrikelNumber);
+	if (existing != studentCodes.end())
+	{
+		if (existing->second == codes)
+		{
+			return;
+		}
+		removePosting(existing->second.first, matrikelNumber);
+		removePosting(existing->second.second, matrikelNumber);
+	}
+
+	addPosting(codes.first, matrikelNumber);
+	addPosting(codes.second, matrikelNumber);
+	studentCodes[matrikelNumber] = std::move(codes);
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentPhoneticIndex::clear()
+{
+	students.clear();
+	studentCodes.clear();
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name sounds like the given name
+ * \param[IN]	: const std::string &name - name as heard
+ * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+ */
+std::vector<unsigned int> StudentPhoneticIndex::find(const std::string &name) const
+{
+	auto postings = students.find(encode(name));
+	if (postings == students.end())
+	{
+		return std::vector<unsigned int>();
+	}
+	return postings->second;
+}
+
+/**
+ * \brief		: Helper method to add a student to the list of a code
+ * \param[IN]	: const std::string &code - phonetic code
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \return		: NONE
+ */
+void StudentPhoneticIndex::addPosting(const std::string &code, unsigned int matrikelNumber)
+{
+	if (code.empty())
+	{
+		return;
+	}
+
+	std::vector<unsigned int> &postings = students[code];
+	auto position = std::lower_bound(postings.begin(), postings.end(), matrikelNumber);
+
+	//! First and last name may share the code
+	if (position == postings.end() || *position != matrikelNumber)
+	{
+		postings.insert(position, matrikelNumber);
+	}
+}
+
+/**
+ * \brief		: Helper method to remove a student from the list of a code
+ * \param[IN]	: const std::string &code - phonetic code
+ * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+ * \return		: NONE
+ */
+void StudentPhoneticIndex::removePosting(const std::string &code, unsigned int matrikelNumber)
+{
+	auto postings = students.find(code);
+	if (postings == students.end())
+	{
+		return;
+	}
+
+	auto position = std::lower_bound(postings->second.begin(), postings->second.end(), matrikelNumber);
+	if (position != postings->second.end() && *position == matrikelNumber)
+	{
+		postings->second.erase(position);
+	}
+	if (postings->second.empty())
+	{
+		students.erase(postings);
+	}
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the codes and postings as PHONETIC_INDEX
+ * \return		: NONE
+ */
+void StudentPhoneticIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::PHONETIC_INDEX, studentCodes.size());
+	report.addHashTable(MemoryReport::PHONETIC_INDEX, students);
+	for (const auto &posting: students)
+	{
+		report.addString(MemoryReport::PHONETIC_INDEX, posting.first);
+		report.addVector(MemoryReport::PHONETIC_INDEX, posting.second);
+	}
+	report.addHashTable(MemoryReport::PHONETIC_INDEX, studentCodes);
+	for (const auto &codes: studentCodes)
+	{
+		report.addString(MemoryReport::PHONETIC_INDEX, codes.second.first);
+		report.addString(MemoryReport::PHONETIC_INDEX, codes.second.second);
+	}
+}
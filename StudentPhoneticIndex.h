@@ -0,0 +1,100 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentPhoneticIndex.h
+ *	\brief Header file for StudentPhoneticIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTPHONETICINDEX_H_
+#define STUDENTPHONETICINDEX_H_
+
+//! System Includes
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Hash index from the Kölner Phonetik code of a name to the students carrying it
+ * \details		: The codes of the first and last name are computed once when a student is
+ *				  added or renamed. A sound-alike lookup ("Meier", "Meyer" and "Maier" are
+ *				  all 67) encodes the query and returns the posting list of its code, so it
+ *				  costs the size of the result and not a pass over all students.
+ */
+class StudentPhoneticIndex
+{
+private:
+
+	/**
+	 * \brief		: Students by code, each list in ascending matrikel order
+	 */
+	std::unordered_map<std::string, std::vector<unsigned int>> students;
+
+	/**
+	 * \brief		: Codes of the first and last name of every student
+	 */
+	std::unordered_map<unsigned int, std::pair<std::string, std::string>> studentCodes;
+
+	/**
+	 * \brief		: Helper method to add a student to the list of a code
+	 * \param[IN]	: const std::string &code - phonetic code
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \return		: NONE
+	 */
+	void addPosting(const std::string &code, unsigned int matrikelNumber);
+
+	/**
+	 * \brief		: Helper method to remove a student from the list of a code
+	 * \param[IN]	: const std::string &code - phonetic code
+	 * \param[IN]	: unsigned int matrikelNumber - matrikulation number of the student
+	 * \return		: NONE
+	 */
+	void removePosting(const std::string &code, unsigned int matrikelNumber);
+
+public:
+
+	/**
+	 * \brief		: Method to compute the Kölner Phonetik code of a name
+	 * \param[IN]	: const std::string &name - UTF-8 name, umlauts and accented letters are reduced to their base letter
+	 * \return		: std::string - code of digits 0-8, empty if the name has no letters
+	 */
+	static std::string encode(const std::string &name);
+
+	/**
+	 * \brief		: Method to add a student or replace its names
+	 * \param[IN]	: const Student &student - student with the current names
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students whose first or last name sounds like the given name
+	 * \param[IN]	: const std::string &name - name as heard
+	 * \return		: std::vector<unsigned int> - matrikel numbers in ascending order
+	 */
+	std::vector<unsigned int> find(const std::string &name) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the codes and postings as PHONETIC_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTPHONETICINDEX_H_ */
@@ -0,0 +1,102 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentPrefixIndex.cpp
+ *	\brief Source file for StudentPrefixIndex class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+
+//! User Includes
+#include "StudentPrefixIndex.h"
+#include "StudentNameIndex.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Method to add a student or replace its names
+ * \param[IN]	: const Student &student - student with the current names
+ * \return		: NONE
+ */
+void StudentPrefixIndex::updateStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	std::string firstName = StudentNameIndex::fold(student.getFirstName());
+	std::string lastName = StudentNameIndex::fold(student.getLastName());
+
+	auto existing = studentNames.find(matrikelNumber);
+	if (existing != studentNames.end())
+	{
+		names.erase(std::make_pair(existing->second.first, matrikelNumber));
+		names.erase(std::make_pair(existing->second.second, matrikelNumber));
+	}
+
+	names.insert(std::make_pair(firstName, matrikelNumber));
+	names.insert(std::make_pair(lastName, matrikelNumber));
+	studentNames[matrikelNumber] = std::make_pair(std::move(firstName), std::move(lastName));
+}
+
+/**
+ * \brief		: Method to remove all students
+ * \param		: NONE
+ * \return		: NONE
+ */
+void StudentPrefixIndex::clear()
+{
+	names.clear();
+	studentNames.clear();
+}
+
+/**
+ * \brief		: Method to find the students whose first or last name starts with a prefix
+ * \param[IN]	: const std::string &prefix - typed prefix, case insensitive
+ * \param[IN]	: std::size_t maxResults - number of students to return at most
+ * \return		: std::vector<unsigned int> - matrikel numbers ordered by the matching name,
+ *				  then matrikel number; a student matching with both names is listed once
+ */
+std::vector<unsigned int> StudentPrefixIndex::complete(const std::string &prefix, std::size_t maxResults) const
+{
+	std::vector<unsigned int> matches;
+	std::string foldedPrefix = StudentNameIndex::fold(prefix);
+
+	for (auto name = names.lower_bound(std::make_pair(foldedPrefix, 0u));
+		 name != names.end() && matches.size() < maxResults
+				 && name->first.compare(0, foldedPrefix.size(), foldedPrefix) == 0;
+		 name++)
+	{
+		//! At most two entries per student, a linear check over the short result is enough
+		if (std::find(matches.begin(), matches.end(), name->second) == matches.end())
+		{
+			matches.push_back(name->second);
+		}
+	}
+
+	return matches;
+}
+
+/**
+ * \brief		: Method to add the heap blocks of the index to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets the sorted names as PREFIX_INDEX
+ * \return		: NONE
+ */
+void StudentPrefixIndex::reportMemory(MemoryReport &report) const
+{
+	report.addObjects(MemoryReport::PREFIX_INDEX, studentNames.size());
+	report.addTreeNodes(MemoryReport::PREFIX_INDEX, names);
+	for (const auto &name: names)
+	{
+		report.addString(MemoryReport::PREFIX_INDEX, name.first);
+	}
+	report.addHashTable(MemoryReport::PREFIX_INDEX, studentNames);
+	for (const auto &studentName: studentNames)
+	{
+		report.addString(MemoryReport::PREFIX_INDEX, studentName.second.first);
+		report.addString(MemoryReport::PREFIX_INDEX, studentName.second.second);
+	}
+}
@@ -0,0 +1,81 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentPrefixIndex.h
+ *	\brief Header file for StudentPrefixIndex class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTPREFIXINDEX_H_
+#define STUDENTPREFIXINDEX_H_
+
+//! System Includes
+#include <cstddef>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "MemoryReport.h"
+
+/**
+ * \brief		: Sorted case folded first and last names for autocompletion
+ * \details		: Every student has two entries (folded name, matrikel number) in an ordered
+ *				  set, one per name. The names starting with a prefix form one range of the
+ *				  set, found by binary search; a completion reads only as many entries as
+ *				  it returns, independent of the number of students.
+ */
+class StudentPrefixIndex
+{
+private:
+
+	/**
+	 * \brief		: Folded first and last names with the matrikel number
+	 */
+	std::set<std::pair<std::string, unsigned int>> names;
+
+	/**
+	 * \brief		: Folded first and last name of every student, to remove the old entries on a rename
+	 */
+	std::unordered_map<unsigned int, std::pair<std::string, std::string>> studentNames;
+
+public:
+
+	/**
+	 * \brief		: Method to add a student or replace its names
+	 * \param[IN]	: const Student &student - student with the current names
+	 * \return		: NONE
+	 */
+	void updateStudent(const Student &student);
+
+	/**
+	 * \brief		: Method to remove all students
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clear();
+
+	/**
+	 * \brief		: Method to find the students whose first or last name starts with a prefix
+	 * \param[IN]	: const std::string &prefix - typed prefix, case insensitive
+	 * \param[IN]	: std::size_t maxResults - number of students to return at most
+	 * \return		: std::vector<unsigned int> - matrikel numbers ordered by the matching name,
+	 *				  then matrikel number; a student matching with both names is listed once
+	 */
+	std::vector<unsigned int> complete(const std::string &prefix, std::size_t maxResults) const;
+
+	/**
+	 * \brief		: Method to add the heap blocks of the index to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets the sorted names as PREFIX_INDEX
+	 * \return		: NONE
+	 */
+	void reportMemory(MemoryReport &report) const;
+};
+
+#endif /* STUDENTPREFIXINDEX_H_ */
@@ -0,0 +1,338 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentQuery.cpp
+ *	\brief Source file for StudentQuery class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <sstream>
+
+//! User Includes
+#include "StudentQuery.h"
+#include "StudentNameIndex.h"
+#include "Address.h"
+#include "Enrollment.h"
+#include "Course.h"
+
+namespace
+{
+	void writeDate(std::ostream &out, const Poco::Data::Date &date)
+	{
+		out << date.year() << "-" << (date.month() < 10 ? "0" : "") << date.month()
+			<< "-" << (date.day() < 10 ? "0" : "") << date.day();
+	}
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor of an empty node, used by the factory methods
+ * \param[IN]	: Type type - kind of the node
+ */
+StudentQuery::StudentQuery(Type type)
+	: type{type}, lowNumber{0}, highNumber{0}, minGrade{0}, maxGrade{0}
+{
+}
+
+/**
+ * \brief		: Factory methods for the inner nodes
+ * \param[IN]	: std::vector<StudentQuery> children - combined queries
+ * \return		: StudentQuery - node combining the children
+ */
+StudentQuery StudentQuery::allOf(std::vector<StudentQuery> children)
+{
+	StudentQuery query(ALL_OF);
+	query.children = std::move(children);
+	return query;
+}
+
+StudentQuery StudentQuery::anyOf(std::vector<StudentQuery> children)
+{
+	StudentQuery query(ANY_OF);
+	query.children = std::move(children);
+	return query;
+}
+
+StudentQuery StudentQuery::noneOf(std::vector<StudentQuery> children)
+{
+	StudentQuery query(NONE_OF);
+	query.children = std::move(children);
+	return query;
+}
+
+/**
+ * \brief		: Factory methods for the leaves, see Type for their meaning
+ * \return		: StudentQuery - leaf node
+ */
+StudentQuery StudentQuery::nameContains(const std::string &subString)
+{
+	StudentQuery query(NAME_CONTAINS);
+	query.text = StudentNameIndex::fold(subString);
+	return query;
+}
+
+StudentQuery StudentQuery::city(const std::string &cityName)
+{
+	StudentQuery query(CITY);
+	query.text = StudentNameIndex::fold(cityName);
+	return query;
+}
+
+StudentQuery StudentQuery::postalCode(unsigned short from, unsigned short to)
+{
+	StudentQuery query(POSTAL_CODE);
+	query.lowNumber = from;
+	query.highNumber = to;
+	return query;
+}
+
+StudentQuery StudentQuery::bornBetween(const Poco::Data::Date &from, const Poco::Data::Date &to)
+{
+	StudentQuery query(BORN_BETWEEN);
+	query.fromDate = from;
+	query.toDate = to;
+	return query;
+}
+
+StudentQuery StudentQuery::enrolledIn(unsigned int courseKey)
+{
+	StudentQuery query(ENROLLED_IN);
+	query.lowNumber = courseKey;
+	return query;
+}
+
+StudentQuery StudentQuery::semester(const std::string &semester)
+{
+	StudentQuery query(SEMESTER);
+	query.text = semester;
+	return query;
+}
+
+StudentQuery StudentQuery::major(unsigned char major)
+{
+	StudentQuery query(MAJOR);
+	query.lowNumber = major;
+	return query;
+}
+
+StudentQuery StudentQuery::gradeBetween(float minGrade, float maxGrade, unsigned int courseKey)
+{
+	StudentQuery query(GRADE_BETWEEN);
+	query.minGrade = minGrade;
+	query.maxGrade = maxGrade;
+	query.lowNumber = courseKey;
+	return query;
+}
+
+/**
+ * \brief		: Method to choose the attributes returned by project
+ * \param[IN]	: std::vector<Field> fields - attributes in output order
+ * \return		: StudentQuery& - this query
+ */
+StudentQuery& StudentQuery::select(std::vector<Field> fields)
+{
+	this->fields = std::move(fields);
+	return *this;
+}
+
+/**
+ * \brief		: Getter methods for the node attributes, used by the planner
+ */
+StudentQuery::Type StudentQuery::getType() const
+{
+	return type;
+}
+
+const std::vector<StudentQuery>& StudentQuery::getChildren() const
+{
+	return children;
+}
+
+const std::string& StudentQuery::getText() const
+{
+	return text;
+}
+
+unsigned int StudentQuery::getLowNumber() const
+{
+	return lowNumber;
+}
+
+unsigned int StudentQuery::getHighNumber() const
+{
+	return highNumber;
+}
+
+const Poco::Data::Date& StudentQuery::getFromDate() const
+{
+	return fromDate;
+}
+
+const Poco::Data::Date& StudentQuery::getToDate() const
+{
+	return toDate;
+}
+
+/**
+ * \brief		: Method to check a student against the query
+ * \param[IN]	: const Student &student - student to be checked
+ * \param[IN]	: const std::vector<const StudentQuery*> &satisfied - nodes already known to hold,
+ *				  they are not evaluated again
+ * \return		: bool - true if the student matches
+ */
+bool StudentQuery::matches(const Student &student, const std::vector<const StudentQuery*> &satisfied) const
+{
+	if (std::find(satisfied.begin(), satisfied.end(), this) != satisfied.end())
+	{
+		return true;
+	}
+
+	switch (type)
+	{
+		case ALL_OF:
+			return std::all_of(children.begin(), children.end(),
+							   [&](const StudentQuery &child) { return child.matches(student, satisfied); });
+		case ANY_OF:
+			return std::any_of(children.begin(), children.end(),
+							   [&](const StudentQuery &child) { return child.matches(student, satisfied); });
+		case NONE_OF:
+			//! Nodes below a negation are never marked as satisfied
+			return std::none_of(children.begin(), children.end(),
+								[&](const StudentQuery &child) { return child.matches(student); });
+		case NAME_CONTAINS:
+			return StudentNameIndex::fold(student.getFirstName()).find(text) != std::string::npos
+				|| StudentNameIndex::fold(student.getLastName()).find(text) != std::string::npos;
+		case CITY:
+			return StudentNameIndex::fold(student.getAddress().getCityName()) == text;
+		case POSTAL_CODE:
+			return student.getAddress().getPostalCode() >= lowNumber && student.getAddress().getPostalCode() <= highNumber;
+		case BORN_BETWEEN:
+			return !(student.getDateOfBirth() < fromDate) && !(toDate < student.getDateOfBirth());
+		default:
+			break;
+	}
+
+	//! The remaining predicates hold if one enrollment satisfies them
+	for (const Enrollment &enrollment: student.getEnrollments())
+	{
+		bool isCourse = enrollment.getCourse().getCourseKey() == lowNumber;
+
+		if ((type == ENROLLED_IN && isCourse)
+			|| (type == SEMESTER && enrollment.getSemester() == text)
+			|| (type == MAJOR && enrollment.getCourse().getMajor() == lowNumber)
+			|| (type == GRADE_BETWEEN && (lowNumber == anyCourse || isCourse)
+				&& enrollment.getGrade() >= minGrade && enrollment.getGrade() <= maxGrade))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief		: Method to return the selected attributes of a student, matrikel number and names if none are selected
+ * \param[IN]	: const Student &student - matching student
+ * \return		: std::vector<std::string> - one entry per selected attribute
+ */
+std::vector<std::string> StudentQuery::project(const Student &student) const
+{
+	static const std::vector<Field> defaultFields {MATRIKEL_NUMBER, FIRST_NAME, LAST_NAME};
+	std::vector<std::string> row;
+
+	for (Field field: fields.empty() ? defaultFields : fields)
+	{
+		std::ostringstream value;
+
+		switch (field)
+		{
+			case MATRIKEL_NUMBER:
+				value << student.getMatrikelNumber();
+				break;
+			case FIRST_NAME:
+				value << student.getFirstName();
+				break;
+			case LAST_NAME:
+				value << student.getLastName();
+				break;
+			case DATE_OF_BIRTH:
+				writeDate(value, student.getDateOfBirth());
+				break;
+			case STREET:
+				value << student.getAddress().getStreet();
+				break;
+			case POSTAL_CODE_FIELD:
+				value << student.getAddress().getPostalCode();
+				break;
+			case CITY_FIELD:
+				value << student.getAddress().getCityName();
+				break;
+		}
+		row.push_back(value.str());
+	}
+
+	return row;
+}
+
+/**
+ * \brief		: Method to describe the query, e.g. all(city = "darmstadt", grade 1-2 in 1234)
+ * \param		: NONE
+ * \return		: std::string - description
+ */
+std::string StudentQuery::toString() const
+{
+	std::ostringstream out;
+
+	switch (type)
+	{
+		case ALL_OF:
+		case ANY_OF:
+		case NONE_OF:
+			out << (type == ALL_OF ? "all(" : type == ANY_OF ? "any(" : "none(");
+			for (std::size_t child = 0; child < children.size(); child++)
+			{
+				out << (child > 0 ? ", " : "") << children[child].toString();
+			}
+			out << ")";
+			break;
+		case NAME_CONTAINS:
+			out << "name contains \"" << text << "\"";
+			break;
+		case CITY:
+			out << "city = \"" << text << "\"";
+			break;
+		case POSTAL_CODE:
+			out << "postal code " << lowNumber << "-" << highNumber;
+			break;
+		case BORN_BETWEEN:
+			out << "born ";
+			writeDate(out, fromDate);
+			out << " to ";
+			writeDate(out, toDate);
+			break;
+		case ENROLLED_IN:
+			out << "enrolled in " << lowNumber;
+			break;
+		case SEMESTER:
+			out << "semester = \"" << text << "\"";
+			break;
+		case MAJOR:
+			out << "major = " << static_cast<char>(lowNumber);
+			break;
+		case GRADE_BETWEEN:
+			out << "grade " << minGrade << "-" << maxGrade;
+			if (lowNumber != anyCourse)
+			{
+				out << " in " << lowNumber;
+			}
+			break;
+	}
+
+	return out.str();
+}
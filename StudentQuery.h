@@ -0,0 +1,162 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentQuery.h
+ *	\brief Header file for StudentQuery class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef STUDENTQUERY_H_
+#define STUDENTQUERY_H_
+
+//! System Includes
+#include <string>
+#include <vector>
+
+//! User Includes
+#include "Student.h"
+#include "Poco/Data/Date.h"
+
+/**
+ * \brief		: Filter over the students as a tree of predicates, with the attributes to return
+ * \details		: Leaves test one attribute of a student, inner nodes combine their children
+ *				  with and, or and not. A query only describes the filter, StudentDb::queryStudents
+ *				  plans it onto the indexes and StudentDb::explainQuery shows that plan.
+ *
+ *				  StudentQuery::allOf({StudentQuery::city("Darmstadt"),
+ *									   StudentQuery::gradeBetween(1.0, 2.0, 1234)})
+ */
+class StudentQuery
+{
+public:
+
+	/**
+	 * \brief		: Kind of a query node
+	 */
+	enum Type
+	{
+		ALL_OF,				//!< all children hold, true without children
+		ANY_OF,				//!< at least one child holds
+		NONE_OF,			//!< no child holds
+		NAME_CONTAINS,		//!< first or last name contains the text (case insensitive)
+		CITY,				//!< city equals the text (case insensitive)
+		POSTAL_CODE,		//!< postal code within [lowNumber, highNumber]
+		BORN_BETWEEN,		//!< date of birth within [fromDate, toDate]
+		ENROLLED_IN,		//!< enrolled in course lowNumber
+		SEMESTER,			//!< enrolled in any course in the semester given by the text
+		MAJOR,				//!< enrolled in any course of the major lowNumber (first character)
+		GRADE_BETWEEN		//!< a grade within [minGrade, maxGrade], in course lowNumber unless it is anyCourse
+	};
+
+	/**
+	 * \brief		: Attributes a query can return for each student
+	 */
+	enum Field
+	{
+		MATRIKEL_NUMBER,
+		FIRST_NAME,
+		LAST_NAME,
+		DATE_OF_BIRTH,
+		STREET,
+		POSTAL_CODE_FIELD,
+		CITY_FIELD
+	};
+
+	/**
+	 * \brief		: Course key of gradeBetween that accepts the grade of any enrollment
+	 */
+	static constexpr unsigned int anyCourse = 0;
+
+private:
+
+	Type type;
+	std::vector<StudentQuery> children;
+	std::string text;
+	unsigned int lowNumber;
+	unsigned int highNumber;
+	Poco::Data::Date fromDate;
+	Poco::Data::Date toDate;
+	float minGrade;
+	float maxGrade;
+
+	/**
+	 * \brief		: Attributes returned by project
+	 */
+	std::vector<Field> fields;
+
+	/**
+	 * \brief		: Constructor of an empty node, used by the factory methods
+	 * \param[IN]	: Type type - kind of the node
+	 */
+	explicit StudentQuery(Type type);
+
+public:
+
+	/**
+	 * \brief		: Factory methods for the inner nodes
+	 * \param[IN]	: std::vector<StudentQuery> children - combined queries
+	 * \return		: StudentQuery - node combining the children
+	 */
+	static StudentQuery allOf(std::vector<StudentQuery> children);
+	static StudentQuery anyOf(std::vector<StudentQuery> children);
+	static StudentQuery noneOf(std::vector<StudentQuery> children);
+
+	/**
+	 * \brief		: Factory methods for the leaves, see Type for their meaning
+	 * \return		: StudentQuery - leaf node
+	 */
+	static StudentQuery nameContains(const std::string &subString);
+	static StudentQuery city(const std::string &cityName);
+	static StudentQuery postalCode(unsigned short from, unsigned short to);
+	static StudentQuery bornBetween(const Poco::Data::Date &from, const Poco::Data::Date &to);
+	static StudentQuery enrolledIn(unsigned int courseKey);
+	static StudentQuery semester(const std::string &semester);
+	static StudentQuery major(unsigned char major);
+	static StudentQuery gradeBetween(float minGrade, float maxGrade, unsigned int courseKey = anyCourse);
+
+	/**
+	 * \brief		: Method to choose the attributes returned by project
+	 * \param[IN]	: std::vector<Field> fields - attributes in output order
+	 * \return		: StudentQuery& - this query
+	 */
+	StudentQuery& select(std::vector<Field> fields);
+
+	/**
+	 * \brief		: Getter methods for the node attributes, used by the planner
+	 */
+	Type getType() const;
+	const std::vector<StudentQuery>& getChildren() const;
+	const std::string& getText() const;
+	unsigned int getLowNumber() const;
+	unsigned int getHighNumber() const;
+	const Poco::Data::Date& getFromDate() const;
+	const Poco::Data::Date& getToDate() const;
+
+	/**
+	 * \brief		: Method to check a student against the query
+	 * \param[IN]	: const Student &student - student to be checked
+	 * \param[IN]	: const std::vector<const StudentQuery*> &satisfied - nodes already known to hold,
+	 *				  they are not evaluated again
+	 * \return		: bool - true if the student matches
+	 */
+	bool matches(const Student &student, const std::vector<const StudentQuery*> &satisfied = {}) const;
+
+	/**
+	 * \brief		: Method to return the selected attributes of a student, matrikel number and names if none are selected
+	 * \param[IN]	: const Student &student - matching student
+	 * \return		: std::vector<std::string> - one entry per selected attribute
+	 */
+	std::vector<std::string> project(const Student &student) const;
+
+	/**
+	 * \brief		: Method to describe the query, e.g. all(city = "darmstadt", grade 1-2 in 1234)
+	 * \param		: NONE
+	 * \return		: std::string - description
+	 */
+	std::string toString() const;
+};
+
+#endif /* STUDENTQUERY_H_ */
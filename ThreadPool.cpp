@@ -0,0 +1,328 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ThreadPool.cpp
+ *	\brief Source file for ThreadPool class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+//! User Includes
+#include "ThreadPool.h"
+
+namespace
+{
+	//! Pool and queue of the worker running on this thread, so nested calls use the own queue
+	thread_local const ThreadPool *currentPool = nullptr;
+	thread_local std::size_t currentQueue = 0;
+}
+
+/**
+ * \brief		: One parallelFor call, lives on the stack of its caller
+ */
+struct ThreadPool::Job
+{
+	const RangeFunction &function;
+	std::atomic<std::size_t> remaining;
+
+	//! Guards the members below, held while the last range signals done
+	std::mutex mutex;
+	std::condition_variable done;
+	std::exception_ptr error;
+	std::size_t stolenRanges;
+	double busySeconds;
+	std::vector<bool> participants;
+
+	Job(const RangeFunction &function, std::size_t ranges, std::size_t threads)
+		: function(function), remaining{ranges}, stolenRanges{0}, busySeconds{0}, participants(threads, false)
+	{
+	}
+};
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: unsigned int workerCount - number of worker threads, 0 for one per core
+ * \param[IN]	: bool pinWorkers - true to pin worker i to CPU i (modulo the CPUs)
+ */
+ThreadPool::ThreadPool(unsigned int workerCount, bool pinWorkers)
+	: queuedTasks{0}, stopping{false}
+{
+	unsigned int cpus = std::max(1u, std::thread::hardware_concurrency());
+	if (workerCount == 0)
+	{
+		workerCount = cpus;
+	}
+
+	//! One queue per worker plus one for threads outside the pool
+	for (unsigned int queue = 0; queue <= workerCount; queue++)
+	{
+		queues.emplace_back(new WorkerQueue());
+	}
+
+	for (unsigned int worker = 0; worker < workerCount; worker++)
+	{
+		workers.emplace_back(&ThreadPool::workerLoop, this, worker);
+#ifdef __linux__
+		if (pinWorkers)
+		{
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			CPU_SET(worker % cpus, &cpuSet);
+			pthread_setaffinity_np(workers.back().native_handle(), sizeof(cpuSet), &cpuSet);
+		}
+#else
+		(void) pinWorkers;
+#endif
+	}
+}
+
+/**
+ * \brief		: Destructor, finishes the queued work and joins the workers
+ */
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> sleepLock(sleepMutex);
+		stopping = true;
+	}
+	wakeUp.notify_all();
+
+	for (std::thread &worker: workers)
+	{
+		worker.join();
+	}
+}
+
+/**
+ * \brief		: Getter method for the number of worker threads
+ * \param		: NONE
+ * \return		: unsigned int - worker threads, the caller of parallelFor not counted
+ */
+unsigned int ThreadPool::getWorkerCount() const
+{
+	return static_cast<unsigned int>(workers.size());
+}
+
+/**
+ * \brief		: Method to run a function over an index range split across the workers
+ * \param[IN]	: const std::string &name - name of the timing record
+ * \param[IN]	: std::size_t begin - first index
+ * \param[IN]	: std::size_t end - index after the last one
+ * \param[IN]	: std::size_t grain - indexes per range at least, 0 for one range per thread
+ * \param[IN]	: const RangeFunction &function - function run per range, concurrently
+ * \return		: NONE, returns when all ranges are done and rethrows the first exception of a range
+ */
+void ThreadPool::parallelFor(const std::string &name, std::size_t begin, std::size_t end, std::size_t grain,
+							 const RangeFunction &function)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::size_t size = end - begin;
+	if (grain == 0)
+	{
+		grain = (size + queues.size() - 1) / queues.size();
+	}
+	std::size_t rangeCount = (size + grain - 1) / grain;
+	std::size_t self = currentPool == this ? currentQueue : queues.size() - 1;
+
+	Job job(function, rangeCount, queues.size());
+
+	//! Deal the ranges in contiguous blocks, one block per queue
+	queuedTasks += rangeCount;
+	for (std::size_t queue = 0; queue < queues.size(); queue++)
+	{
+		std::size_t firstRange = rangeCount * queue / queues.size();
+		std::size_t endRange = rangeCount * (queue + 1) / queues.size();
+		if (firstRange == endRange)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> queueLock(queues[queue]->mutex);
+		for (std::size_t range = firstRange; range < endRange; range++)
+		{
+			queues[queue]->tasks.push_back(Task{&job, begin + range * grain, std::min(end, begin + (range + 1) * grain), queue});
+		}
+	}
+	{
+		std::lock_guard<std::mutex> sleepLock(sleepMutex);
+	}
+	wakeUp.notify_all();
+
+	//! Help until every range is taken, then wait for the ones still running
+	while (job.remaining > 0)
+	{
+		Task task;
+		if (takeTask(self, task))
+		{
+			runTask(task, self);
+		}
+		else
+		{
+			std::unique_lock<std::mutex> jobLock(job.mutex);
+			job.done.wait(jobLock, [&job]() { return job.remaining == 0; });
+		}
+	}
+
+	//! The last range may still hold the lock while it signals
+	std::lock_guard<std::mutex> jobLock(job.mutex);
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	TaskTiming timing;
+	timing.name = name;
+	timing.ranges = rangeCount;
+	timing.stolenRanges = job.stolenRanges;
+	timing.threads = static_cast<unsigned int>(std::count(job.participants.begin(), job.participants.end(), true));
+	timing.seconds = elapsed.count();
+	timing.busySeconds = job.busySeconds;
+	{
+		std::lock_guard<std::mutex> timingsLock(timingsMutex);
+		timings.push_back(timing);
+		if (timings.size() > maxTimings)
+		{
+			timings.pop_front();
+		}
+	}
+
+	if (job.error)
+	{
+		std::rethrow_exception(job.error);
+	}
+}
+
+/**
+ * \brief		: Method to get the timings of the latest parallelFor calls
+ * \param		: NONE
+ * \return		: std::vector<TaskTiming> - oldest first, at most maxTimings
+ */
+std::vector<TaskTiming> ThreadPool::getTimings() const
+{
+	std::lock_guard<std::mutex> timingsLock(timingsMutex);
+	return std::vector<TaskTiming>(timings.begin(), timings.end());
+}
+
+/**
+ * \brief		: Method to drop all timings
+ * \param		: NONE
+ * \return		: NONE
+ */
+void ThreadPool::clearTimings()
+{
+	std::lock_guard<std::mutex> timingsLock(timingsMutex);
+	timings.clear();
+}
+
+/**
+ * \brief		: Helper method run by every worker thread
+ * \param[IN]	: std::size_t index - index of the worker and its queue
+ * \return		: NONE
+ */
+void ThreadPool::workerLoop(std::size_t index)
+{
+	currentPool = this;
+	currentQueue = index;
+
+	while (true)
+	{
+		Task task;
+		if (takeTask(index, task))
+		{
+			runTask(task, index);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> sleepLock(sleepMutex);
+		wakeUp.wait(sleepLock, [this]() { return stopping || queuedTasks > 0; });
+		if (stopping && queuedTasks == 0)
+		{
+			return;
+		}
+	}
+}
+
+/**
+ * \brief		: Helper method to take a task, first from the own queue, then from the others
+ * \param[IN]	: std::size_t index - queue of the calling thread
+ * \param[OUT]	: Task &task - task taken
+ * \return		: bool - false if all queues are empty
+ */
+bool ThreadPool::takeTask(std::size_t index, Task &task)
+{
+	//! Own queue from the back keeps neighbouring ranges on one thread, thieves take the front
+	for (std::size_t offset = 0; offset < queues.size(); offset++)
+	{
+		WorkerQueue &queue = *queues[(index + offset) % queues.size()];
+		std::lock_guard<std::mutex> queueLock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			if (offset == 0)
+			{
+				task = queue.tasks.back();
+				queue.tasks.pop_back();
+			}
+			else
+			{
+				task = queue.tasks.front();
+				queue.tasks.pop_front();
+			}
+			queuedTasks--;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * \brief		: Helper method to run a task and account its time
+ * \param[IN]	: const Task &task - task to run
+ * \param[IN]	: std::size_t index - queue of the running thread
+ * \return		: NONE
+ */
+void ThreadPool::runTask(const Task &task, std::size_t index)
+{
+	Job &job = *task.job;
+	std::exception_ptr error;
+
+	auto start = std::chrono::steady_clock::now();
+	try
+	{
+		job.function(task.begin, task.end);
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::lock_guard<std::mutex> jobLock(job.mutex);
+	job.busySeconds += elapsed.count();
+	job.participants[index] = true;
+	job.stolenRanges += task.queue != index;
+	if (error && !job.error)
+	{
+		job.error = error;
+	}
+	if (--job.remaining == 0)
+	{
+		job.done.notify_all();
+	}
+}
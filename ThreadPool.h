@@ -0,0 +1,179 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ThreadPool.h
+ *	\brief Header file for ThreadPool class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+//! System Includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief		: Timing of one parallelFor call
+ */
+struct TaskTiming
+{
+	std::string name;					//!< name given to parallelFor
+	std::size_t ranges = 0;				//!< number of ranges the work was split into
+	std::size_t stolenRanges = 0;		//!< ranges run by another thread than the one they were queued for
+	unsigned int threads = 0;			//!< threads that ran at least one range, the caller included
+	double seconds = 0;					//!< wall clock time of the call
+	double busySeconds = 0;				//!< sum of the run times of all ranges
+};
+
+/**
+ * \brief		: Work-stealing pool of worker threads for range tasks
+ * \details		: parallelFor cuts an index range into ranges of a grain size and deals
+ *				  them out in contiguous blocks, one block per worker queue. A worker takes
+ *				  ranges from the back of its own queue and, when that is empty, steals from
+ *				  the front of the others, so an uneven split balances itself without a
+ *				  shared queue. The calling thread runs ranges too while it waits, which also
+ *				  makes a parallelFor from inside a range safe.
+ *
+ *				  Workers can be pinned to one CPU each (Linux only). Every call leaves a
+ *				  TaskTiming behind; running the same work on pools of 1 to N workers gives
+ *				  the scaling curve.
+ */
+class ThreadPool
+{
+public:
+
+	/**
+	 * \brief		: Function run on the indexes [begin, end) of a range
+	 */
+	typedef std::function<void(std::size_t begin, std::size_t end)> RangeFunction;
+
+	/**
+	 * \brief		: Number of timings kept, older ones are dropped
+	 */
+	static const std::size_t maxTimings = 1024;
+
+private:
+
+	struct Job;
+
+	/**
+	 * \brief		: Range of a job waiting in a queue
+	 */
+	struct Task
+	{
+		Job *job;
+		std::size_t begin;
+		std::size_t end;
+		std::size_t queue;				//!< queue the range was dealt to
+	};
+
+	/**
+	 * \brief		: Queue of one worker, the last one belongs to the calling threads
+	 */
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	std::vector<std::unique_ptr<WorkerQueue>> queues;
+	std::vector<std::thread> workers;
+
+	/**
+	 * \brief		: Number of queued tasks, idle workers sleep while it is 0
+	 */
+	std::atomic<std::size_t> queuedTasks;
+	std::mutex sleepMutex;
+	std::condition_variable wakeUp;
+	bool stopping;
+
+	mutable std::mutex timingsMutex;
+	std::deque<TaskTiming> timings;
+
+	/**
+	 * \brief		: Helper method run by every worker thread
+	 * \param[IN]	: std::size_t index - index of the worker and its queue
+	 * \return		: NONE
+	 */
+	void workerLoop(std::size_t index);
+
+	/**
+	 * \brief		: Helper method to take a task, first from the own queue, then from the others
+	 * \param[IN]	: std::size_t index - queue of the calling thread
+	 * \param[OUT]	: Task &task - task taken
+	 * \return		: bool - false if all queues are empty
+	 */
+	bool takeTask(std::size_t index, Task &task);
+
+	/**
+	 * \brief		: Helper method to run a task and account its time
+	 * \param[IN]	: const Task &task - task to run
+	 * \param[IN]	: std::size_t index - queue of the running thread
+	 * \return		: NONE
+	 */
+	void runTask(const Task &task, std::size_t index);
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: unsigned int workerCount - number of worker threads, 0 for one per core
+	 * \param[IN]	: bool pinWorkers - true to pin worker i to CPU i (modulo the CPUs)
+	 */
+	ThreadPool(unsigned int workerCount = 0, bool pinWorkers = false);
+
+	/**
+	 * \brief		: Destructor, finishes the queued work and joins the workers
+	 */
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * \brief		: Getter method for the number of worker threads
+	 * \param		: NONE
+	 * \return		: unsigned int - worker threads, the caller of parallelFor not counted
+	 */
+	unsigned int getWorkerCount() const;
+
+	/**
+	 * \brief		: Method to run a function over an index range split across the workers
+	 * \param[IN]	: const std::string &name - name of the timing record
+	 * \param[IN]	: std::size_t begin - first index
+	 * \param[IN]	: std::size_t end - index after the last one
+	 * \param[IN]	: std::size_t grain - indexes per range at least, 0 for one range per thread
+	 * \param[IN]	: const RangeFunction &function - function run per range, concurrently
+	 * \return		: NONE, returns when all ranges are done and rethrows the first exception of a range
+	 */
+	void parallelFor(const std::string &name, std::size_t begin, std::size_t end, std::size_t grain,
+					 const RangeFunction &function);
+
+	/**
+	 * \brief		: Method to get the timings of the latest parallelFor calls
+	 * \param		: NONE
+	 * \return		: std::vector<TaskTiming> - oldest first, at most maxTimings
+	 */
+	std::vector<TaskTiming> getTimings() const;
+
+	/**
+	 * \brief		: Method to drop all timings
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void clearTimings();
+};
+
+#endif /* THREADPOOL_H_ */
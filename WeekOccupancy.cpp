@@ -0,0 +1,113 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file WeekOccupancy.cpp
+ *	\brief Source file for WeekOccupancy class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+
+//! User Includes
+#include "WeekOccupancy.h"
+#include "CourseScheduleIndex.h"
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Constructor, all quarter hours free
+ */
+WeekOccupancy::WeekOccupancy()
+	: words{}
+{
+}
+
+/**
+ * \brief		: Method to mark the quarter hours touched by [begin, end)
+ * \param[IN]	: unsigned int begin - first minute, counted from Sunday 0:00
+ * \param[IN]	: unsigned int end - minute after the period, at most the end of the week
+ * \return		: NONE
+ */
+void WeekOccupancy::addMinutes(unsigned int begin, unsigned int end)
+{
+	unsigned int firstSlot = begin / minutesPerSlot;
+	unsigned int endSlot = std::min(slotCount, (end + minutesPerSlot - 1) / minutesPerSlot);
+
+	for (unsigned int slot = firstSlot; slot < endSlot; )
+	{
+		//! Whole runs of bits of one word at a time
+		unsigned int bit = slot % 64;
+		unsigned int bits = std::min(64 - bit, endSlot - slot);
+		std::uint64_t mask = bits == 64 ? ~std::uint64_t{0} : ((std::uint64_t{1} << bits) - 1) << bit;
+		words[slot / 64] |= mask;
+		slot += bits;
+	}
+}
+
+/**
+ * \brief		: Method to mark the meeting times of a course
+ * \param[IN]	: const Course &course - weekly or block course, a block course marks every weekday it covers
+ * \return		: NONE
+ */
+void WeekOccupancy::addCourse(const Course &course)
+{
+	for (const auto &minutes: CourseScheduleIndex::getWeekMinutes(course))
+	{
+		addMinutes(minutes.first, minutes.second);
+	}
+}
+
+/**
+ * \brief		: Method to check a quarter hour
+ * \param[IN]	: unsigned int slot - quarter hour of the week, below slotCount
+ * \return		: bool - true if it is busy
+ */
+bool WeekOccupancy::isOccupied(unsigned int slot) const
+{
+	return (words[slot / 64] >> (slot % 64)) & 1;
+}
+
+/**
+ * \brief		: Method to count the busy quarter hours
+ * \param		: NONE
+ * \return		: std::size_t - number of busy quarter hours
+ */
+std::size_t WeekOccupancy::getOccupiedSlots() const
+{
+	std::size_t occupied = 0;
+	for (std::uint64_t word: words)
+	{
+		occupied += __builtin_popcountll(word);
+	}
+	return occupied;
+}
+
+/**
+ * \brief		: Method to count the quarter hours busy in both bitmaps
+ * \param[IN]	: const WeekOccupancy &other - other bitmap
+ * \return		: std::size_t - number of common busy quarter hours
+ */
+std::size_t WeekOccupancy::countOverlap(const WeekOccupancy &other) const
+{
+	std::size_t overlap = 0;
+	for (std::size_t word = 0; word < wordCount; word++)
+	{
+		overlap += __builtin_popcountll(words[word] & other.words[word]);
+	}
+	return overlap;
+}
+
+/**
+ * \brief		: Getter method for the words of the bitmap
+ * \param		: NONE
+ * \return		: const std::array<std::uint64_t, wordCount>& - bit i of word i / 64 is quarter hour i
+ */
+const std::array<std::uint64_t, WeekOccupancy::wordCount>& WeekOccupancy::getWords() const
+{
+	return words;
+}
@@ -0,0 +1,97 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file WeekOccupancy.h
+ *	\brief Header file for WeekOccupancy class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef WEEKOCCUPANCY_H_
+#define WEEKOCCUPANCY_H_
+
+//! System Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+//! User Includes
+#include "Course.h"
+
+/**
+ * \brief		: Bitmap of the busy quarter hours of a week
+ * \details		: Bit i stands for the 15 minutes starting i * 15 minutes after Sunday 0:00,
+ *				  the 672 quarter hours of a week fit into 11 words. A course marks every
+ *				  quarter hour it touches, so 8:15 to 9:45 marks six of them. Overlaps are
+ *				  counted with a popcount of the AND of two bitmaps.
+ */
+class WeekOccupancy
+{
+public:
+
+	static constexpr unsigned int minutesPerSlot = 15;
+	static constexpr unsigned int slotsPerDay = 24 * 60 / minutesPerSlot;
+	static constexpr unsigned int slotCount = 7 * slotsPerDay;
+	static constexpr std::size_t wordCount = (slotCount + 63) / 64;
+
+private:
+
+	/**
+	 * \brief		: Bit i of word i / 64 is quarter hour i
+	 */
+	std::array<std::uint64_t, wordCount> words;
+
+public:
+
+	/**
+	 * \brief		: Constructor, all quarter hours free
+	 */
+	WeekOccupancy();
+
+	/**
+	 * \brief		: Method to mark the quarter hours touched by [begin, end)
+	 * \param[IN]	: unsigned int begin - first minute, counted from Sunday 0:00
+	 * \param[IN]	: unsigned int end - minute after the period, at most the end of the week
+	 * \return		: NONE
+	 */
+	void addMinutes(unsigned int begin, unsigned int end);
+
+	/**
+	 * \brief		: Method to mark the meeting times of a course
+	 * \param[IN]	: const Course &course - weekly or block course, a block course marks every weekday it covers
+	 * \return		: NONE
+	 */
+	void addCourse(const Course &course);
+
+	/**
+	 * \brief		: Method to check a quarter hour
+	 * \param[IN]	: unsigned int slot - quarter hour of the week, below slotCount
+	 * \return		: bool - true if it is busy
+	 */
+	bool isOccupied(unsigned int slot) const;
+
+	/**
+	 * \brief		: Method to count the busy quarter hours
+	 * \param		: NONE
+	 * \return		: std::size_t - number of busy quarter hours
+	 */
+	std::size_t getOccupiedSlots() const;
+
+	/**
+	 * \brief		: Method to count the quarter hours busy in both bitmaps
+	 * \param[IN]	: const WeekOccupancy &other - other bitmap
+	 * \return		: std::size_t - number of common busy quarter hours
+	 */
+	std::size_t countOverlap(const WeekOccupancy &other) const;
+
+	/**
+	 * \brief		: Getter method for the words of the bitmap
+	 * \param		: NONE
+	 * \return		: const std::array<std::uint64_t, wordCount>& - bit i of word i / 64 is quarter hour i
+	 */
+	const std::array<std::uint64_t, wordCount>& getWords() const;
+};
+
+#endif /* WEEKOCCUPANCY_H_ */
@@ -10,7 +10,7 @@
 /****************************************************************************/
 
 //! System Includes
-#include <iostream>
+#include <ostream>
 
 //! User Includes
 #include "WeeklyCourse.h"
@@ -25,19 +25,6 @@ WeeklyCourse::WeeklyCourse(unsigned int courseKey, std::string title, unsigned c
 				:Course(courseKey, title, major, creditPoints), dayOfWeek{dayOfWeek}, startTime{startTime}, endTime{endTime}
 				{}
 
-/**
- * \brief		: Virtual print method overridden on Course print method
- * \param		: NONE
- * \return		: NONE
- */
-void WeeklyCourse::print () const
-{
-	std::cout << "Course Key: " << courseKey << std::endl << "Title: " << title << std::endl << "Major: " << majorById[major]
-								<< std::endl << "Credit Points: " << creditPoints << std::endl
-								<< "Day of week - " << dayOfWeek << std::endl << "Timings - " << startTime.hour() << ":" << startTime.minute()
-								<< " to " << endTime.hour() << ":" << endTime.minute() << std::endl;
-}
-
 /**
  * \brief		: Virtual write method overridden on Course write method
  * \param		: std::ostream& out - output stream object
@@ -51,6 +38,47 @@ void WeeklyCourse::write(std::ostream &out) const
 							<< endTime.hour() << ":" << endTime.minute() << ";" << std::endl;
 }
 
+/**
+ * \brief		: Getter method for the day of the week
+ * \param		: NONE
+ * \return		: Poco::DateTime::DaysOfWeek - day of the week
+ */
+Poco::DateTime::DaysOfWeek WeeklyCourse::getDayOfWeek () const
+{
+	return dayOfWeek;
+}
+
+/**
+ * \brief		: Getter method for the start time
+ * \param		: NONE
+ * \return		: const Poco::Data::Time& - start time
+ */
+const Poco::Data::Time& WeeklyCourse::getStartTime () const
+{
+	return startTime;
+}
+
+/**
+ * \brief		: Getter method for the end time
+ * \param		: NONE
+ * \return		: const Poco::Data::Time& - end time
+ */
+const Poco::Data::Time& WeeklyCourse::getEndTime () const
+{
+	return endTime;
+}
+
+/**
+ * \brief		: Method to add the course object and its title to a memory report
+ * \param[IN]	: MemoryReport &report - report, gets them as COURSES
+ * \return		: NONE
+ */
+void WeeklyCourse::reportMemory(MemoryReport &report) const
+{
+	report.addBlock(MemoryReport::COURSES, sizeof(WeeklyCourse), sizeof(WeeklyCourse));
+	Course::reportMemory(report);
+}
+
 /*
  * \brief		: Destructor
  */
@@ -55,18 +55,39 @@ public:
 				Poco::DateTime::DaysOfWeek dayOfWeek, Poco::Data::Time startTime, Poco::Data::Time endTime);
 
 	/**
-	 * \brief		: Virtual print method overridden on Course print method
-	 * \param		: NONE
+	 * \brief		: Virtual write method overridden on Course write method
+	 * \param		: std::ostream& out - output stream object
 	 * \return		: NONE
 	 */
-	virtual void print () const override;
+	virtual void write (std::ostream& out) const override;
 
 	/**
-	 * \brief		: Virtual write method overridden on Course write method
-	 * \param		: std::ostream& out - output stream object
+	 * \brief		: Getter method for the day of the week
+	 * \param		: NONE
+	 * \return		: Poco::DateTime::DaysOfWeek - day of the week
+	 */
+	Poco::DateTime::DaysOfWeek getDayOfWeek () const;
+
+	/**
+	 * \brief		: Getter method for the start time
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Time& - start time
+	 */
+	const Poco::Data::Time& getStartTime () const;
+
+	/**
+	 * \brief		: Getter method for the end time
+	 * \param		: NONE
+	 * \return		: const Poco::Data::Time& - end time
+	 */
+	const Poco::Data::Time& getEndTime () const;
+
+	/**
+	 * \brief		: Method to add the course object and its title to a memory report
+	 * \param[IN]	: MemoryReport &report - report, gets them as COURSES
 	 * \return		: NONE
 	 */
-	virtual void write (std::ostream& out) const override;
+	virtual void reportMemory (MemoryReport &report) const override;
 
 	/*
 	 * \brief		: Destructor
@@ -9,15 +9,85 @@
  */
 /****************************************************************************/
 
+//! System includes
+#include <string>
+#include <memory>
+#include <vector>
+#include <thread>
+
 //! User includes
 #include "SimpleUI.h"
 #include "StudentDb.h"
+#include "StudentDbHttpServer.h"
+#include "ThreadPool.h"
 
-int main ()
+/**
+ * \brief		: Entry point
+ * \details		: Optional arguments select the student generator server,
+ *				  e.g. 'StudentDb localhost 4242' to import from a local generator.
+ *				  '--http port' additionally serves the database as REST resources.
+ *				  '--pool workers' runs name searches and exports on a thread pool of that
+ *				  size (0 = one per core), '--pin' pins its workers to one CPU each.
+ */
+int main (int argc, char *argv[])
 {
+	std::string serverHost = ServerImporter::defaultHost;
+	unsigned short serverPort = ServerImporter::defaultPort;
+	unsigned short httpPort {};
+	bool usePool = false;
+	unsigned int poolWorkers {};
+	bool pinWorkers = false;
+	std::vector<std::string> positional;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--http" && i + 1 < argc)
+		{
+			httpPort = static_cast<unsigned short>(std::stoi(argv[++i]));
+		}
+		else if (argument == "--pool" && i + 1 < argc)
+		{
+			usePool = true;
+			poolWorkers = std::stoul(argv[++i]);
+		}
+		else if (argument == "--pin")
+		{
+			pinWorkers = true;
+		}
+		else
+		{
+			positional.push_back(argument);
+		}
+	}
+
+	if (positional.size() > 0)
+	{
+		serverHost = positional.at(0);
+	}
+	if (positional.size() > 1)
+	{
+		serverPort = static_cast<unsigned short>(std::stoi(positional.at(1)));
+	}
+
+	//! Declared before the database, which uses it until it is destroyed
+	std::unique_ptr<ThreadPool> threadPool;
+	if (usePool)
+	{
+		threadPool.reset(new ThreadPool(poolWorkers, pinWorkers));
+	}
 
 	StudentDb studentDb;
-	SimpleUI simpleUI (studentDb);
+	studentDb.setThreadPool(threadPool.get());
+	SimpleUI simpleUI (studentDb, serverHost, serverPort);
+
+	//! REST front end alongside the console menu
+	std::unique_ptr<StudentDbHttpServer> httpServer;
+	if (httpPort != 0)
+	{
+		httpServer.reset(new StudentDbHttpServer(studentDb, httpPort, std::thread::hardware_concurrency()));
+		httpServer->start();
+	}
 
 	//! Run the student database UI
 	simpleUI.run();
@@ -0,0 +1,214 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file AnalyticsBenchmark.cpp
+ *	\brief Benchmark of the column grade analytics against a loop over the students
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+
+//! User includes
+#include "../GradeAnalytics.h"
+#include "../StudentDb.h"
+#include "../ThreadPool.h"
+#include "../WeeklyCourse.h"
+
+namespace
+{
+	const unsigned char majors[] = {'A', 'C', 'E', 'P'};
+	const float grades[] = {0.0f, 1.0f, 1.3f, 1.7f, 2.0f, 2.3f, 2.7f, 3.0f, 3.3f, 3.7f, 4.0f, 5.0f};
+
+	/**
+	 * \brief		: Fills the database with random courses, students and graded enrollments
+	 */
+	void fillDatabase(StudentDb &studentDb, unsigned int numberOfStudents, unsigned int numberOfCourses,
+					  unsigned int enrollmentsPerStudent)
+	{
+		std::mt19937 random(42);
+
+		for (unsigned int courseKey = 1; courseKey <= numberOfCourses; courseKey++)
+		{
+			studentDb.addWeeklyCourseToDb(WeeklyCourse(courseKey, "Course " + std::to_string(courseKey),
+									majors[courseKey % 4], static_cast<float>(2.5 * (1 + courseKey % 4)),
+									Poco::DateTime::MONDAY, Poco::Data::Time(8, 15, 0), Poco::Data::Time(9, 45, 0)));
+		}
+
+		for (unsigned int student = 0; student < numberOfStudents; student++)
+		{
+			Student newStudent("First" + std::to_string(student), "Last" + std::to_string(student),
+							   Poco::Data::Date(2000, 1, 1), Address("Street", 64283, "Darmstadt", ""));
+			studentDb.addStudentToDb(newStudent);
+			unsigned int matrikelNumber = newStudent.getMatrikelNumber();
+
+			//! Consecutive course keys from a random start, so no course is taken twice.
+			//! All courses meet at the same time, the clash check is not what is measured here.
+			unsigned int firstCourse = random() % numberOfCourses;
+			for (unsigned int enrollment = 0; enrollment < std::min(enrollmentsPerStudent, numberOfCourses); enrollment++)
+			{
+				unsigned int courseKey = 1 + (firstCourse + enrollment) % numberOfCourses;
+				std::string semester = (random() % 2 == 0 ? "SS" : "WS") + std::to_string(2015 + random() % 6);
+				if (studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, semester, true) == StudentDb::ENROLLED)
+				{
+					studentDb.updateStudentGradeInDb(matrikelNumber, courseKey, grades[random() % 12]);
+				}
+			}
+		}
+	}
+
+	/**
+	 * \brief		: Reference: totals and per major aggregates by walking every student
+	 */
+	GradeAggregate naiveAggregate(const StudentDb &studentDb, std::map<std::string, GradeAggregate> &byMajor)
+	{
+		GradeAggregate total;
+		for (const auto &eachStudent: studentDb.getStudents())
+		{
+			for (const Enrollment &enrollment: eachStudent.second.getEnrollments())
+			{
+				GradeAggregate row;
+				float grade = enrollment.getGrade();
+				row.enrollments = 1;
+				if (grade > 0)
+				{
+					row.graded = 1;
+					row.passed = grade >= 1.0f && grade <= 4.0f;
+					row.weightedGradeSum = grade * enrollment.getCourse().getCreditPoints();
+					row.gradedCredits = enrollment.getCourse().getCreditPoints();
+				}
+				total.merge(row);
+				byMajor[enrollment.getCourse().getMajorName()].merge(row);
+			}
+		}
+		return total;
+	}
+
+	bool sameAggregate(const GradeAggregate &left, const GradeAggregate &right)
+	{
+		return left.enrollments == right.enrollments && left.graded == right.graded && left.passed == right.passed
+			&& std::fabs(left.getWeightedAverage() - right.getWeightedAverage()) < 1e-6;
+	}
+
+	template <typename Function>
+	double secondsOf(Function function)
+	{
+		auto start = std::chrono::steady_clock::now();
+		function();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count();
+	}
+}
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: AnalyticsBenchmark [--students N] [--courses N] [--enrollments perStudent]
+ *				  [--threads N] [--pin true]
+ *				  Times the totals and the per major aggregates once by walking every student
+ *				  and once over the columns of GradeAnalytics, on the calling thread and on
+ *				  thread pools of 1 to --threads workers (0 = one per core), optionally pinned.
+ *				  The result, including the scaling curve, is printed as one JSON object.
+ */
+int main (int argc, char *argv[])
+{
+	unsigned int numberOfStudents = 200000;
+	unsigned int numberOfCourses = 500;
+	unsigned int enrollmentsPerStudent = 10;
+	unsigned int threads = 0;
+	bool pinWorkers = false;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--students")				numberOfStudents = std::stoul(value);
+		else if (option == "--courses")			numberOfCourses = std::stoul(value);
+		else if (option == "--enrollments")		enrollmentsPerStudent = std::stoul(value);
+		else if (option == "--threads")			threads = std::stoul(value);
+		else if (option == "--pin")				pinWorkers = (value == "true");
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	StudentDb studentDb;
+	fillDatabase(studentDb, numberOfStudents, numberOfCourses, enrollmentsPerStudent);
+
+	GradeAggregate naiveTotal;
+	std::map<std::string, GradeAggregate> naiveByMajor;
+	double naiveSeconds = secondsOf([&]() { naiveTotal = naiveAggregate(studentDb, naiveByMajor); });
+
+	GradeAnalytics analytics;
+	double extractSeconds = secondsOf([&]() { analytics.extract(studentDb); });
+
+	GradeAggregate columnTotal;
+	std::map<std::string, GradeAggregate> columnByMajor;
+	double columnSeconds = secondsOf([&]()
+	{
+		columnTotal = analytics.total();
+		columnByMajor = analytics.groupBy(GradeAnalytics::MAJOR);
+	});
+
+	bool agree = sameAggregate(naiveTotal, columnTotal) && naiveByMajor.size() == columnByMajor.size();
+	for (const auto &group: naiveByMajor)
+	{
+		agree = agree && sameAggregate(group.second, columnByMajor[group.first]);
+	}
+
+	//! Same work on pools of growing size, each call leaves its timing in the pool
+	std::ostringstream scaling;
+	unsigned int maxWorkers = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+	for (unsigned int workers = 1; workers <= maxWorkers; workers++)
+	{
+		ThreadPool threadPool(workers, pinWorkers);
+		GradeAggregate poolTotal;
+		std::map<std::string, GradeAggregate> poolByMajor;
+		double seconds = secondsOf([&]()
+		{
+			poolTotal = analytics.total(&threadPool);
+			poolByMajor = analytics.groupBy(GradeAnalytics::MAJOR, &threadPool);
+		});
+
+		agree = agree && sameAggregate(naiveTotal, poolTotal) && poolByMajor.size() == naiveByMajor.size();
+		for (const auto &group: naiveByMajor)
+		{
+			agree = agree && sameAggregate(group.second, poolByMajor[group.first]);
+		}
+
+		double busySeconds = 0;
+		std::size_t stolenRanges = 0;
+		for (const TaskTiming &timing: threadPool.getTimings())
+		{
+			busySeconds += timing.busySeconds;
+			stolenRanges += timing.stolenRanges;
+		}
+		scaling << (workers > 1 ? "," : "") << "{\"workers\":" << workers << ",\"seconds\":" << seconds
+				<< ",\"busySeconds\":" << busySeconds << ",\"stolenRanges\":" << stolenRanges << "}";
+	}
+
+	std::cout << "{\"enrollments\":" << analytics.getRowCount()
+			  << ",\"naiveSeconds\":" << naiveSeconds
+			  << ",\"extractSeconds\":" << extractSeconds
+			  << ",\"columnSeconds\":" << columnSeconds
+			  << ",\"scaling\":[" << scaling.str() << "]"
+			  << ",\"weightedAverage\":" << columnTotal.getWeightedAverage()
+			  << ",\"passRate\":" << columnTotal.getPassRate()
+			  << ",\"agree\":" << (agree ? "true" : "false")
+			  << "}" << std::endl;
+
+	return agree ? 0 : 1;
+}
@@ -0,0 +1,661 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file DatasetGenerator.cpp
+ *	\brief Generator of large synthetic databases in the file format of StudentDb::read
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+//! User includes
+#include "../ThreadPool.h"
+
+namespace
+{
+	//! Students per block, every block has random streams of its own so the output
+	//! does not depend on the number of threads
+	const std::size_t studentsPerBlock = 16384;
+
+	const unsigned int firstMatrikelNumber = 100000;
+	const unsigned int firstCourseKey = 1000;
+
+	/**
+	 * \brief		: Value of a table drawn with a relative weight
+	 */
+	struct Weighted
+	{
+		const char *value;
+		double weight;
+	};
+
+	/**
+	 * \brief		: City with the range of its postal codes
+	 * \details		: Address keeps the postal code in an unsigned short, so only the postal
+	 *				  regions 0 to 6 (codes below 65536) are used. Weights are the populations
+	 *				  in thousands.
+	 */
+	struct City
+	{
+		const char *name;
+		unsigned int firstPostalCode;
+		unsigned int lastPostalCode;
+		double weight;
+	};
+
+	const City cities[] = {
+		{"Berlin", 10115, 14199, 3650}, {"Hamburg", 20095, 22769, 1850}, {"Köln", 50667, 51149, 1085},
+		{"Frankfurt am Main", 60306, 60599, 760}, {"Düsseldorf", 40210, 40629, 620}, {"Leipzig", 4103, 4357, 600},
+		{"Dortmund", 44135, 44388, 590}, {"Essen", 45127, 45359, 580}, {"Bremen", 28195, 28779, 565},
+		{"Dresden", 1067, 1328, 555}, {"Hannover", 30159, 30669, 535}, {"Duisburg", 47051, 47279, 500},
+		{"Bochum", 44787, 44894, 365}, {"Wuppertal", 42103, 42399, 355}, {"Bielefeld", 33602, 33739, 335},
+		{"Bonn", 53111, 53229, 330}, {"Münster", 48143, 48167, 315}, {"Wiesbaden", 65183, 65207, 278},
+		{"Aachen", 52062, 52080, 250}, {"Braunschweig", 38100, 38126, 250}, {"Kiel", 24103, 24159, 245},
+		{"Halle (Saale)", 6108, 6132, 238}, {"Magdeburg", 39104, 39130, 237}, {"Mainz", 55116, 55131, 218},
+		{"Lübeck", 23552, 23570, 217}, {"Rostock", 18055, 18147, 209}, {"Kassel", 34117, 34134, 201},
+		{"Potsdam", 14467, 14482, 183}, {"Osnabrück", 49074, 49090, 165}, {"Darmstadt", 64283, 64297, 160},
+		{"Offenbach am Main", 63065, 63075, 130}, {"Gießen", 35390, 35398, 90}, {"Marburg", 35037, 35043, 77}};
+
+	const Weighted lastNames[] = {
+		{"Müller", 256}, {"Schmidt", 190}, {"Schneider", 115}, {"Fischer", 97}, {"Weber", 86}, {"Meyer", 84},
+		{"Wagner", 79}, {"Becker", 75}, {"Schulz", 73}, {"Hoffmann", 72}, {"Schäfer", 62}, {"Koch", 60},
+		{"Bauer", 59}, {"Richter", 58}, {"Klein", 57}, {"Wolf", 55}, {"Schröder", 54}, {"Neumann", 53},
+		{"Schwarz", 52}, {"Zimmermann", 51}, {"Braun", 50}, {"Krüger", 49}, {"Hofmann", 49}, {"Hartmann", 48},
+		{"Lange", 47}, {"Schmitt", 46}, {"Werner", 46}, {"Schmitz", 45}, {"Krause", 45}, {"Meier", 44},
+		{"Lehmann", 44}, {"Schmid", 43}, {"Schulze", 42}, {"Maier", 42}, {"Köhler", 41}, {"Herrmann", 41},
+		{"König", 40}, {"Walter", 40}, {"Mayer", 39}, {"Huber", 39}, {"Kaiser", 38}, {"Fuchs", 38},
+		{"Peters", 37}, {"Lang", 37}, {"Scholz", 37}, {"Möller", 36}, {"Weiß", 36}, {"Jung", 35},
+		{"Hahn", 35}, {"Schubert", 34}, {"Yılmaz", 30}, {"Kaya", 20}, {"Nowak", 18}, {"Kowalski", 15},
+		{"Stein", 12}, {"Olsen", 5}, {"Prakash", 5}};
+
+	const Weighted firstNames[] = {
+		{"Lukas", 60}, {"Leon", 55}, {"Jonas", 52}, {"Finn", 45}, {"Paul", 44}, {"Felix", 42}, {"Maximilian", 40},
+		{"Tim", 38}, {"Niklas", 37}, {"Jan", 36}, {"Luca", 34}, {"Julian", 33}, {"Moritz", 30}, {"David", 29},
+		{"Elias", 27}, {"Tobias", 26}, {"Simon", 25}, {"Florian", 24}, {"Alexander", 24}, {"Philipp", 23},
+		{"Mehmet", 12}, {"Ahmet", 8}, {"Peter", 6},
+		{"Anna", 58}, {"Lea", 54}, {"Laura", 50}, {"Lena", 48}, {"Sarah", 44}, {"Julia", 43}, {"Hannah", 42},
+		{"Lisa", 40}, {"Leonie", 38}, {"Marie", 37}, {"Sophie", 35}, {"Katharina", 33}, {"Johanna", 31},
+		{"Lara", 30}, {"Emily", 28}, {"Mia", 27}, {"Jana", 25}, {"Vanessa", 22}, {"Aylin", 12}, {"Elif", 10},
+		{"Josephine", 8}, {"Aditi", 4}};
+
+	const Weighted streets[] = {
+		{"Hauptstraße", 40}, {"Schulstraße", 30}, {"Gartenstraße", 28}, {"Bahnhofstraße", 27}, {"Dorfstraße", 25},
+		{"Bergstraße", 22}, {"Birkenweg", 20}, {"Lindenstraße", 20}, {"Kirchstraße", 19}, {"Waldstraße", 18},
+		{"Ringstraße", 17}, {"Schillerstraße", 17}, {"Goethestraße", 16}, {"Jahnstraße", 14}, {"Wiesenweg", 13},
+		{"Am Sportplatz", 12}, {"Tannenweg", 12}, {"Mozartstraße", 11}, {"Rosenweg", 10}, {"Riedeselstraße", 4}};
+
+	const Weighted additionalInfos[] = {
+		{"", 85}, {"Apartment 2a", 3}, {"Apartment 4b", 3}, {"WG 3", 3}, {"Zimmer 12", 2}, {"Hinterhaus", 2},
+		{"c/o Müller", 2}};
+
+	//! Grades as StudentDb::write prints them, 0 for an enrollment without a grade
+	const Weighted grades[] = {
+		{"0", 20}, {"1", 6}, {"1.3", 8}, {"1.7", 10}, {"2", 12}, {"2.3", 12}, {"2.7", 11}, {"3", 10},
+		{"3.3", 8}, {"3.7", 6}, {"4", 5}, {"5", 6}};
+
+	const char *const semesters[] = {"SS2015", "WS2015", "SS2016", "WS2016", "SS2017", "WS2017",
+									 "SS2018", "WS2018", "SS2019", "WS2019", "SS2020", "WS2020"};
+
+	const char *const majorNames[] = {"Automation", "Communication", "Embedded", "Power"};
+	const char *const subjects[4][5] = {
+		{"Control Engineering", "Robotics", "PLC Programming", "Process Automation", "Sensors and Actuators"},
+		{"Digital Communications", "Signals and Systems", "Mobile Networks", "Antenna Design", "Information Theory"},
+		{"Embedded Systems", "Microcontrollers", "Real-Time Operating Systems", "VLSI Design", "Object Oriented Programming"},
+		{"Power Electronics", "Electrical Machines", "Renewable Energy", "High Voltage Engineering", "Power Systems"}};
+
+	//! Lecture slots of a day, start and end in minutes after midnight
+	const unsigned int lectureSlots[][2] = {{495, 585}, {600, 690}, {705, 795}, {855, 945}, {960, 1050}, {1065, 1155}};
+	const unsigned int creditPoints[] = {3, 5, 5, 6, 8, 10};
+
+	/**
+	 * \brief		: Independent random streams of a block
+	 */
+	enum Stream
+	{
+		STUDENT_STREAM,
+		FANOUT_STREAM,
+		ENROLLMENT_STREAM,
+		COURSE_STREAM
+	};
+
+	/**
+	 * \brief		: SplitMix64 generator, the same numbers on every platform
+	 */
+	class Random
+	{
+	private:
+
+		std::uint64_t state;
+
+		static std::uint64_t mix(std::uint64_t value)
+		{
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+			return value ^ (value >> 31);
+		}
+
+	public:
+
+		Random(std::uint64_t seed, std::uint64_t block, Stream stream)
+			: state{mix(seed + 0x9E3779B97F4A7C15ULL * (block * 4 + stream + 1))}
+		{}
+
+		std::uint64_t next()
+		{
+			state += 0x9E3779B97F4A7C15ULL;
+			return mix(state);
+		}
+
+		//! Uniform in [0, bound)
+		std::uint64_t below(std::uint64_t bound)
+		{
+			return static_cast<std::uint64_t>((static_cast<unsigned __int128>(next()) * bound) >> 64);
+		}
+
+		//! Uniform in [0, 1)
+		double unit()
+		{
+			return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+		}
+	};
+
+	/**
+	 * \brief		: Draws indexes of a table by their weights with Walker's alias method
+	 * \details		: Every index keeps its own share of a uniform slot and hands the rest of the
+	 *				  slot to one alias, so a draw is a uniform index and one comparison
+	 */
+	class WeightedChoice
+	{
+	private:
+
+		std::vector<double> shares;
+		std::vector<std::uint32_t> aliases;
+
+		void build(std::vector<double> weights)
+		{
+			double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+			std::vector<std::uint32_t> small, large;
+			shares.assign(weights.size(), 1);
+			aliases.resize(weights.size());
+
+			for (std::uint32_t index = 0; index < weights.size(); index++)
+			{
+				aliases[index] = index;
+				weights[index] *= weights.size() / total;
+				(weights[index] < 1 ? small : large).push_back(index);
+			}
+			while (!small.empty() && !large.empty())
+			{
+				std::uint32_t lean = small.back(), rich = large.back();
+				small.pop_back();
+				shares[lean] = weights[lean];
+				aliases[lean] = rich;
+				weights[rich] -= 1 - weights[lean];
+				if (weights[rich] < 1)
+				{
+					large.pop_back();
+					small.push_back(rich);
+				}
+			}
+		}
+
+	public:
+
+		template <typename Entry, std::size_t size, typename Weight>
+		WeightedChoice(const Entry (&entries)[size], Weight weightOf)
+		{
+			std::vector<double> weights;
+			for (const Entry &entry: entries)
+			{
+				weights.push_back(weightOf(entry));
+			}
+			build(weights);
+		}
+
+		explicit WeightedChoice(const std::vector<double> &weights)
+		{
+			build(weights);
+		}
+
+		std::size_t draw(Random &random) const
+		{
+			std::size_t index = random.below(shares.size());
+			return random.unit() < shares[index] ? index : aliases[index];
+		}
+	};
+
+	void append(std::string &text, std::uint64_t number)
+	{
+		char digits[20];
+		text.append(digits, std::to_chars(digits, digits + sizeof digits, number).ptr);
+	}
+
+	void appendTime(std::string &text, unsigned int minutes)
+	{
+		append(text, minutes / 60);
+		text += ':';
+		append(text, minutes % 60);
+	}
+
+	void appendDate(std::string &text, unsigned int day, unsigned int month, unsigned int year)
+	{
+		append(text, day);
+		text += '.';
+		append(text, month);
+		text += '.';
+		append(text, year);
+	}
+
+	unsigned int daysInMonth(unsigned int month, unsigned int year)
+	{
+		static const unsigned int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+		bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+		return month == 2 && leapYear ? 29 : days[month - 1];
+	}
+
+	/**
+	 * \brief		: Generator of the three sections of the file
+	 * \details		: Block b holds the students b * studentsPerBlock onwards. The number of
+	 *				  enrollments of every student comes from the fan-out stream of its block,
+	 *				  so it is drawn once to count the enrollments for the header of their
+	 *				  section and drawn again when they are written, without keeping them.
+	 */
+	class DatasetGenerator
+	{
+	private:
+
+		std::uint64_t seed;
+		std::uint64_t numberOfStudents;
+		unsigned int numberOfCourses;
+		double meanEnrollments;
+		unsigned int maxEnrollments;
+
+		WeightedChoice cityChoice, lastNameChoice, firstNameChoice, streetChoice, additionalInfoChoice, gradeChoice;
+
+		//! Zipf distributed popularity of the courses in a random order, a few courses get most enrollments
+		WeightedChoice courseChoice;
+
+		//! Fields of the enrollment lines with their separators, formatted once
+		std::vector<std::string> courseFields, semesterFields, gradeFields;
+
+		static std::vector<double> getCoursePopularity(std::uint64_t seed, unsigned int numberOfCourses)
+		{
+			Random random(seed, 0, COURSE_STREAM);
+			std::vector<double> popularity(numberOfCourses);
+			for (std::size_t course = 0; course < popularity.size(); course++)
+			{
+				popularity[course] = 1.0 / static_cast<double>(course + 1);
+			}
+			for (std::size_t course = popularity.size(); course > 1; course--)
+			{
+				std::swap(popularity[course - 1], popularity[random.below(course)]);
+			}
+			return popularity;
+		}
+
+		std::size_t getBlockStudents(std::size_t block) const
+		{
+			return std::min<std::uint64_t>(studentsPerBlock, numberOfStudents - block * studentsPerBlock);
+		}
+
+		//! Geometric number of enrollments, most students take a few courses and some many
+		unsigned int drawEnrollmentCount(Random &fanout) const
+		{
+			unsigned int count = 0;
+			double stop = 1 / (meanEnrollments + 1);
+			while (count < maxEnrollments && fanout.unit() >= stop)
+			{
+				count++;
+			}
+			return count;
+		}
+
+	public:
+
+		DatasetGenerator(std::uint64_t seed, std::uint64_t numberOfStudents, unsigned int numberOfCourses,
+						 double meanEnrollments)
+			: seed{seed}, numberOfStudents{numberOfStudents}, numberOfCourses{numberOfCourses},
+			  meanEnrollments{meanEnrollments}, maxEnrollments{std::max(1u, std::min(numberOfCourses / 2, 60u))},
+			  cityChoice{cities, [](const City &city) { return city.weight; }},
+			  lastNameChoice{lastNames, [](const Weighted &entry) { return entry.weight; }},
+			  firstNameChoice{firstNames, [](const Weighted &entry) { return entry.weight; }},
+			  streetChoice{streets, [](const Weighted &entry) { return entry.weight; }},
+			  additionalInfoChoice{additionalInfos, [](const Weighted &entry) { return entry.weight; }},
+			  gradeChoice{grades, [](const Weighted &entry) { return entry.weight; }},
+			  courseChoice{getCoursePopularity(seed, numberOfCourses)}
+		{
+			for (unsigned int course = 0; course < numberOfCourses; course++)
+			{
+				courseFields.push_back(std::to_string(firstCourseKey + course) + ";");
+			}
+			for (const char *semester: semesters)
+			{
+				semesterFields.push_back(std::string(semester) + ";");
+			}
+			for (const Weighted &grade: grades)
+			{
+				gradeFields.push_back(std::string(grade.value) + "\n");
+			}
+		}
+
+		std::size_t getBlockCount() const
+		{
+			return (numberOfStudents + studentsPerBlock - 1) / studentsPerBlock;
+		}
+
+		/**
+		 * \brief		: Course section: count line, then weekly (four in five) and block courses
+		 */
+		void writeCourses(std::string &text) const
+		{
+			Random random(seed, 1, COURSE_STREAM);
+			append(text, numberOfCourses);
+			text += '\n';
+
+			for (unsigned int course = 0; course < numberOfCourses; course++)
+			{
+				unsigned int major = random.below(4);
+				bool block = random.below(5) == 0;
+				const unsigned int *slot = lectureSlots[random.below(6)];
+
+				text += block ? "B;" : "W;";
+				append(text, firstCourseKey + course);
+				text += ';';
+				text += subjects[major][random.below(5)];
+				text += ' ';
+				append(text, 1 + course / 20);
+				text += ';';
+				text += majorNames[major];
+				text += ';';
+				append(text, creditPoints[random.below(6)]);
+				text += ';';
+
+				if (block)
+				{
+					//! One or two weeks within a month, from 9:00 until 16:00 or shorter
+					unsigned int year = 2015 + random.below(6);
+					unsigned int month = 1 + random.below(12);
+					unsigned int firstDay = 1 + random.below(14);
+					appendDate(text, firstDay, month, year);
+					text += ';';
+					appendDate(text, firstDay + random.below(14), month, year);
+					text += ';';
+					appendTime(text, 540);
+					text += ';';
+					appendTime(text, 540 + 60 * (3 + random.below(5)));
+					text += '\n';
+				}
+				else
+				{
+					append(text, 1 + random.below(5));
+					text += ';';
+					appendTime(text, slot[0]);
+					text += ';';
+					appendTime(text, slot[1]);
+					text += ";\n";
+				}
+			}
+		}
+
+		/**
+		 * \brief		: Number of enrollments of the students of a block
+		 */
+		std::uint64_t countEnrollments(std::size_t block) const
+		{
+			Random fanout(seed, block, FANOUT_STREAM);
+			std::uint64_t count = 0;
+			for (std::size_t student = 0; student < getBlockStudents(block); student++)
+			{
+				count += drawEnrollmentCount(fanout);
+			}
+			return count;
+		}
+
+		/**
+		 * \brief		: Student lines of a block
+		 */
+		void writeStudents(std::size_t block, std::string &text) const
+		{
+			Random random(seed, block, STUDENT_STREAM);
+			std::uint64_t matrikelNumber = firstMatrikelNumber + block * studentsPerBlock;
+
+			for (std::size_t student = 0; student < getBlockStudents(block); student++, matrikelNumber++)
+			{
+				const City &city = cities[cityChoice.draw(random)];
+				unsigned int year = 1988 + random.below(15);
+				unsigned int month = 1 + random.below(12);
+
+				append(text, matrikelNumber);
+				text += ';';
+				text += lastNames[lastNameChoice.draw(random)].value;
+				text += ';';
+				text += firstNames[firstNameChoice.draw(random)].value;
+				text += ';';
+				appendDate(text, 1 + random.below(daysInMonth(month, year)), month, year);
+				text += ';';
+				text += streets[streetChoice.draw(random)].value;
+				text += ' ';
+				append(text, 1 + random.below(random.below(4) == 0 ? 150 : 40));
+				text += ';';
+				append(text, city.firstPostalCode + random.below(city.lastPostalCode - city.firstPostalCode + 1));
+				text += ';';
+				text += city.name;
+				text += ';';
+				text += additionalInfos[additionalInfoChoice.draw(random)].value;
+				text += ";\n";
+			}
+		}
+
+		/**
+		 * \brief		: Enrollment lines of a block, no student takes a course twice
+		 */
+		void writeEnrollments(std::size_t block, std::string &text) const
+		{
+			Random fanout(seed, block, FANOUT_STREAM);
+			Random random(seed, block, ENROLLMENT_STREAM);
+			std::uint64_t matrikelNumber = firstMatrikelNumber + block * studentsPerBlock;
+			std::vector<unsigned int> taken;
+
+			for (std::size_t student = 0; student < getBlockStudents(block); student++, matrikelNumber++)
+			{
+				unsigned int count = drawEnrollmentCount(fanout);
+				taken.clear();
+
+				char prefix[24];
+				char *prefixEnd = std::to_chars(prefix, prefix + sizeof prefix - 1, matrikelNumber).ptr;
+				*prefixEnd++ = ';';
+
+				for (unsigned int enrollment = 0; enrollment < count; enrollment++)
+				{
+					//! Draw again on a course already taken, then take the next free one
+					unsigned int course = courseChoice.draw(random);
+					for (unsigned int attempt = 0; std::find(taken.begin(), taken.end(), course) != taken.end(); attempt++)
+					{
+						course = attempt < 32 ? courseChoice.draw(random) : (course + 1) % numberOfCourses;
+					}
+					taken.push_back(course);
+
+					text.append(prefix, prefixEnd);
+					text += courseFields[course];
+					text += semesterFields[random.below(12)];
+					text += gradeFields[gradeChoice.draw(random)];
+				}
+			}
+		}
+	};
+
+	/**
+	 * \brief		: Generates the blocks in batches on the pool and writes every batch in block order
+	 * \details		: A batch is written on a thread of its own while the pool generates the next one
+	 */
+	template <typename Function>
+	std::uint64_t writeBlocks(ThreadPool &threadPool, const std::string &name, std::size_t blockCount,
+							  std::ostream &out, Function writeBlock)
+	{
+		std::size_t batchSize = (threadPool.getWorkerCount() + 1) * 2;
+		std::vector<std::string> batches[2] = {std::vector<std::string>(batchSize), std::vector<std::string>(batchSize)};
+		std::future<void> writing;
+		std::uint64_t bytes = 0;
+
+		for (std::size_t firstBlock = 0, batch = 0; firstBlock < blockCount; firstBlock += batchSize, batch ^= 1)
+		{
+			std::vector<std::string> &texts = batches[batch];
+			std::size_t endBlock = std::min(blockCount, firstBlock + batchSize);
+			threadPool.parallelFor(name, firstBlock, endBlock, 1, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t block = begin; block < end; block++)
+				{
+					std::string &text = texts[block - firstBlock];
+					text.clear();
+					writeBlock(block, text);
+				}
+			});
+
+			if (writing.valid())
+			{
+				writing.get();
+			}
+			for (std::size_t block = 0; block < endBlock - firstBlock; block++)
+			{
+				bytes += texts[block].size();
+			}
+			writing = std::async(std::launch::async, [&texts, &out, count = endBlock - firstBlock]()
+			{
+				for (std::size_t block = 0; block < count; block++)
+				{
+					out.write(texts[block].data(), texts[block].size());
+				}
+			});
+		}
+
+		if (writing.valid())
+		{
+			writing.get();
+		}
+		return bytes;
+	}
+}
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: DatasetGenerator [--students N] [--courses N] [--enrollments meanPerStudent]
+ *				  [--seed S] [--threads N] [--out file]
+ *				  Writes a database in the format of StudentDb::read, to standard output
+ *				  without --out. The same seed and sizes give the same file for any number
+ *				  of threads (0 = one per core). A JSON summary goes to standard output,
+ *				  or to standard error if the database does.
+ */
+int main (int argc, char *argv[])
+{
+	std::uint64_t numberOfStudents = 100000;
+	unsigned int numberOfCourses = 500;
+	double meanEnrollments = 5;
+	std::uint64_t seed = 1;
+	unsigned int threads = 0;
+	std::string fileName;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--students")				numberOfStudents = std::stoull(value);
+		else if (option == "--courses")			numberOfCourses = std::stoul(value);
+		else if (option == "--enrollments")		meanEnrollments = std::stod(value);
+		else if (option == "--seed")			seed = std::stoull(value);
+		else if (option == "--threads")			threads = std::stoul(value);
+		else if (option == "--out")				fileName = value;
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	//! read() parses matrikel numbers with stoi
+	if (numberOfCourses == 0 || meanEnrollments < 0
+		|| numberOfStudents > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) - firstMatrikelNumber)
+	{
+		std::cerr << "Invalid sizes" << std::endl;
+		return 1;
+	}
+
+	std::ofstream file;
+	if (!fileName.empty())
+	{
+		file.open(fileName, std::ios::binary);
+		if (!file)
+		{
+			std::cerr << "Cannot open " << fileName << std::endl;
+			return 1;
+		}
+	}
+	std::ios::sync_with_stdio(false);
+	std::ostream &out = fileName.empty() ? std::cout : file;
+	std::ostream &summary = fileName.empty() ? std::cerr : std::cout;
+
+	auto start = std::chrono::steady_clock::now();
+	DatasetGenerator generator(seed, numberOfStudents, numberOfCourses, meanEnrollments);
+	ThreadPool threadPool(threads);
+
+	std::string text;
+	generator.writeCourses(text);
+	append(text, numberOfStudents);
+	text += '\n';
+	out.write(text.data(), text.size());
+	std::uint64_t bytes = text.size();
+
+	bytes += writeBlocks(threadPool, "students", generator.getBlockCount(), out, [&](std::size_t block, std::string &blockText)
+	{
+		generator.writeStudents(block, blockText);
+	});
+
+	std::vector<std::uint64_t> enrollmentCounts(generator.getBlockCount());
+	threadPool.parallelFor("count", 0, enrollmentCounts.size(), 1, [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t block = begin; block < end; block++)
+		{
+			enrollmentCounts[block] = generator.countEnrollments(block);
+		}
+	});
+	std::uint64_t numberOfEnrollments = std::accumulate(enrollmentCounts.begin(), enrollmentCounts.end(), std::uint64_t{0});
+
+	text.clear();
+	append(text, numberOfEnrollments);
+	text += '\n';
+	out.write(text.data(), text.size());
+	bytes += text.size();
+
+	bytes += writeBlocks(threadPool, "enrollments", generator.getBlockCount(), out, [&](std::size_t block, std::string &blockText)
+	{
+		generator.writeEnrollments(block, blockText);
+	});
+
+	out.flush();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	summary << "{\"courses\":" << numberOfCourses
+			<< ",\"students\":" << numberOfStudents
+			<< ",\"enrollments\":" << numberOfEnrollments
+			<< ",\"bytes\":" << bytes
+			<< ",\"seconds\":" << elapsed.count()
+			<< ",\"megabytesPerSecond\":" << (elapsed.count() > 0 ? bytes / 1e6 / elapsed.count() : 0)
+			<< ",\"ok\":" << (out ? "true" : "false")
+			<< "}" << std::endl;
+
+	return out ? 0 : 1;
+}
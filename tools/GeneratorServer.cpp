@@ -0,0 +1,227 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file GeneratorServer.cpp
+ *	\brief Source file for GeneratorServer class
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System Includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/SocketStream.h>
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+
+//! User Includes
+#include "GeneratorServer.h"
+
+namespace
+{
+	//! Sample data for the random students
+	const char *firstNames[] = {"Aditi", "Peter", "Josephine", "Josefine", "Jürgen", "Anna", "Lukas", "Marie",
+								"Jonas", "Sophie", "Felix", "Lea", "Maximilian", "Hannah", "Paul", "Emilia"};
+
+	const char *lastNames[] = {"Müller", "Schmidt", "Schneider", "Fischer", "Meyer", "Meier", "Maier", "Weber",
+								"Wagner", "Becker", "Schulz", "Hoffmann", "Koch", "Stein", "Olsen", "Prakash"};
+
+	const char *streets[] = {"Hauptstrasse", "Schulstrasse", "Tannenweg", "Riedeselstrasse", "Bahnhofstrasse",
+							 "Gartenstrasse", "Dorfstrasse", "Lindenallee"};
+
+	//! City, state and postal code, kept within the range of Address::postalCode
+	struct City
+	{
+		const char *name;
+		const char *state;
+		unsigned short postalCode;
+	};
+
+	const City cities[] = {{"Darmstadt", "Hessen", 64285}, {"Frankfurt", "Hessen", 60311},
+						   {"Berlin", "Berlin", 10115}, {"Hamburg", "Hamburg", 20095},
+						   {"Köln", "Nordrhein-Westfalen", 50667}, {"Dresden", "Sachsen", 1067},
+						   {"Delitzsch", "Sachsen", 4509}, {"Hannover", "Niedersachsen", 30159},
+						   {"Mainz", "Rheinland-Pfalz", 55116}, {"Bremen", "Bremen", 28195}};
+
+	template <typename T, size_t N>
+	const T& pick(const T (&values)[N], std::mt19937 &random)
+	{
+		return values[std::uniform_int_distribution<size_t>(0, N - 1)(random)];
+	}
+
+	/**
+	 * \brief		: Serves the generator protocol on one connection
+	 */
+	class GeneratorConnection : public Poco::Net::TCPServerConnection
+	{
+	private:
+		const GeneratorServerConfig &config;
+		std::mt19937 random;
+
+		void writeRecord(std::ostream &out)
+		{
+			const City &city = pick(cities, random);
+			bool invalidPostalCode = config.invalidPostalCodeRate > 0
+					&& std::uniform_real_distribution<double>(0, 1)(random) < config.invalidPostalCodeRate;
+
+			out << "{\"name\":{\"firstName\":\"" << pick(firstNames, random)
+				<< "\",\"lastName\":\"" << pick(lastNames, random) << "\"},"
+				<< "\"dateOfBirth\":{\"year\":" << std::uniform_int_distribution<int>(1985, 2003)(random)
+				<< ",\"month\":" << std::uniform_int_distribution<int>(1, 12)(random)
+				<< ",\"date\":" << std::uniform_int_distribution<int>(1, 28)(random) << "},"
+				<< "\"location\":{\"street\":\"" << std::uniform_int_distribution<int>(1, 200)(random)
+				<< " " << pick(streets, random) << "\",\"postCode\":";
+
+			if (invalidPostalCode)
+			{
+				out << "\"D-" << city.postalCode << "\"";
+			}
+			else
+			{
+				out << city.postalCode;
+			}
+
+			out << ",\"city\":\"" << city.name << "\",\"state\":\"" << city.state << "\"}}\n";
+		}
+
+	public:
+		GeneratorConnection(const Poco::Net::StreamSocket &socket, const GeneratorServerConfig &config, unsigned int seed)
+			: Poco::Net::TCPServerConnection(socket), config{config}, random{seed}
+		{}
+
+		void run() override
+		{
+			Poco::Net::SocketStream stream(socket());
+			std::string command;
+
+			auto interval = std::chrono::nanoseconds::zero();
+			if (config.recordsPerSecond > 0)
+			{
+				interval = std::chrono::nanoseconds(static_cast<long long>(1e9 / config.recordsPerSecond));
+			}
+			auto nextSend = std::chrono::steady_clock::now();
+
+			while (getline(stream, command))
+			{
+				if (!command.empty() && command.back() == '\r')
+				{
+					command.pop_back();
+				}
+
+				if (command == "generate")
+				{
+					if (config.latencyMs > 0)
+					{
+						std::this_thread::sleep_for(std::chrono::milliseconds(config.latencyMs));
+					}
+					if (interval.count() > 0)
+					{
+						std::this_thread::sleep_until(nextSend);
+						nextSend = std::max(nextSend + interval, std::chrono::steady_clock::now());
+					}
+
+					writeRecord(stream);
+					if (!config.keepAlive)
+					{
+						break;
+					}
+
+					//! Pipelined commands are answered in one go, flush once the input is drained
+					if (stream.rdbuf()->in_avail() <= 0)
+					{
+						stream.flush();
+					}
+				}
+				else if (command == "quit")
+				{
+					break;
+				}
+			}
+			stream.flush();
+		}
+	};
+
+	/**
+	 * \brief		: Creates a connection handler with its own random seed
+	 */
+	class GeneratorConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+	{
+	private:
+		const GeneratorServerConfig &config;
+		std::atomic<unsigned int> connections;
+
+	public:
+		GeneratorConnectionFactory(const GeneratorServerConfig &config)
+			: config{config}, connections{0}
+		{}
+
+		Poco::Net::TCPServerConnection* createConnection(const Poco::Net::StreamSocket &socket) override
+		{
+			return new GeneratorConnection(socket, config, config.seed + connections++);
+		}
+	};
+}
+
+
+/********************** Method Implementations ******************************/
+
+/**
+ * \brief		: Parametrised constructor
+ * \param[IN]	: const GeneratorServerConfig &config - settings of the server
+ */
+GeneratorServer::GeneratorServer(const GeneratorServerConfig &config)
+	: config{config}, port{config.port}
+{}
+
+/**
+ * \brief		: Method to start accepting connections
+ * \param		: NONE
+ * \return		: NONE
+ */
+void GeneratorServer::start()
+{
+	Poco::Net::ServerSocket serverSocket(config.port);
+	port = serverSocket.address().port();
+
+	server.reset(new Poco::Net::TCPServer(new GeneratorConnectionFactory(config), serverSocket));
+	server->start();
+}
+
+/**
+ * \brief		: Method to stop the server
+ * \param		: NONE
+ * \return		: NONE
+ */
+void GeneratorServer::stop()
+{
+	if (server)
+	{
+		server->stop();
+		server.reset();
+	}
+}
+
+/**
+ * \brief		: Getter method for the port the server is listening on
+ * \param		: NONE
+ * \return		: unsigned short - port
+ */
+unsigned short GeneratorServer::getPort() const
+{
+	return port;
+}
+
+/**
+ * \brief		: Destructor, stops the server
+ */
+GeneratorServer::~GeneratorServer()
+{
+	stop();
+}
@@ -0,0 +1,104 @@
+/***************-************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file GeneratorServer.h
+ *	\brief Header file for GeneratorServer class
+ *
+ *  Created on: 19-10-2026
+ *  Author: Aditi Prakash
+ */
+/****************************************************************************/
+
+#ifndef GENERATORSERVER_H_
+#define GENERATORSERVER_H_
+
+//! System Includes
+#include <memory>
+#include <Poco/Net/TCPServer.h>
+
+/**
+ * \brief		: Settings of the local generator server
+ */
+struct GeneratorServerConfig
+{
+	//! Port to listen on, 0 picks a free port
+	unsigned short port = 4242;
+
+	//! Maximum number of records per second and connection, 0 means unlimited
+	double recordsPerSecond = 0;
+
+	//! Delay in milliseconds added before every answer
+	unsigned int latencyMs = 0;
+
+	//! Seed of the random generator, every connection derives its own seed from it
+	unsigned int seed = 42;
+
+	//! Fraction (0..1) of records sent with a malformed postal code
+	double invalidPostalCodeRate = 0;
+
+	//! Keep the connection open for further commands, false closes it after one answer like mnl.de
+	bool keepAlive = false;
+};
+
+/**
+ * \brief		: Local stand-in for the student generator server (mnl.de:4242)
+ * \details		: Speaks the same line protocol, 'generate' is answered with one random
+ *				  student as JSON on a single line and the connection is closed, 'quit'
+ *				  closes it without an answer. With keepAlive the connection stays open and
+ *				  pipelined commands are answered in order.
+ */
+class GeneratorServer
+{
+private:
+
+	/**
+	 * \brief		: Settings of the server
+	 */
+	GeneratorServerConfig config;
+
+	/**
+	 * \brief		: Poco TCP server, one thread per connection
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> server;
+
+	/**
+	 * \brief		: Port the server is listening on
+	 */
+	unsigned short port;
+
+public:
+
+	/**
+	 * \brief		: Parametrised constructor
+	 * \param[IN]	: const GeneratorServerConfig &config - settings of the server
+	 */
+	GeneratorServer(const GeneratorServerConfig &config);
+
+	/**
+	 * \brief		: Method to start accepting connections
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void start();
+
+	/**
+	 * \brief		: Method to stop the server
+	 * \param		: NONE
+	 * \return		: NONE
+	 */
+	void stop();
+
+	/**
+	 * \brief		: Getter method for the port the server is listening on
+	 * \param		: NONE
+	 * \return		: unsigned short - port
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * \brief		: Destructor, stops the server
+	 */
+	~GeneratorServer();
+};
+
+#endif /* GENERATORSERVER_H_ */
@@ -0,0 +1,66 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file GeneratorServerMain.cpp
+ *	\brief main file of the local student generator server
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <iostream>
+#include <string>
+#include <signal.h>
+
+//! User includes
+#include "GeneratorServer.h"
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: GeneratorServer [--port P] [--rate recordsPerSecond] [--latency ms]
+ *				  [--seed S] [--invalid fraction] [--keep-alive 0|1]
+ *				  With '--keep-alive 1' connections stay open for pipelined commands,
+ *				  by default they are closed after one answer like mnl.de does.
+ *				  Runs until SIGINT or SIGTERM is received.
+ */
+int main (int argc, char *argv[])
+{
+	GeneratorServerConfig config;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--port")				config.port = static_cast<unsigned short>(std::stoi(value));
+		else if (option == "--rate")		config.recordsPerSecond = std::stod(value);
+		else if (option == "--latency")		config.latencyMs = std::stoul(value);
+		else if (option == "--seed")		config.seed = std::stoul(value);
+		else if (option == "--invalid")		config.invalidPostalCodeRate = std::stod(value);
+		else if (option == "--keep-alive")	config.keepAlive = value != "0";
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	//! Block the termination signals before the server threads are started, they inherit the mask
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+	GeneratorServer server(config);
+	server.start();
+	std::cout << "Generator server listening on port " << server.getPort() << std::endl;
+
+	int signal {};
+	sigwait(&signals, &signal);
+
+	server.stop();
+	return 0;
+}
@@ -0,0 +1,91 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file ImportLoadTest.cpp
+ *	\brief Load test of the server import into StudentDb
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+//! User includes
+#include "GeneratorServer.h"
+#include "../ServerImporter.h"
+#include "../StudentDb.h"
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: ImportLoadTest [--students N] [--rate recordsPerSecond] [--latency ms]
+ *				  [--invalid fraction] [--pipeline 0|1] [--host H --port P]
+ *				  Without --host a local generator server is started on a free port. By
+ *				  default every record uses a connection of its own like against mnl.de,
+ *				  '--pipeline 1' pipelines the commands and keeps the connections of the
+ *				  local server open. The result is printed as one JSON object so that runs
+ *				  can be collected by scripts.
+ */
+int main (int argc, char *argv[])
+{
+	GeneratorServerConfig config;
+	config.port = 0;
+
+	unsigned int numberOfStudents = 100000;
+	std::string host;
+	unsigned short port = ServerImporter::defaultPort;
+	bool pipelining = false;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--students")			numberOfStudents = std::stoul(value);
+		else if (option == "--rate")		config.recordsPerSecond = std::stod(value);
+		else if (option == "--latency")		config.latencyMs = std::stoul(value);
+		else if (option == "--invalid")		config.invalidPostalCodeRate = std::stod(value);
+		else if (option == "--pipeline")	pipelining = value != "0";
+		else if (option == "--host")		host = value;
+		else if (option == "--port")		port = static_cast<unsigned short>(std::stoi(value));
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	//! Start the local stand-in unless a remote server was given
+	std::unique_ptr<GeneratorServer> server;
+	if (host.empty())
+	{
+		config.keepAlive = pipelining;
+		server.reset(new GeneratorServer(config));
+		server->start();
+		host = "localhost";
+		port = server->getPort();
+	}
+
+	StudentDb studentDb;
+	ServerImporter importer(host, port);
+	importer.setPipelining(pipelining);
+
+	auto start = std::chrono::steady_clock::now();
+	unsigned int addedStudents = importer.importStudents(studentDb, numberOfStudents);
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::cout << "{\"endpoint\":\"" << host << ":" << port << "\""
+			  << ",\"pipelining\":" << (pipelining ? "true" : "false")
+			  << ",\"requested\":" << numberOfStudents
+			  << ",\"added\":" << addedStudents
+			  << ",\"skipped\":" << importer.getSkippedRecords()
+			  << ",\"seconds\":" << elapsed.count()
+			  << ",\"studentsPerSecond\":" << (elapsed.count() > 0 ? addedStudents / elapsed.count() : 0)
+			  << "}" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,342 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbBenchmark.cpp
+ *	\brief Microbenchmarks of the StudentDb hot paths at several database sizes
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//! User includes
+#include "../StudentDb.h"
+#include "../WeeklyCourse.h"
+
+namespace
+{
+	const unsigned char majors[] = {'A', 'C', 'E', 'P'};
+	const float grades[] = {1.0f, 1.3f, 1.7f, 2.0f, 2.3f, 2.7f, 3.0f, 3.3f, 3.7f, 4.0f, 5.0f};
+
+	//! Weekly slots of the courses, up to this many consecutive course keys never meet at the same time
+	const unsigned int slotsPerWeek = 5 * 12;
+
+	//! Calls of the global operator new, counted by the replacements below
+	std::atomic<std::size_t> allocations {0};
+
+	/**
+	 * \brief		: Time and allocations of one benchmark
+	 */
+	struct Measurement
+	{
+		std::string name;
+		std::size_t operations;
+		double seconds;
+		std::size_t allocations;
+		std::size_t bytes;				//!< bytes read or written, 0 if the operation has none
+	};
+
+	template <typename Function>
+	Measurement measure(const std::string &name, std::size_t operations, Function function)
+	{
+		std::size_t allocationsBefore = allocations.load(std::memory_order_relaxed);
+		auto start = std::chrono::steady_clock::now();
+		function();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		return Measurement {name, operations, elapsed.count(),
+							allocations.load(std::memory_order_relaxed) - allocationsBefore, 0};
+	}
+
+	void writeMeasurement(std::ostream &out, const Measurement &measurement)
+	{
+		double operations = static_cast<double>(std::max<std::size_t>(measurement.operations, 1));
+		out << "{\"name\":\"" << measurement.name << "\",\"operations\":" << measurement.operations
+			<< ",\"nsPerOp\":" << measurement.seconds * 1e9 / operations
+			<< ",\"allocationsPerOp\":" << measurement.allocations / operations
+			<< ",\"opsPerSecond\":" << (measurement.seconds > 0 ? operations / measurement.seconds : 0);
+		if (measurement.bytes != 0)
+		{
+			out << ",\"megabytesPerSecond\":" << (measurement.seconds > 0 ? measurement.bytes / 1e6 / measurement.seconds : 0);
+		}
+		out << "}";
+	}
+
+	/**
+	 * \brief		: Runs every benchmark on a database of the given number of students
+	 */
+	void benchmarkScale(std::ostream &out, unsigned int numberOfStudents, unsigned int numberOfCourses,
+						unsigned int enrollmentsPerStudent, unsigned int queries)
+	{
+		std::mt19937 random(42);
+		std::vector<Measurement> measurements;
+		std::string file;
+
+		{
+			StudentDb studentDb;
+			for (unsigned int courseKey = 1; courseKey <= numberOfCourses; courseKey++)
+			{
+				unsigned int slot = (courseKey - 1) % slotsPerWeek;
+				studentDb.addWeeklyCourseToDb(WeeklyCourse(courseKey, "Course " + std::to_string(courseKey),
+										majors[courseKey % 4], static_cast<float>(2.5 * (1 + courseKey % 4)),
+										Poco::DateTime::DaysOfWeek(1 + slot / 12),
+										Poco::Data::Time(8 + slot % 12, 0, 0), Poco::Data::Time(8 + slot % 12, 45, 0)));
+			}
+
+			//! The students are built up front, only their insertion is measured
+			std::vector<Student> students;
+			students.reserve(numberOfStudents);
+			for (unsigned int student = 0; student < numberOfStudents; student++)
+			{
+				students.emplace_back("First" + std::to_string(random() % 100000), "Last" + std::to_string(student),
+									  Poco::Data::Date(1990 + random() % 15, 1 + random() % 12, 1 + random() % 28),
+									  Address("Street " + std::to_string(random() % 200), 10000 + random() % 90000,
+											  "City" + std::to_string(random() % 1000), ""));
+			}
+
+			measurements.push_back(measure("addStudentToDb", students.size(), [&]()
+			{
+				for (Student &student: students)
+				{
+					studentDb.addStudentToDb(student);
+				}
+			}));
+
+			//! Consecutive course keys from a random start that does not wrap around to key 1, at most
+			//! one week of slots: no course is taken twice and none clash
+			unsigned int enrollmentsTaken = std::min({enrollmentsPerStudent, numberOfCourses, slotsPerWeek});
+			std::vector<unsigned int> firstCourses;
+			for (std::size_t student = 0; student < students.size(); student++)
+			{
+				firstCourses.push_back(random() % (numberOfCourses - enrollmentsTaken + 1));
+			}
+			std::size_t enrollments = students.size() * enrollmentsTaken;
+
+			//! Only successful calls are counted, reserved up front to keep the allocations out of the measurement
+			std::vector<std::pair<unsigned int, unsigned int>> enrolled;
+			enrolled.reserve(enrollments);
+
+			measurements.push_back(measure("addEnrollmentToStudent", enrollments, [&]()
+			{
+				for (std::size_t student = 0; student < students.size(); student++)
+				{
+					for (unsigned int enrollment = 0; enrollment < enrollmentsTaken; enrollment++)
+					{
+						unsigned int matrikelNumber = students[student].getMatrikelNumber();
+						unsigned int courseKey = 1 + firstCourses[student] + enrollment;
+						if (studentDb.addEnrollmentToStudent(matrikelNumber, courseKey, "WS2019") == StudentDb::ENROLLED)
+						{
+							enrolled.emplace_back(matrikelNumber, courseKey);
+						}
+					}
+				}
+			}));
+			measurements.back().operations = enrolled.size();
+
+			std::size_t gradesUpdated = 0;
+			measurements.push_back(measure("updateStudentGradeInDb", enrolled.size(), [&]()
+			{
+				for (std::size_t enrollment = 0; enrollment < enrolled.size(); enrollment++)
+				{
+					gradesUpdated += studentDb.updateStudentGradeInDb(enrolled[enrollment].first, enrolled[enrollment].second,
+																	  grades[enrollment % 11]);
+				}
+			}));
+			measurements.back().operations = gradesUpdated;
+
+			if (enrolled.size() != enrollments || gradesUpdated != enrolled.size())
+			{
+				std::cerr << "Only " << enrolled.size() << " of " << enrollments << " enrollments added and "
+						  << gradesUpdated << " grades updated" << std::endl;
+			}
+
+			//! Half of the lookups miss
+			std::vector<unsigned int> lookups;
+			for (std::size_t lookup = 0; lookup < std::max<std::size_t>(students.size(), 1000); lookup++)
+			{
+				unsigned int matrikelNumber = students.empty() ? 0 : students[random() % students.size()].getMatrikelNumber();
+				lookups.push_back(lookup % 2 == 0 ? matrikelNumber : matrikelNumber + 2 * numberOfStudents + 1);
+			}
+			std::size_t found = 0;
+			measurements.push_back(measure("isStudentExists", lookups.size(), [&]()
+			{
+				for (unsigned int matrikelNumber: lookups)
+				{
+					found += studentDb.isStudentExists(matrikelNumber);
+				}
+			}));
+
+			//! Five digits of a first name, rare enough to scan most of the names
+			std::vector<std::string> searches;
+			for (unsigned int query = 0; query < queries; query++)
+			{
+				searches.push_back(std::to_string(10000 + random() % 90000));
+			}
+			measurements.push_back(measure("findStudents", searches.size(), [&]()
+			{
+				for (const std::string &search: searches)
+				{
+					found += studentDb.findStudents(search, 10).size();
+				}
+			}));
+
+			std::ostringstream written;
+			measurements.push_back(measure("write", 1, [&]() { studentDb.write(written); }));
+			file = written.str();
+			measurements.back().bytes = file.size();
+
+			if (found == 0 && numberOfStudents != 0)
+			{
+				std::cerr << "No student found" << std::endl;
+			}
+		}
+
+		//! Read into a database of its own, the first one is gone to keep the peak memory down
+		StudentDb studentDb;
+		std::istringstream input(file);
+		measurements.push_back(measure("read", 1, [&]() { studentDb.read(input); }));
+		measurements.back().bytes = file.size();
+
+		std::vector<std::string> dates, times;
+		for (unsigned int text = 0; text < 1000; text++)
+		{
+			dates.push_back(std::to_string(1 + text % 28) + "." + std::to_string(1 + text % 12) + "." + std::to_string(1990 + text % 30));
+			times.push_back(std::to_string(text % 24) + ":" + std::to_string(text % 60));
+		}
+		std::size_t conversions = std::max<std::size_t>(numberOfStudents, 1000);
+		long checksum = 0;
+
+		measurements.push_back(measure("splitDate", conversions, [&]()
+		{
+			for (std::size_t conversion = 0; conversion < conversions; conversion++)
+			{
+				checksum += studentDb.splitDate(dates[conversion % dates.size()], '.').day();
+			}
+		}));
+
+		measurements.push_back(measure("splitTime", conversions, [&]()
+		{
+			for (std::size_t conversion = 0; conversion < conversions; conversion++)
+			{
+				checksum += studentDb.splitTime(times[conversion % times.size()], ':').minute();
+			}
+		}));
+
+		out << "{\"students\":" << numberOfStudents << ",\"enrollmentsPerStudent\":" << enrollmentsPerStudent
+			<< ",\"fileBytes\":" << file.size() << ",\"checksum\":" << checksum << ",\"benchmarks\":[";
+		for (std::size_t measurement = 0; measurement < measurements.size(); measurement++)
+		{
+			out << (measurement > 0 ? "," : "");
+			writeMeasurement(out, measurements[measurement]);
+		}
+		out << "],\"memory\":";
+		studentDb.getMemoryReport().writeJson(out);
+		out << "}";
+	}
+}
+
+/**
+ * \brief		: Replacements of the global allocation functions counting the allocations
+ * \details		: new and delete are not inlined, GCC would take the free of the memory from
+ *				  malloc in an inlined operator new for a mismatched deallocation
+ */
+__attribute__((noinline))
+void* operator new(std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void *memory = std::malloc(size != 0 ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+__attribute__((noinline))
+void operator delete(void *memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+	operator delete(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+	operator delete(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+	operator delete(memory);
+}
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: StudentDbBenchmark [--scales 1000,100000,1000000] [--courses N]
+ *				  [--enrollments perStudent] [--queries N]
+ *				  Builds a database per scale and measures adding students and enrollments,
+ *				  grading, lookups, name searches, write, read, splitDate and splitTime.
+ *				  Every benchmark reports ns/op, allocations/op and ops/s (MB/s for read and
+ *				  write), all scales are printed as one JSON object. The memory report of the
+ *				  database is printed per scale as well.
+ */
+int main (int argc, char *argv[])
+{
+	std::string scales = "1000,100000,1000000";
+	unsigned int numberOfCourses = 500;
+	unsigned int enrollmentsPerStudent = 5;
+	unsigned int queries = 100;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--scales")				scales = value;
+		else if (option == "--courses")			numberOfCourses = std::stoul(value);
+		else if (option == "--enrollments")		enrollmentsPerStudent = std::stoul(value);
+		else if (option == "--queries")			queries = std::stoul(value);
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	if (numberOfCourses == 0)
+	{
+		std::cerr << "At least one course is needed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "{\"scales\":[";
+	std::istringstream scaleList(scales);
+	std::string scale;
+	for (bool first = true; std::getline(scaleList, scale, ','); first = false)
+	{
+		std::cout << (first ? "" : ",");
+		benchmarkScale(std::cout, std::stoul(scale), numberOfCourses, enrollmentsPerStudent, queries);
+		std::cout.flush();
+	}
+	std::cout << "]}" << std::endl;
+
+	return 0;
+}
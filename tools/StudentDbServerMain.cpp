@@ -0,0 +1,197 @@
+/***************************************************************************
+*============= Copyright by Darmstadt University of Applied Sciences =======
+****************************************************************************/
+/*! \file StudentDbServerMain.cpp
+ *	\brief main file of the StudentDb network service
+ *
+ *  Created on	: 19-10-2026
+ *  Author		: Aditi Prakash
+ */
+/****************************************************************************/
+
+//! System includes
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <time.h>
+#include <signal.h>
+
+//! User includes
+#include "../StudentDb.h"
+#include "../StudentDbService.h"
+#include "../StudentDbHttpServer.h"
+#include "../ReplicationLeader.h"
+#include "../ReplicationFollower.h"
+#include "../ThreadPool.h"
+
+/**
+ * \brief		: Entry point
+ * \details		: Usage: StudentDbServer [--port P] [--http P] [--workers N] [--db file.csv] [--save true]
+ *				         [--replication-port P | --replicate-from host:port] [--pool N] [--pin true]
+ *				  Loads the database file (if given), serves it until SIGINT or SIGTERM is
+ *				  received and writes it back to the same file if --save is true. With --http
+ *				  the REST front end is served as well. With --replication-port the server is
+ *				  a replication leader, with --replicate-from a read only follower of one.
+ *				  With --pool name searches and exports run on a thread pool of N workers
+ *				  (0 = one per core), --pin true pins them to one CPU each. On SIGUSR1 the
+ *				  operation metrics are written to stdout in the Prometheus text format.
+ */
+int main (int argc, char *argv[])
+{
+	unsigned short port = 4711;
+	unsigned short httpPort {};
+	unsigned int workers = std::thread::hardware_concurrency();
+	std::string dbFile;
+	bool save = false;
+	unsigned short replicationPort {};
+	std::string leaderAddress;
+	bool usePool = false;
+	unsigned int poolWorkers {};
+	bool pinWorkers = false;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+		std::string value = argv[i + 1];
+
+		if (option == "--port")				port = static_cast<unsigned short>(std::stoi(value));
+		else if (option == "--http")		httpPort = static_cast<unsigned short>(std::stoi(value));
+		else if (option == "--workers")		workers = std::stoul(value);
+		else if (option == "--db")			dbFile = value;
+		else if (option == "--save")		save = (value == "true");
+		else if (option == "--replication-port")	replicationPort = static_cast<unsigned short>(std::stoi(value));
+		else if (option == "--replicate-from")		leaderAddress = value;
+		else if (option == "--pool")		{ usePool = true; poolWorkers = std::stoul(value); }
+		else if (option == "--pin")			pinWorkers = (value == "true");
+		else
+		{
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	if (replicationPort != 0 && !leaderAddress.empty())
+	{
+		std::cerr << "A server is either a replication leader or a follower" << std::endl;
+		return 1;
+	}
+
+	std::string leaderHost;
+	unsigned short leaderPort {};
+	if (!leaderAddress.empty())
+	{
+		std::size_t colon = leaderAddress.rfind(':');
+		if (colon == std::string::npos || colon == 0 || colon + 1 == leaderAddress.size())
+		{
+			std::cerr << "Expected host:port after --replicate-from" << std::endl;
+			return 1;
+		}
+		leaderHost = leaderAddress.substr(0, colon);
+		leaderPort = static_cast<unsigned short>(std::stoi(leaderAddress.substr(colon + 1)));
+	}
+
+	//! Declared before the database, which uses it until it is destroyed
+	std::unique_ptr<ThreadPool> threadPool;
+	StudentDb studentDb;
+
+	if (!dbFile.empty() && leaderAddress.empty())
+	{
+		std::ifstream inFile(dbFile);
+		if (!inFile.good())
+		{
+			std::cerr << "Unable to read from file " << dbFile << std::endl;
+			return 1;
+		}
+		studentDb.read(inFile);
+	}
+
+	//! Block the termination and metrics signals before the worker threads are started, they inherit the mask
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGTERM);
+	sigaddset(&signals, SIGUSR1);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+	if (usePool)
+	{
+		threadPool.reset(new ThreadPool(poolWorkers, pinWorkers));
+		studentDb.setThreadPool(threadPool.get());
+	}
+
+	StudentDbService service(studentDb, port, workers > 0 ? workers : 1);
+	service.setReadOnly(!leaderAddress.empty());
+	service.start();
+	std::cout << "StudentDb service listening on port " << service.getPort()
+			  << " with " << workers << " workers" << std::endl;
+
+	std::unique_ptr<StudentDbHttpServer> httpServer;
+	if (httpPort != 0)
+	{
+		httpServer.reset(new StudentDbHttpServer(studentDb, httpPort, workers > 0 ? workers : 1));
+		httpServer->setReadOnly(!leaderAddress.empty());
+		httpServer->start();
+		std::cout << "REST front end listening on port " << httpServer->getPort() << std::endl;
+	}
+
+	std::unique_ptr<ReplicationLeader> leader;
+	std::unique_ptr<ReplicationFollower> follower;
+	if (replicationPort != 0)
+	{
+		leader.reset(new ReplicationLeader(studentDb, replicationPort));
+		leader->start();
+		std::cout << "Replication leader listening on port " << leader->getPort() << std::endl;
+	}
+	else if (!leaderAddress.empty())
+	{
+		follower.reset(new ReplicationFollower(studentDb, leaderHost, leaderPort));
+		follower->start();
+		std::cout << "Read only follower of " << leaderAddress << std::endl;
+	}
+
+	//! Wait for a termination signal, a follower reports its lag every 5 seconds meanwhile
+	timespec reportInterval {5, 0};
+	int received;
+	while ((received = sigtimedwait(&signals, nullptr, &reportInterval)) != SIGINT && received != SIGTERM)
+	{
+		if (received == SIGUSR1)
+		{
+			studentDb.getMetrics().writePrometheus(std::cout);
+			std::cout.flush();
+		}
+		else if (follower)
+		{
+			std::cout << "Replication " << (follower->isConnected() ? "connected" : "disconnected")
+					  << ", applied " << follower->getAppliedSequence()
+					  << ", lag " << follower->getLagRecords() << " records / "
+					  << follower->getLagMicroseconds() << " us" << std::endl;
+		}
+	}
+
+	if (follower)
+	{
+		follower->stop();
+	}
+	if (leader)
+	{
+		leader->stop();
+	}
+	service.stop();
+	if (httpServer)
+	{
+		httpServer->stop();
+	}
+
+	if (save && !dbFile.empty())
+	{
+		std::ofstream outFile(dbFile, std::ios::trunc);
+		std::shared_lock<std::shared_mutex> readLock(studentDb.getLock());
+		studentDb.write(outFile);
+	}
+
+	return 0;
+}